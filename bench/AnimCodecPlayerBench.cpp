@@ -0,0 +1,111 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/codec/SkCodec.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkImage.h"
+#include "include/utils/SkAnimCodecPlayer.h"
+#include "src/utils/SkOSPath.h"
+#include "tools/Resources.h"
+
+#include <algorithm>
+#include <vector>
+
+// Plays an animated image from start to end, drawing each frame. Either every decoded frame is
+// kept (the default), or the player keeps a few frames and decodes ahead on a background thread.
+// Reports how often a frame wasn't ready when drawn (i.e. playback stalled on decoding), and the
+// peak memory used by decoded frames.
+class AnimCodecPlayerBench final : public Benchmark {
+public:
+    AnimCodecPlayerBench(const char* file, bool bounded) : fFile(file), fBounded(bounded) {
+        SkString basename = SkOSPath::Basename(file);
+        fName.printf("animcodecplayer_%s_%s", basename.c_str(), bounded ? "bounded" : "cached");
+    }
+
+    bool isSuitableFor(Backend backend) override { return backend == kRaster_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        fData = GetResourceAsData(fFile);
+        if (!fData) {
+            return;
+        }
+        if (auto codec = SkCodec::MakeFromData(fData)) {
+            uint32_t msec = 0;
+            for (const auto& info : codec->getFrameInfo()) {
+                fFrameStarts.push_back(msec);
+                msec += info.fDuration;
+            }
+        }
+        if (fBounded) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(1);
+        }
+    }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        if (fFrameStarts.empty()) {
+            return;
+        }
+
+        while (loops-- > 0) {
+            // Start from scratch each time, to include the initial decode of every frame.
+            SkAnimCodecPlayer player(SkCodec::MakeFromData(fData));
+            if (fBounded) {
+                const auto frameBytes = SkImageInfo::MakeN32Premul(player.dimensions())
+                                            .computeMinByteSize();
+                player.setMemoryBudget(kBoundedFrames * frameBytes);
+                player.setDecodeAhead(fExecutor.get(), kBoundedFrames - 1);
+            }
+
+            for (uint32_t msec : fFrameStarts) {
+                player.seek(msec);
+                fStalls += !player.isFrameReady();
+                fFrames += 1;
+
+                canvas->drawImage(player.getFrame(), 0, 0);
+                fPeakBytes = std::max(fPeakBytes, player.cachedBytes());
+            }
+        }
+    }
+
+    void onPerCanvasPostDraw(SkCanvas*) override {
+        if (fFrames) {
+            SkDebugf("%s: %d/%d frames stalled, peak decoded memory %zu bytes\n",
+                     fName.c_str(), fStalls, fFrames, fPeakBytes);
+        }
+    }
+
+private:
+    // The bounded player keeps the current frame, and decodes the next ones ahead of time.
+    static constexpr int kBoundedFrames = 3;
+
+    const char*                 fFile;
+    const bool                  fBounded;
+    SkString                    fName;
+    sk_sp<SkData>               fData;
+    std::vector<uint32_t>       fFrameStarts;
+    std::unique_ptr<SkExecutor> fExecutor;
+    int                         fStalls = 0,
+                                fFrames = 0;
+    size_t                      fPeakBytes = 0;
+};
+
+#define ANIM_CODEC_PLAYER_BENCH(file)                                   \
+    DEF_BENCH(return new AnimCodecPlayerBench(file, false);)            \
+    DEF_BENCH(return new AnimCodecPlayerBench(file, true);)
+
+ANIM_CODEC_PLAYER_BENCH("images/alphabetAnim.gif")
+ANIM_CODEC_PLAYER_BENCH("images/flightAnim.gif")
+ANIM_CODEC_PLAYER_BENCH("images/required.gif")
+ANIM_CODEC_PLAYER_BENCH("images/required.webp")
+ANIM_CODEC_PLAYER_BENCH("images/stoplight.webp")
+
+#undef ANIM_CODEC_PLAYER_BENCH
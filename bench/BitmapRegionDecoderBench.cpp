@@ -13,12 +13,13 @@
 #include "src/core/SkOSFile.h"
 
 BitmapRegionDecoderBench::BitmapRegionDecoderBench(const char* baseName, SkData* encoded,
-        SkColorType colorType, uint32_t sampleSize, const SkIRect& subset)
+        SkColorType colorType, uint32_t sampleSize, const SkIRect& subset, int threads)
     : fBRD(nullptr)
     , fData(SkRef(encoded))
     , fColorType(colorType)
     , fSampleSize(sampleSize)
     , fSubset(subset)
+    , fThreads(threads)
 {
     // Choose a useful name for the color type
     const char* colorName = color_type_to_str(colorType);
@@ -27,6 +28,9 @@ BitmapRegionDecoderBench::BitmapRegionDecoderBench(const char* baseName, SkData*
     if (1 != sampleSize) {
         fName.appendf("_%.3f", 1.0f / (float) sampleSize);
     }
+    if (threads > 0) {
+        fName.appendf("_%dthreads", threads);
+    }
 }
 
 const char* BitmapRegionDecoderBench::onGetName() {
@@ -39,6 +43,9 @@ bool BitmapRegionDecoderBench::isSuitableFor(Backend backend) {
 
 void BitmapRegionDecoderBench::onDelayedSetup() {
     fBRD = android::skia::BitmapRegionDecoder::Make(fData);
+    if (fThreads > 0) {
+        fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+    }
 }
 
 void BitmapRegionDecoderBench::onDraw(int n, SkCanvas* canvas) {
@@ -46,7 +53,8 @@ void BitmapRegionDecoderBench::onDraw(int n, SkCanvas* canvas) {
     auto cs = fBRD->computeOutputColorSpace(ct, nullptr);
     for (int i = 0; i < n; i++) {
         SkBitmap bm;
-        SkAssertResult(fBRD->decodeRegion(&bm, nullptr, fSubset, fSampleSize, ct, false, cs));
+        SkAssertResult(fBRD->decodeRegion(&bm, nullptr, fSubset, fSampleSize, ct, false, cs,
+                                          fExecutor.get()));
     }
 }
 #endif // SK_ENABLE_ANDROID_UTILS
@@ -11,6 +11,7 @@
 #include "bench/Benchmark.h"
 #ifdef SK_ENABLE_ANDROID_UTILS
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkString.h"
@@ -30,8 +31,9 @@ class BitmapRegionDecoder;
 class BitmapRegionDecoderBench : public Benchmark {
 public:
     // Calls encoded->ref()
+    // If threads > 0, decodes on a thread pool with that many threads.
     BitmapRegionDecoderBench(const char* basename, SkData* encoded, SkColorType colorType,
-            uint32_t sampleSize, const SkIRect& subset);
+            uint32_t sampleSize, const SkIRect& subset, int threads = 0);
 
 protected:
     const char* onGetName() override;
@@ -46,6 +48,8 @@ private:
     const SkColorType                                   fColorType;
     const uint32_t                                      fSampleSize;
     const SkIRect                                       fSubset;
+    const int                                           fThreads;
+    std::unique_ptr<SkExecutor>                         fExecutor;
     using INHERITED = Benchmark;
 };
 #endif // SK_ENABLE_ANDROID_UTILS
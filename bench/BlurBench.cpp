@@ -6,6 +6,8 @@
  */
 #include "bench/Benchmark.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkGraphics.h"
 #include "include/core/SkMaskFilter.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkShader.h"
@@ -28,15 +30,19 @@ static const char* gStyleName[] = {
     "inner"
 };
 
+// When threads > 0, large masks are blurred in bands on a pool of that many threads.
 class BlurBench : public Benchmark {
     SkScalar    fRadius;
     SkBlurStyle fStyle;
+    int         fThreads;
     SkString    fName;
+    std::unique_ptr<SkExecutor> fExecutor;
 
 public:
-    BlurBench(SkScalar rad, SkBlurStyle bs) {
+    BlurBench(SkScalar rad, SkBlurStyle bs, int threads = 0) {
         fRadius = rad;
         fStyle = bs;
+        fThreads = threads;
         const char* name = rad > 0 ? gStyleName[bs] : "none";
         const char* quality = "high_quality";
         if (SkScalarFraction(rad) != 0) {
@@ -44,6 +50,9 @@ public:
         } else {
             fName.printf("blur_%d_%s_%s", SkScalarRoundToInt(rad), name, quality);
         }
+        if (threads > 0) {
+            fName.appendf("_%dthreads", threads);
+        }
     }
 
 protected:
@@ -51,7 +60,15 @@ protected:
         return fName.c_str();
     }
 
+    void onDelayedSetup() override {
+        if (fThreads > 0) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+        }
+    }
+
     void onDraw(int loops, SkCanvas* canvas) override {
+        SkExecutor* prevExecutor = SkGraphics::SetBlurExecutor(fExecutor.get());
+
         SkPaint paint;
         this->setupPaint(&paint);
 
@@ -69,6 +86,8 @@ protected:
             }
             canvas->drawOval(r, paint);
         }
+
+        SkGraphics::SetBlurExecutor(prevExecutor);
     }
 
 private:
@@ -101,3 +120,11 @@ DEF_BENCH(return new BlurBench(REAL, kOuter_SkBlurStyle);)
 DEF_BENCH(return new BlurBench(REAL, kInner_SkBlurStyle);)
 
 DEF_BENCH(return new BlurBench(0, kNormal_SkBlurStyle);)
+
+DEF_BENCH(return new BlurBench(BIG, kNormal_SkBlurStyle, 2);)
+DEF_BENCH(return new BlurBench(BIG, kNormal_SkBlurStyle, 4);)
+DEF_BENCH(return new BlurBench(BIG, kNormal_SkBlurStyle, 8);)
+
+DEF_BENCH(return new BlurBench(REALBIG, kNormal_SkBlurStyle, 2);)
+DEF_BENCH(return new BlurBench(REALBIG, kNormal_SkBlurStyle, 4);)
+DEF_BENCH(return new BlurBench(REALBIG, kNormal_SkBlurStyle, 8);)
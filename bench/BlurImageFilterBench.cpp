@@ -8,6 +8,8 @@
 #include "bench/Benchmark.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkGraphics.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkShader.h"
 #include "include/core/SkString.h"
@@ -28,6 +30,8 @@
 // the source's natural dimensions. This is intended to exercise blurring a larger source bitmap
 // to a smaller destination bitmap.
 
+// When 'threads' is set the CPU blur runs in bands on a pool of that many threads.
+
 // When 'expanded' is set we apply a cropRect to the input of the blurImageFilter (a noOp
 // offsetImageFilter). The crop rect in this case is an inset of the source's natural dimensions.
 // An additional crop rect is applied to the blurImageFilter that is just the natural dimensions
@@ -61,18 +65,22 @@ static sk_sp<SkImage> make_checkerboard(int width, int height) {
 class BlurImageFilterBench : public Benchmark {
 public:
     BlurImageFilterBench(SkScalar sigmaX, SkScalar sigmaY,  bool small, bool cropped,
-                         bool expanded)
+                         bool expanded, int threads = 0)
       : fIsSmall(small)
       , fIsCropped(cropped)
       , fIsExpanded(expanded)
       , fInitialized(false)
       , fSigmaX(sigmaX)
-      , fSigmaY(sigmaY) {
+      , fSigmaY(sigmaY)
+      , fThreads(threads) {
         fName.printf("blur_image_filter_%s%s%s_%.2f_%.2f",
             fIsSmall ? "small" : "large",
             fIsCropped ? "_cropped" : "",
             fIsExpanded ? "_expanded" : "",
             SkScalarToFloat(sigmaX), SkScalarToFloat(sigmaY));
+        if (fThreads > 0) {
+            fName.appendf("_%dthreads", fThreads);
+        }
         SkASSERT(!fIsExpanded || fIsCropped); // never want expansion w/o cropping
     }
 
@@ -85,6 +93,9 @@ protected:
         if (!fInitialized) {
             fCheckerboard = make_checkerboard(fIsSmall ? FILTER_WIDTH_SMALL : FILTER_WIDTH_LARGE,
                                               fIsSmall ? FILTER_HEIGHT_SMALL : FILTER_HEIGHT_LARGE);
+            if (fThreads > 0) {
+                fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+            }
             fInitialized = true;
         }
     }
@@ -106,9 +117,11 @@ protected:
         paint.setImageFilter(SkImageFilters::Blur(fSigmaX, fSigmaY, std::move(input), crop));
         SkSamplingOptions sampling;
 
+        SkExecutor* prevExecutor = SkGraphics::SetBlurExecutor(fExecutor.get());
         for (int i = 0; i < loops; i++) {
             canvas->drawImage(fCheckerboard, kX, kY, sampling, &paint);
         }
+        SkGraphics::SetBlurExecutor(prevExecutor);
     }
 
 private:
@@ -120,6 +133,8 @@ private:
     bool fInitialized;
     sk_sp<SkImage> fCheckerboard;
     SkScalar fSigmaX, fSigmaY;
+    int fThreads;
+    std::unique_ptr<SkExecutor> fExecutor;
     using INHERITED = Benchmark;
 };
 
@@ -161,3 +176,16 @@ DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_LARGE, BLUR_SIGMA_LARGE, tr
 DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_LARGE, BLUR_SIGMA_LARGE, false, true, true);)
 DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_HUGE, BLUR_SIGMA_HUGE, true, true, true);)
 DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_HUGE, BLUR_SIGMA_HUGE, false, true, true);)
+
+DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_LARGE, BLUR_SIGMA_LARGE,
+                                          false, false, false, 2);)
+DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_LARGE, BLUR_SIGMA_LARGE,
+                                          false, false, false, 4);)
+DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_LARGE, BLUR_SIGMA_LARGE,
+                                          false, false, false, 8);)
+DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_HUGE, BLUR_SIGMA_HUGE,
+                                          false, false, false, 2);)
+DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_HUGE, BLUR_SIGMA_HUGE,
+                                          false, false, false, 4);)
+DEF_BENCH(return new BlurImageFilterBench(BLUR_SIGMA_HUGE, BLUR_SIGMA_HUGE,
+                                          false, false, false, 8);)
@@ -21,7 +21,8 @@
 enum class ImageMode {
     kShared, // 1. One shared image referenced by every rectangle
     kUnique, // 2. Unique image for every rectangle
-    kNone    // 3. No image, solid color shading per rectangle
+    kNone,   // 3. No image, solid color shading per rectangle
+    kAtlas   // 4. One shared image, with each rectangle drawing a different cell of it
 };
 //   X
 enum class DrawMode {
@@ -46,9 +47,13 @@ public:
     inline static constexpr int kHeight     = 1024;
 
     // There will either be 0 images, 1 image, or 1 image per rect
-    inline static constexpr int kImageCount = kImageMode == ImageMode::kShared ?
+    inline static constexpr int kImageCount =
+            kImageMode == ImageMode::kShared || kImageMode == ImageMode::kAtlas ?
             1 : (kImageMode == ImageMode::kNone ? 0 : kRectCount);
 
+    // The atlas is a grid of kAtlasCells x kAtlasCells cells.
+    inline static constexpr int kAtlasCells = 16;
+
     bool isSuitableFor(Backend backend) override {
         if (kDrawMode == DrawMode::kBatch && kImageMode == ImageMode::kNone) {
             // Currently the bulk color quad API is only available on skgpu::v1::SurfaceDrawContext
@@ -76,6 +81,8 @@ protected:
             fName.append("_sharedimage");
         } else if (kImageMode == ImageMode::kUnique) {
             fName.append("_uniqueimages");
+        } else if (kImageMode == ImageMode::kAtlas) {
+            fName.append("_atlas");
         } else {
             fName.append("_solidcolor");
         }
@@ -88,16 +95,28 @@ protected:
         }
     }
 
+    SkRect srcRect(int i) const {
+        int imageIndex = kImageMode == ImageMode::kUnique ? i : 0;
+        SkRect bounds = SkRect::MakeIWH(fImages[imageIndex]->width(),
+                                        fImages[imageIndex]->height());
+        if (kImageMode != ImageMode::kAtlas) {
+            return bounds;
+        }
+        int cell = i % (kAtlasCells * kAtlasCells);
+        SkScalar w = bounds.width()  / kAtlasCells,
+                 h = bounds.height() / kAtlasCells;
+        return SkRect::MakeXYWH((cell % kAtlasCells) * w, (cell / kAtlasCells) * h, w, h);
+    }
+
     void drawImagesBatch(SkCanvas* canvas) const {
         SkASSERT(kImageMode != ImageMode::kNone);
         SkASSERT(kDrawMode == DrawMode::kBatch);
 
         SkCanvas::ImageSetEntry batch[kRectCount];
         for (int i = 0; i < kRectCount; ++i) {
-            int imageIndex = kImageMode == ImageMode::kShared ? 0 : i;
+            int imageIndex = kImageMode == ImageMode::kUnique ? i : 0;
             batch[i].fImage = fImages[imageIndex];
-            batch[i].fSrcRect = SkRect::MakeIWH(fImages[imageIndex]->width(),
-                                                fImages[imageIndex]->height());
+            batch[i].fSrcRect = this->srcRect(i);
             batch[i].fDstRect = fRects[i];
             batch[i].fAAFlags = SkCanvas::kAll_QuadAAFlags;
         }
@@ -118,10 +137,8 @@ protected:
         paint.setAntiAlias(true);
 
         for (int i = 0; i < kRectCount; ++i) {
-            int imageIndex = kImageMode == ImageMode::kShared ? 0 : i;
-            SkRect srcRect = SkRect::MakeIWH(fImages[imageIndex]->width(),
-                                             fImages[imageIndex]->height());
-            canvas->drawImageRect(fImages[imageIndex].get(), srcRect, fRects[i],
+            int imageIndex = kImageMode == ImageMode::kUnique ? i : 0;
+            canvas->drawImageRect(fImages[imageIndex].get(), this->srcRect(i), fRects[i],
                                   SkSamplingOptions(SkFilterMode::kLinear), &paint,
                                   SkCanvas::kFast_SrcRectConstraint);
         }
@@ -222,6 +239,16 @@ protected:
             SkBitmap bm;
             bm.allocN32Pixels(256, 256);
             bm.eraseColor(fColors[i].toSkColor());
+            if (kImageMode == ImageMode::kAtlas) {
+                // Give each cell its own color, so the atlas isn't one solid color.
+                for (int cell = 0; cell < kAtlasCells * kAtlasCells; ++cell) {
+                    int w = bm.width()  / kAtlasCells,
+                        h = bm.height() / kAtlasCells;
+                    bm.erase(fColors[cell % kRectCount].toSkColor(),
+                             SkIRect::MakeXYWH((cell % kAtlasCells) * w,
+                                               (cell / kAtlasCells) * h, w, h));
+                }
+            }
             auto image = bm.asImage();
 
             fImages[i] = direct ? image->makeTextureImage(direct) : std::move(image);
@@ -271,6 +298,8 @@ protected:
     ADD_BENCH(n, layout, ImageMode::kShared, DrawMode::kRef)                   \
     ADD_BENCH(n, layout, ImageMode::kUnique, DrawMode::kBatch)                 \
     ADD_BENCH(n, layout, ImageMode::kUnique, DrawMode::kRef)                   \
+    ADD_BENCH(n, layout, ImageMode::kAtlas,  DrawMode::kBatch)                 \
+    ADD_BENCH(n, layout, ImageMode::kAtlas,  DrawMode::kRef)                   \
     ADD_BENCH(n, layout, ImageMode::kNone,   DrawMode::kBatch)                 \
     ADD_BENCH(n, layout, ImageMode::kNone,   DrawMode::kRef)                   \
     ADD_BENCH(n, layout, ImageMode::kNone,   DrawMode::kQuad)
@@ -9,6 +9,10 @@
 #include "bench/CodecBenchPriv.h"
 #include "include/codec/SkCodec.h"
 #include "include/core/SkBitmap.h"
+#include "include/core/SkStream.h"
+#include "include/encode/SkPngEncoder.h"
+#include "include/private/SkColorData.h"
+#include "include/utils/SkRandom.h"
 #include "src/core/SkOSFile.h"
 #include "tools/flags/CommandLineFlags.h"
 
@@ -64,3 +68,103 @@ void CodecBench::onDraw(int n, SkCanvas* canvas) {
                  || result == SkCodec::kIncompleteInput);
     }
 }
+
+// Decodes PNGs we encode ourselves, one per pixel layout handled by SkPngCodec's swizzlers, so
+// changes to the row conversions can be measured without an image directory.  Each decode is
+// kHeight rows, so rows/sec is kHeight / (time per decode).
+class PngRowsBench : public Benchmark {
+public:
+    enum class Format { kRGBA8, kRGB8, kGray8, kGrayAlpha8, kRGBA16 };
+
+    PngRowsBench(Format format, SkAlphaType dstAlphaType)
+        : fFormat(format)
+        , fDstAlphaType(dstAlphaType) {
+        static const char* kNames[] = { "rgba8", "rgb8", "gray8", "grayalpha8", "rgba16" };
+        fName.printf("PngRows_%s_%s_%dx%d", kNames[(int)format],
+                     dstAlphaType == kPremul_SkAlphaType ? "premul" : "unpremul",
+                     kWidth, kHeight);
+    }
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        // A smooth gradient with a little noise, so the encoder picks a mix of row filters.
+        SkBitmap rgba;
+        rgba.allocPixels(SkImageInfo::Make(kWidth, kHeight, kRGBA_8888_SkColorType,
+                                           kUnpremul_SkAlphaType));
+        SkRandom rand;
+        for (int y = 0; y < kHeight; y++) {
+            for (int x = 0; x < kWidth; x++) {
+                const uint32_t noise = rand.nextU() & 0x0f;
+                *rgba.getAddr32(x, y) = SkPackARGB_as_RGBA(0x40 + (x >> 2) / 2 + noise,
+                                                           x >> 2,
+                                                           y,
+                                                           noise << 4);
+            }
+        }
+
+        SkImageInfo srcInfo = rgba.info();
+        switch (fFormat) {
+            case Format::kRGBA8:
+                break;
+            case Format::kRGB8:
+                srcInfo = srcInfo.makeAlphaType(kOpaque_SkAlphaType);
+                break;
+            case Format::kGray8:
+                srcInfo = srcInfo.makeColorType(kGray_8_SkColorType)
+                                 .makeAlphaType(kOpaque_SkAlphaType);
+                break;
+            case Format::kGrayAlpha8:
+                srcInfo = srcInfo.makeColorType(kAlpha_8_SkColorType)
+                                 .makeAlphaType(kPremul_SkAlphaType);
+                break;
+            case Format::kRGBA16:
+                srcInfo = srcInfo.makeColorType(kRGBA_F16_SkColorType);
+                break;
+        }
+        SkBitmap src;
+        src.allocPixels(srcInfo);
+        SkAssertResult(rgba.readPixels(src.pixmap()));
+
+        SkDynamicMemoryWStream stream;
+        SkAssertResult(SkPngEncoder::Encode(&stream, src.pixmap(), {}));
+        fData = stream.detachAsData();
+
+        fDstInfo = SkImageInfo::MakeN32(kWidth, kHeight, fDstAlphaType);
+        fPixels.reset(fDstInfo.computeMinByteSize());
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; i++) {
+            std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(fData);
+            SkAssertResult(codec->getPixels(fDstInfo, fPixels.get(), fDstInfo.minRowBytes())
+                           == SkCodec::kSuccess);
+        }
+    }
+
+private:
+    static constexpr int kWidth  = 1024;
+    static constexpr int kHeight = 256;
+
+    const Format      fFormat;
+    const SkAlphaType fDstAlphaType;
+    SkString          fName;
+    sk_sp<SkData>     fData;
+    SkImageInfo       fDstInfo;
+    SkAutoMalloc      fPixels;
+
+    using INHERITED = Benchmark;
+};
+
+#define PNG_ROWS_BENCHES(format)                                                                  \
+    DEF_BENCH(return new PngRowsBench(PngRowsBench::Format::format, kPremul_SkAlphaType);)   \
+    DEF_BENCH(return new PngRowsBench(PngRowsBench::Format::format, kUnpremul_SkAlphaType);)
+
+PNG_ROWS_BENCHES(kRGBA8)
+PNG_ROWS_BENCHES(kRGB8)
+PNG_ROWS_BENCHES(kGray8)
+PNG_ROWS_BENCHES(kGrayAlpha8)
+PNG_ROWS_BENCHES(kRGBA16)
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkString.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <vector>
+
+// Runs many tiny tasks on each kind of thread pool, so the time is mostly spent handing out work.
+// The flat benches add every task from the bench's thread, as SkTaskGroup::batch() does. In the
+// nested benches, each of a few tasks adds the rest from a pool thread, as nested task groups do.
+class ExecutorBench : public Benchmark {
+public:
+    enum class Pool { kFIFO, kLIFO, kWorkStealing };
+
+    ExecutorBench(Pool pool, bool nested) : fPool(pool), fNested(nested) {
+        static const char* kNames[] = {"fifo", "lifo", "work_stealing"};
+        fName.printf("executor_%s_%s", kNames[(int)pool], nested ? "nested" : "flat");
+    }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+    void onDelayedSetup() override {
+        switch (fPool) {
+            case Pool::kFIFO:         fExecutor = SkExecutor::MakeFIFOThreadPool();         break;
+            case Pool::kLIFO:         fExecutor = SkExecutor::MakeLIFOThreadPool();         break;
+            case Pool::kWorkStealing: fExecutor = SkExecutor::MakeWorkStealingThreadPool(); break;
+        }
+        fResults.resize(kOuterTasks * kInnerTasks);
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int loop = 0; loop < loops; loop++) {
+            SkTaskGroup group(*fExecutor);
+            if (fNested) {
+                group.batch(kOuterTasks, [&](int outer) {
+                    for (int inner = 0; inner < kInnerTasks; inner++) {
+                        group.add([&, outer, inner] { this->task(outer * kInnerTasks + inner); });
+                    }
+                });
+            } else {
+                group.batch(kOuterTasks * kInnerTasks, [&](int i) { this->task(i); });
+            }
+            group.wait();
+        }
+    }
+
+private:
+    static constexpr int kOuterTasks = 16;
+    static constexpr int kInnerTasks = 64;
+
+    void task(int i) {
+        uint32_t x = i;
+        for (int j = 0; j < 32; j++) {
+            x = x * 1664525 + 1013904223;
+        }
+        fResults[i] = x;
+    }
+
+    const Pool fPool;
+    const bool fNested;
+    SkString fName;
+    std::unique_ptr<SkExecutor> fExecutor;
+    std::vector<uint32_t> fResults;
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new ExecutorBench(ExecutorBench::Pool::kFIFO, false);)
+DEF_BENCH(return new ExecutorBench(ExecutorBench::Pool::kLIFO, false);)
+DEF_BENCH(return new ExecutorBench(ExecutorBench::Pool::kWorkStealing, false);)
+DEF_BENCH(return new ExecutorBench(ExecutorBench::Pool::kFIFO, true);)
+DEF_BENCH(return new ExecutorBench(ExecutorBench::Pool::kLIFO, true);)
+DEF_BENCH(return new ExecutorBench(ExecutorBench::Pool::kWorkStealing, true);)
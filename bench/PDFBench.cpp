@@ -10,9 +10,11 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkData.h"
 #include "include/core/SkExecutor.h"
+#include "include/core/SkFont.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkStream.h"
+#include "include/core/SkTypeface.h"
 #include "include/effects/SkGradientShader.h"
 #include "include/private/SkTo.h"
 #include "include/utils/SkRandom.h"
@@ -302,6 +304,79 @@ struct PDFClipPathBenchmark : public Benchmark {
     }
 };
 
+// Writes a document of many pages, each with text, a gradient and an image of its own, the way a
+// long report would. With threads > 0 the document serializes and compresses on an executor.
+class PDFMultiPageBench : public Benchmark {
+public:
+    PDFMultiPageBench(int pages, int threads) : fPages(pages), fThreads(threads) {
+        fName.printf("PDFMultiPage_%dpages", pages);
+        if (threads > 0) {
+            fName.appendf("_%dthreads", threads);
+        }
+    }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+    void onDelayedSetup() override {
+        if (fThreads > 0) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+        }
+        fTypeface = MakeResourceAsTypeface("fonts/Roboto-Regular.ttf");
+        SkRandom random;
+        for (int i = 0; i < kImageCount; ++i) {
+            SkBitmap bitmap;
+            bitmap.allocN32Pixels(128, 128);
+            for (int y = 0; y < 128; ++y) {
+                for (int x = 0; x < 128; ++x) {
+                    *bitmap.getAddr32(x, y) = random.nextU() | 0xFF000000;
+                }
+            }
+            fImages[i] = bitmap.asImage();
+        }
+    }
+    void onDraw(int loops, SkCanvas*) override {
+        SkFont font(fTypeface, 10);
+        SkPaint textPaint;
+        const SkPoint pts[] = {{0, 0}, {612, 0}};
+        const SkColor colors[] = {SK_ColorBLUE, SK_ColorGREEN};
+        SkPaint gradientPaint;
+        gradientPaint.setShader(
+                SkGradientShader::MakeLinear(pts, colors, nullptr, 2, SkTileMode::kClamp));
+
+        while (loops-- > 0) {
+            SkNullWStream wStream;
+            SkPDF::Metadata metadata;
+            metadata.fExecutor = fExecutor.get();
+            auto doc = SkPDF::MakeDocument(&wStream, metadata);
+            for (int page = 0; page < fPages; ++page) {
+                SkCanvas* canvas = doc->beginPage(612, 792);
+                canvas->drawRect({36, 36, 576, 72}, gradientPaint);
+                canvas->drawImage(fImages[page % kImageCount], 36, 80);
+                for (int line = 0; line < 50; ++line) {
+                    SkString text = SkStringPrintf(
+                            "Page %d, line %d: the quick brown fox jumps over the lazy dog.",
+                            page, line);
+                    canvas->drawString(text, 36, 230 + 11 * line, font, textPaint);
+                }
+                doc->endPage();
+            }
+            doc->close();
+        }
+    }
+
+private:
+    static constexpr int kImageCount = 8;
+    const int fPages;
+    const int fThreads;
+    SkString fName;
+    std::unique_ptr<SkExecutor> fExecutor;
+    sk_sp<SkTypeface> fTypeface;
+    sk_sp<SkImage> fImages[kImageCount];
+};
+
 }  // namespace
 DEF_BENCH(return new PDFImageBench;)
 DEF_BENCH(return new PDFJpegImageBench;)
@@ -310,6 +385,8 @@ DEF_BENCH(return new PDFColorComponentBench;)
 DEF_BENCH(return new PDFShaderBench;)
 DEF_BENCH(return new WritePDFTextBenchmark;)
 DEF_BENCH(return new PDFClipPathBenchmark;)
+DEF_BENCH(return new PDFMultiPageBench(100, 0);)
+DEF_BENCH(return new PDFMultiPageBench(100, 4);)
 
 #ifdef SK_PDF_ENABLE_SLOW_TESTS
 #include "include/core/SkExecutor.h"
@@ -16,8 +16,11 @@
 
 #include "modules/skparagraph/include/FontCollection.h"
 #include "modules/skparagraph/include/ParagraphBuilder.h"
+#include "modules/skparagraph/include/ParagraphCache.h"
 #include "modules/skparagraph/include/ParagraphStyle.h"
 
+#include <string>
+
 class ParagraphBench final : public Benchmark {
     SkString fName;
     sk_sp<skia::textlayout::FontCollection> fFontCollection;
@@ -95,4 +98,80 @@ private:
 
 DEF_BENCH( return new ParagraphBench; )
 
+// Types one character at a time into a paragraph made of differently styled spans, rebuilding and
+// laying it out after each keystroke like an editor would. The edited paragraphs miss the
+// paragraph cache; with the cache on, only the edited span is shaped again.
+class ParagraphEditBench final : public Benchmark {
+    static constexpr int kSpans = 16;
+
+    SkString fName;
+    sk_sp<skia::textlayout::FontCollection> fFontCollection;
+    bool fUseCache;
+    int fEdits = 0;
+
+public:
+    ParagraphEditBench(bool useCache) : fUseCache(useCache) {
+        fName.printf("skparagraph_edit%s", useCache ? "" : "_nocache");
+    }
+
+protected:
+    const char* onGetName() override {
+        return fName.c_str();
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        fFontCollection = sk_make_sp<skia::textlayout::FontCollection>();
+        fFontCollection->setDefaultFontManager(SkFontMgr::RefDefault());
+        fFontCollection->getParagraphCache()->turnOn(fUseCache);
+    }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        const char* text =
+            "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+            "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam. ";
+
+        skia::textlayout::TextStyle styles[2];
+        for (auto& style : styles) {
+            style.setFontFamilies({SkString("Roboto")});
+            style.setColor(SK_ColorBLACK);
+        }
+        styles[1].setFontStyle(SkFontStyle::Bold());
+
+        skia::textlayout::ParagraphStyle paragraph_style;
+        for (int i = 0; i < loops; ++i) {
+            auto builder =
+                skia::textlayout::ParagraphBuilder::make(paragraph_style, fFontCollection);
+            if (!builder) {
+                return;
+            }
+
+            // Insert one more character somewhere in one of the spans
+            int edit = fEdits++;
+            int editedSpan = edit % kSpans;
+            for (int span = 0; span < kSpans; ++span) {
+                std::string spanText(text);
+                if (span == editedSpan) {
+                    spanText.insert((edit / kSpans) % spanText.size(), 1, 'a' + edit % 26);
+                }
+                builder->pushStyle(styles[span & 1]);
+                builder->addText(spanText.c_str(), spanText.size());
+                builder->pop();
+            }
+
+            auto paragraph = builder->Build();
+            paragraph->layout(300);
+        }
+    }
+
+private:
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH( return new ParagraphEditBench(true); )
+DEF_BENCH( return new ParagraphEditBench(false); )
+
 #endif // SK_ENABLE_PARAGRAPH
@@ -14,8 +14,13 @@
 #include "include/core/SkPictureRecorder.h"
 #include "include/core/SkPoint.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkRegion.h"
 #include "include/core/SkString.h"
+#include "include/core/SkSurface.h"
 #include "include/utils/SkRandom.h"
+#include "src/core/SkBigPicture.h"
+#include "src/core/SkPicturePriv.h"
+#include "src/core/SkRecordDraw.h"
 
 // This is designed to emulate about 4 screens of textual content
 
@@ -97,3 +102,89 @@ DEF_BENCH( return new TiledPlaybackBench(kNone,     kRandom); )
 DEF_BENCH( return new TiledPlaybackBench(kNone,     kTiled ); )
 DEF_BENCH( return new TiledPlaybackBench(kRTree,    kRandom); )
 DEF_BENCH( return new TiledPlaybackBench(kRTree,    kTiled ); )
+
+// A UI redraws the same picture every frame with a few of its ops changed, into a surface that
+// keeps its pixels.  Each frame we compare the new picture's record with the last one, and only
+// redraw the damage.  The _full variant redraws everything, for comparison.
+class DamagePlaybackBench : public Benchmark {
+public:
+    DamagePlaybackBench(int percentChanged, bool full)
+        : fPercentChanged(percentChanged)
+        , fFull(full)
+        , fName(full ? SkString("damage_playback_full")
+                     : SkStringPrintf("damage_playback_%dpct", percentChanged)) {}
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        // The same rects in both pictures, with fPercentChanged of them a different color.
+        SkRandom rand;
+        SkRect rects[kOps];
+        SkColor colors[kOps];
+        for (int i = 0; i < kOps; i++) {
+            rects[i] = SkRect::MakeXYWH(rand.nextRangeScalar(0, kSize),
+                                        rand.nextRangeScalar(0, kSize),
+                                        rand.nextRangeScalar(4, 64),
+                                        rand.nextRangeScalar(4, 64));
+            colors[i] = rand.nextU() | 0xFF000000;
+        }
+        for (int p = 0; p < 2; p++) {
+            SkRTreeFactory factory;
+            SkPictureRecorder recorder;
+            SkCanvas* canvas = recorder.beginRecording(kSize, kSize, &factory);
+            for (int i = 0; i < kOps; i++) {
+                SkPaint paint;
+                paint.setColor(p == 1 && (int)rand.nextULessThan(100) < fPercentChanged
+                                       ? ~colors[i] | 0xFF000000
+                                       : colors[i]);
+                canvas->drawRect(rects[i], paint);
+            }
+            fPictures[p] = recorder.finishRecordingAsPicture();
+        }
+
+        fSurface = SkSurface::MakeRasterN32Premul(kSize, kSize);
+        fPictures[0]->playback(fSurface->getCanvas());
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        SkCanvas* canvas = fSurface->getCanvas();
+        for (int i = 0; i < loops; i++) {
+            // Alternate between the two pictures, so every frame has the same damage.
+            const SkBigPicture* prev = SkPicturePriv::AsSkBigPicture(fPictures[ i      & 1]);
+            const SkBigPicture* next = SkPicturePriv::AsSkBigPicture(fPictures[(i + 1) & 1]);
+            if (fFull) {
+                canvas->clear(SK_ColorTRANSPARENT);
+                next->playback(canvas, nullptr);
+                continue;
+            }
+
+            // We keep the bounds of the last frame, but have to compute them for the new one.
+            const SkRecord& record = *next->record();
+            SkRecordFillBounds(next->cullRect(), record, fBounds[(i + 1) & 1], fMeta);
+            SkRegion damage;
+            SkRecordComputeDamage(*prev->record(), fBounds[i & 1], record, fBounds[(i + 1) & 1],
+                                  &damage);
+            SkRecordDrawDamage(record, canvas, damage, nullptr, nullptr, 0, next->bbh());
+        }
+    }
+
+private:
+    static constexpr int kOps  = 10000;
+    static constexpr int kSize = 1024;
+
+    const int        fPercentChanged;
+    const bool       fFull;
+    SkString         fName;
+    sk_sp<SkPicture> fPictures[2];
+    sk_sp<SkSurface> fSurface;
+
+    SkRect                    fBounds[2][kOps];
+    SkBBoxHierarchy::Metadata fMeta[kOps];
+};
+
+DEF_BENCH( return new DamagePlaybackBench( 1, false); )
+DEF_BENCH( return new DamagePlaybackBench(10, false); )
+DEF_BENCH( return new DamagePlaybackBench(50, false); )
+DEF_BENCH( return new DamagePlaybackBench(10, true ); )
@@ -50,11 +50,17 @@ void RecordingBench::onDraw(int loops, SkCanvas*) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "include/core/SkSerialProcs.h"
+#include "include/utils/SkNoDrawCanvas.h"
 
-DeserializePictureBench::DeserializePictureBench(const char* name, sk_sp<SkData> data)
+DeserializePictureBench::DeserializePictureBench(const char* name, sk_sp<SkData> data, bool lazy)
     : fName(name)
     , fEncodedPicture(std::move(data))
-{}
+    , fLazy(lazy)
+{
+    if (fLazy) {
+        fName.append("_lazy");
+    }
+}
 
 const char* DeserializePictureBench::onGetName() {
     return fName.c_str();
@@ -70,6 +76,15 @@ SkIPoint DeserializePictureBench::onGetSize() {
 
 void DeserializePictureBench::onDraw(int loops, SkCanvas*) {
     for (int i = 0; i < loops; ++i) {
-        SkPicture::MakeFromData(fEncodedPicture.get());
+        if (fLazy) {
+            sk_sp<SkPicture> pic = SkPicture::MakeLazyFromData(fEncodedPicture.get());
+            if (pic) {
+                SkIRect bounds = pic->cullRect().roundOut();
+                SkNoDrawCanvas canvas(bounds.right(), bounds.bottom());
+                pic->playback(&canvas);
+            }
+        } else {
+            SkPicture::MakeFromData(fEncodedPicture.get());
+        }
     }
 }
@@ -42,7 +42,9 @@ private:
 
 class DeserializePictureBench : public Benchmark {
 public:
-    DeserializePictureBench(const char* name, sk_sp<SkData> encodedPicture);
+    // With 'lazy', each loop deserializes with SkPicture::MakeLazyFromData() and plays the picture
+    // back once, which is when its commands are decoded to draw.
+    DeserializePictureBench(const char* name, sk_sp<SkData> encodedPicture, bool lazy = false);
 
 protected:
     const char* onGetName() override;
@@ -53,6 +55,7 @@ protected:
 private:
     SkString      fName;
     sk_sp<SkData> fEncodedPicture;
+    bool          fLazy;
 
     using INHERITED = Benchmark;
 };
@@ -6,6 +6,7 @@
  */
 
 #include "bench/SKPBench.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkSurface.h"
 #include "include/gpu/GrDirectContext.h"
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
@@ -16,6 +17,13 @@
 static DEFINE_int(CPUbenchTileW, 256, "Tile width  used for CPU SKP playback.");
 static DEFINE_int(CPUbenchTileH, 256, "Tile height used for CPU SKP playback.");
 
+static DEFINE_bool(CPUbenchTiledRaster, false,
+                   "Play back CPU SKPs into one SkSurface::MakeRasterTiled() surface, which "
+                   "rasterizes its CPUbenchTileW x CPUbenchTileH tiles in parallel.");
+static DEFINE_int(CPUbenchTiledThreads, -1,
+                  "Threads used by --CPUbenchTiledRaster; -1 means one per core, 0 means "
+                  "rasterize tiles serially on the calling thread.");
+
 static DEFINE_int(GPUbenchTileW, 1600, "Tile width  used for GPU SKP playback.");
 static DEFINE_int(GPUbenchTileH, 512, "Tile height used for GPU SKP playback.");
 
@@ -57,6 +65,22 @@ void SKPBench::onPerCanvasPreDraw(SkCanvas* canvas) {
     int tileW = gpu ? FLAGS_GPUbenchTileW : FLAGS_CPUbenchTileW,
         tileH = gpu ? FLAGS_GPUbenchTileH : FLAGS_CPUbenchTileH;
 
+    if (!gpu && FLAGS_CPUbenchTiledRaster) {
+        // The surface does the tiling itself, so we draw the whole picture into one of them.
+        if (!fExecutor && FLAGS_CPUbenchTiledThreads != 0) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(FLAGS_CPUbenchTiledThreads);
+        }
+        SkImageInfo ii = canvas->imageInfo().makeDimensions(bounds.size());
+        *fTileRects.append() = bounds;
+        fSurfaces.push_back(SkSurface::MakeRasterTiled(ii,
+                                                       fExecutor ? fExecutor.get()
+                                                                 : &SkExecutor::GetDefault(),
+                                                       {tileW, tileH}));
+        fSurfaces.back()->getCanvas()->setMatrix(canvas->getLocalToDevice());
+        fSurfaces.back()->getCanvas()->scale(fScale, fScale);
+        return;
+    }
+
     tileW = std::min(tileW, bounds.width());
     tileH = std::min(tileH, bounds.height());
 
@@ -138,6 +162,12 @@ void SKPBench::drawPicture() {
     for (int j = 0; j < fTileRects.count(); ++j) {
         fSurfaces[j]->flush();
     }
+    if (FLAGS_CPUbenchTiledRaster) {
+        // Tiled raster surfaces only rasterize what they recorded when their canvas is flushed.
+        for (int j = 0; j < fTileRects.count(); ++j) {
+            fSurfaces[j]->getCanvas()->flush();
+        }
+    }
 }
 
 #include "src/gpu/ganesh/GrGpu.h"
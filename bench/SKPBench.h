@@ -13,6 +13,7 @@
 #include "include/core/SkPicture.h"
 #include "include/private/SkTDArray.h"
 
+class SkExecutor;
 class SkSurface;
 
 /**
@@ -56,6 +57,7 @@ private:
 
     SkTArray<sk_sp<SkSurface>> fSurfaces;   // for MultiPictureDraw
     SkTDArray<SkIRect> fTileRects;     // for MultiPictureDraw
+    std::unique_ptr<SkExecutor> fExecutor;  // for --CPUbenchTiledRaster
 
     const bool fDoLooping;
 
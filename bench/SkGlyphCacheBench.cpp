@@ -10,6 +10,7 @@
 #include "bench/Benchmark.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColorSpace.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkGraphics.h"
 #include "include/core/SkTypeface.h"
 #include "include/private/chromium/SkChromeRemoteGlyphCache.h"
@@ -113,10 +114,60 @@ private:
     SkString fName;
 };
 
+// Every thread looks up the same warm strikes, so the time spent is all strike and glyph lookups.
+// Each thread does a full loop of work, so with perfect scaling the time per loop stays flat as
+// threads are added.
+class SkGlyphCacheMultiThreaded : public Benchmark {
+public:
+    explicit SkGlyphCacheMultiThreaded(int threads) : fThreads(threads) { }
+
+protected:
+    const char* onGetName() override {
+        fName.printf("SkGlyphCacheMultiThreaded_%dthreads", fThreads);
+        return fName.c_str();
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+        fTypeface = ToolUtils::create_portable_typeface("serif", SkFontStyle::Italic());
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        size_t oldCacheLimitSize = SkGraphics::GetFontCacheLimit();
+        SkGraphics::SetFontCacheLimit(32 * 1024 * 1024);
+
+        SkTaskGroup(*fExecutor).batch(fThreads, [&](int) {
+            SkFont font;
+            font.setEdging(SkFont::Edging::kAntiAlias);
+            font.setSubpixel(true);
+            font.setTypeface(fTypeface);
+            for (int work = 0; work < loops; work++) {
+                do_font_stuff(&font);
+            }
+        });
+        SkGraphics::SetFontCacheLimit(oldCacheLimitSize);
+    }
+
+private:
+    using INHERITED = Benchmark;
+    const int fThreads;
+    SkString fName;
+    std::unique_ptr<SkExecutor> fExecutor;
+    sk_sp<SkTypeface> fTypeface;
+};
+
 DEF_BENCH( return new SkGlyphCacheBasic(256 * 1024); )
 DEF_BENCH( return new SkGlyphCacheBasic(32 * 1024 * 1024); )
 DEF_BENCH( return new SkGlyphCacheStressTest(256 * 1024); )
 DEF_BENCH( return new SkGlyphCacheStressTest(32 * 1024 * 1024); )
+DEF_BENCH( return new SkGlyphCacheMultiThreaded(1); )
+DEF_BENCH( return new SkGlyphCacheMultiThreaded(2); )
+DEF_BENCH( return new SkGlyphCacheMultiThreaded(4); )
+DEF_BENCH( return new SkGlyphCacheMultiThreaded(8); )
 
 namespace {
 class DiscardableManager : public SkStrikeServer::DiscardableHandleManager,
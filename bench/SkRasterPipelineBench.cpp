@@ -0,0 +1,153 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkString.h"
+#include "src/core/SkArenaAlloc.h"
+#include "src/core/SkRasterPipeline.h"
+
+// Runs a few representative pipelines over one row of pixels with the stages SkOpts::Init()
+// picked for this CPU.  kWidth is deliberately not a multiple of 16 or 8, so tail handling is
+// measured too.
+class SkRasterPipelineBench : public Benchmark {
+public:
+    enum class Case {
+        kSrcOver_8888,    // lowp
+        kSrcOver_F16,     // highp
+        kColorBurn_8888,  // highp
+        kGradient,        // highp
+        kBilerp_8888,     // lowp
+    };
+
+    explicit SkRasterPipelineBench(Case c) : fCase(c) {
+        static const char* kNames[] = {
+            "srcover_8888", "srcover_f16", "colorburn_8888", "gradient", "bilerp_8888",
+        };
+        fName.printf("SkRasterPipeline_%s", kNames[(int)c]);
+    }
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        for (int i = 0; i < kWidth; i++) {
+            fSrc8888[i] = 0x7f3f1f0f + i;
+            fDst8888[i] = 0xff000000 | (i * 0x010203);
+            fSrcF16[i]  = 0x3800380038003800;  // 0.5 in each channel
+            fDstF16[i]  = 0x3c00300034003800;
+        }
+        for (int i = 0; i < kImageSize*kImageSize; i++) {
+            fImage[i] = 0xff000000 | (i * 0x030507);
+        }
+
+        SkRasterPipeline p(&fAlloc);
+        switch (fCase) {
+            case Case::kSrcOver_8888:
+                p.append(SkRasterPipeline::load_8888,     &fSrc8888Ctx);
+                p.append(SkRasterPipeline::load_8888_dst, &fDst8888Ctx);
+                p.append(SkRasterPipeline::srcover);
+                p.append(SkRasterPipeline::store_8888,    &fDst8888Ctx);
+                break;
+
+            case Case::kSrcOver_F16:
+                p.append(SkRasterPipeline::load_f16,     &fSrcF16Ctx);
+                p.append(SkRasterPipeline::load_f16_dst, &fDstF16Ctx);
+                p.append(SkRasterPipeline::srcover);
+                p.append(SkRasterPipeline::store_f16,    &fDstF16Ctx);
+                break;
+
+            case Case::kColorBurn_8888:
+                p.append(SkRasterPipeline::load_8888,     &fSrc8888Ctx);
+                p.append(SkRasterPipeline::load_8888_dst, &fDst8888Ctx);
+                p.append(SkRasterPipeline::colorburn);
+                p.append(SkRasterPipeline::store_8888,    &fDst8888Ctx);
+                break;
+
+            case Case::kGradient: {
+                // An 8 stop gradient across the row, looked up with permutes on HSW.
+                fGradientCtx.stopCount = kStops;
+                fGradientCtx.interpolatedInPremul = false;
+                for (int c = 0; c < 4; c++) {
+                    fGradientCtx.fs[c] = fGradientF[c];
+                    fGradientCtx.bs[c] = fGradientB[c];
+                    for (int i = 0; i < kStops; i++) {
+                        fGradientF[c][i] = 0.125f * (c + 1);
+                        fGradientB[c][i] = 0.0625f * i;
+                    }
+                }
+                for (int i = 0; i < kStops; i++) {
+                    fGradientT[i] = i / (float)kStops;
+                }
+                fGradientCtx.ts = fGradientT;
+
+                p.append(SkRasterPipeline::seed_shader);
+                p.append(SkRasterPipeline::matrix_scale_translate, fGradientMatrix);
+                p.append(SkRasterPipeline::gradient, &fGradientCtx);
+                p.append(SkRasterPipeline::store_8888, &fDst8888Ctx);
+                break;
+            }
+
+            case Case::kBilerp_8888:
+                p.append(SkRasterPipeline::seed_shader);
+                p.append(SkRasterPipeline::matrix_scale_translate, fBilerpMatrix);
+                p.append(SkRasterPipeline::bilerp_clamp_8888, &fImageCtx);
+                p.append(SkRasterPipeline::store_8888, &fDst8888Ctx);
+                break;
+        }
+
+        fProgram = p.compile();
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; i++) {
+            fProgram(0,0, kWidth,1);
+        }
+    }
+
+private:
+    static constexpr int kWidth     = 1003;
+    static constexpr int kImageSize = 64;
+    static constexpr int kStops     = 8;
+
+    const Case fCase;
+    SkString   fName;
+
+    SkSTArenaAlloc<1024> fAlloc;
+    std::function<void(size_t, size_t, size_t, size_t)> fProgram;
+
+    uint32_t fSrc8888[kWidth],
+             fDst8888[kWidth];
+    uint64_t fSrcF16[kWidth],
+             fDstF16[kWidth];
+    uint32_t fImage[kImageSize*kImageSize];
+
+    SkRasterPipeline_MemoryCtx fSrc8888Ctx = {fSrc8888, 0},
+                               fDst8888Ctx = {fDst8888, 0},
+                               fSrcF16Ctx  = {fSrcF16,  0},
+                               fDstF16Ctx  = {fDstF16,  0};
+    SkRasterPipeline_GatherCtx fImageCtx   = {fImage, kImageSize, kImageSize, kImageSize, {}};
+
+    // Padded to 8 floats, as SkGradientShaderBase does, for the HSW permutes.
+    float fGradientF[4][8],
+          fGradientB[4][8],
+          fGradientT[kStops];
+    SkRasterPipeline_GradientCtx fGradientCtx;
+
+    // Map the row onto [0,1] for the gradient, and scale it down a little for bilerp.
+    float fGradientMatrix[4] = {1.0f / kWidth, 1, 0, 0},
+          fBilerpMatrix  [4] = {0.06f, 1, 0.25f, 7.5f};
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new SkRasterPipelineBench(SkRasterPipelineBench::Case::kSrcOver_8888);)
+DEF_BENCH(return new SkRasterPipelineBench(SkRasterPipelineBench::Case::kSrcOver_F16);)
+DEF_BENCH(return new SkRasterPipelineBench(SkRasterPipelineBench::Case::kColorBurn_8888);)
+DEF_BENCH(return new SkRasterPipelineBench(SkRasterPipelineBench::Case::kGradient);)
+DEF_BENCH(return new SkRasterPipelineBench(SkRasterPipelineBench::Case::kBilerp_8888);)
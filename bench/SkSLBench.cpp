@@ -8,9 +8,12 @@
 #include "bench/ResultsWriter.h"
 #include "bench/SkSLBench.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/effects/SkRuntimeEffect.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrRecordingContextPriv.h"
 #include "src/gpu/ganesh/mock/GrMockCaps.h"
+#include "src/sksl/SkSLCompileService.h"
 #include "src/sksl/SkSLCompiler.h"
 #include "src/sksl/SkSLDSLParser.h"
 #include "src/sksl/codegen/SkSLVMCodeGenerator.h"
@@ -455,6 +458,157 @@ void main()
 
 COMPILER_BENCH(tiny, "void main() { sk_FragColor = half4(1); }");
 
+#if defined(SK_ENABLE_SKSL)
+
+// Compiles a batch of programs to GLSL, as when many effects are compiled up front. The parallel
+// variant spreads the batch over a thread pool with an SkSL::CompileService. The serial variant
+// compiles the same batch on a single compiler, for comparison.
+class SkSLBatchCompileBench : public Benchmark {
+public:
+    SkSLBatchCompileBench(bool parallel)
+        : fName(parallel ? "sksl_batch_compile_parallel" : "sksl_batch_compile_serial")
+        , fParallel(parallel)
+        , fCaps(GrContextOptions(), GrMockOptions()) {}
+
+protected:
+    const char* onGetName() override {
+        return fName;
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        if (fParallel) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool();
+            fService = std::make_unique<SkSL::CompileService>(fCaps.shaderCaps(),
+                                                              fExecutor.get());
+        } else {
+            fCompiler = std::make_unique<SkSL::Compiler>(fCaps.shaderCaps());
+        }
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; i++) {
+            if (fParallel) {
+                fService->forEach(kBatchSize, [](SkSL::Compiler& compiler, int index) {
+                    CompileToGLSL(&compiler, index);
+                });
+            } else {
+                for (int index = 0; index < kBatchSize; index++) {
+                    CompileToGLSL(fCompiler.get(), index);
+                }
+            }
+        }
+    }
+
+private:
+    static void CompileToGLSL(SkSL::Compiler* compiler, int index) {
+        const char* src = (index % 4 == 3) ? tiny_SRC : large_SRC;
+        SkSL::Program::Settings settings;
+        std::unique_ptr<SkSL::Program> program =
+                compiler->convertProgram(SkSL::ProgramKind::kFragment, src, settings);
+        if (!program) {
+            SK_ABORT("shader compilation failed: %s\n", compiler->errorText().c_str());
+        }
+        std::string result;
+        SkAssertResult(compiler->toGLSL(*program, &result));
+    }
+
+    static constexpr int kBatchSize = 64;
+
+    const char* fName;
+    const bool fParallel;
+    GrMockCaps fCaps;
+    std::unique_ptr<SkExecutor> fExecutor;
+    std::unique_ptr<SkSL::CompileService> fService;
+    std::unique_ptr<SkSL::Compiler> fCompiler;
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new SkSLBatchCompileBench(/*parallel=*/false);)
+DEF_BENCH(return new SkSLBatchCompileBench(/*parallel=*/true);)
+
+// Creates a runtime effect, either by compiling its SkSL (a cold start) or from the program that
+// an earlier run of the same effect compiled and persisted with compiledProgram() (a warm start).
+class SkRuntimeEffectCreateBench : public Benchmark {
+public:
+    SkRuntimeEffectCreateBench(bool fromCompiledProgram)
+        : fName(fromCompiledProgram ? "sksl_runtime_effect_create_warm"
+                                    : "sksl_runtime_effect_create_cold")
+        , fFromCompiledProgram(fromCompiledProgram) {}
+
+protected:
+    const char* onGetName() override {
+        return fName;
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        auto [effect, err] = SkRuntimeEffect::MakeForShader(SkString(kSource));
+        if (!effect) {
+            SK_ABORT("runtime effect compilation failed: %s\n", err.c_str());
+        }
+        fCompiled = effect->compiledProgram();
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; i++) {
+            SkRuntimeEffect::Result result =
+                    fFromCompiledProgram
+                            ? SkRuntimeEffect::MakeForShaderFromCompiledProgram(
+                                      SkString(kSource), *fCompiled)
+                            : SkRuntimeEffect::MakeForShader(SkString(kSource));
+            SkAssertResult(result.effect);
+        }
+    }
+
+private:
+    static constexpr char kSource[] = R"(
+        uniform shader image;
+        uniform float2 center;
+        uniform float radius;
+        uniform half4 colors[4];
+
+        half luma(half3 c) { return dot(c, half3(0.2126, 0.7152, 0.0722)); }
+
+        half4 ramp(half t) {
+            t = saturate(t) * 3;
+            half4 c = colors[0];
+            for (int i = 0; i < 3; i++) {
+                c = mix(c, colors[i + 1], saturate(t - half(i)));
+            }
+            return c;
+        }
+
+        half4 main(float2 xy) {
+            float2 d = xy - center;
+            float r = length(d) / radius;
+            half4 c = image.eval(center + d * (1 + 0.25 * sin(r * 6.2831)));
+            for (int i = 0; i < 4; i++) {
+                c.rgb = mix(c.rgb, ramp(luma(c.rgb)).rgb, 0.25);
+            }
+            return half4(c.rgb * c.a, c.a);
+        }
+    )";
+
+    const char* fName;
+    const bool fFromCompiledProgram;
+    sk_sp<SkData> fCompiled;
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new SkRuntimeEffectCreateBench(/*fromCompiledProgram=*/false);)
+DEF_BENCH(return new SkRuntimeEffectCreateBench(/*fromCompiledProgram=*/true);)
+
+#endif
+
 #if defined(SK_BUILD_FOR_UNIX)
 
 #include <malloc.h>
@@ -471,11 +625,14 @@ void RunSkSLMemoryBenchmarks(NanoJSONResultsWriter* log) {
         log->endObject();                // test
     };
 
+    // Built-in modules are normally shared by every compiler with compatible caps, and never freed,
+    // so they are already loaded by now. Each of these compilers loads its own copy instead.
+
     // Heap used by a default compiler (with no modules loaded)
     {
         int before = heap_bytes_used();
         GrShaderCaps caps;
-        SkSL::Compiler compiler(&caps);
+        auto compiler = SkSL::Compiler::MakeWithUnsharedModules(&caps);
         int after = heap_bytes_used();
         bench("sksl_compiler_baseline", after - before);
     }
@@ -484,9 +641,9 @@ void RunSkSLMemoryBenchmarks(NanoJSONResultsWriter* log) {
     {
         int before = heap_bytes_used();
         GrShaderCaps caps;
-        SkSL::Compiler compiler(&caps);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kVertex);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kFragment);
+        auto compiler = SkSL::Compiler::MakeWithUnsharedModules(&caps);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kVertex);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kFragment);
         int after = heap_bytes_used();
         bench("sksl_compiler_gpu", after - before);
     }
@@ -495,9 +652,9 @@ void RunSkSLMemoryBenchmarks(NanoJSONResultsWriter* log) {
     {
         int before = heap_bytes_used();
         GrShaderCaps caps;
-        SkSL::Compiler compiler(&caps);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kGraphiteVertex);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kGraphiteFragment);
+        auto compiler = SkSL::Compiler::MakeWithUnsharedModules(&caps);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kGraphiteVertex);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kGraphiteFragment);
         int after = heap_bytes_used();
         bench("sksl_compiler_graphite", after - before);
     }
@@ -506,10 +663,10 @@ void RunSkSLMemoryBenchmarks(NanoJSONResultsWriter* log) {
     {
         int before = heap_bytes_used();
         GrShaderCaps caps;
-        SkSL::Compiler compiler(&caps);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kRuntimeColorFilter);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kRuntimeShader);
-        compiler.moduleForProgramKind(SkSL::ProgramKind::kRuntimeBlender);
+        auto compiler = SkSL::Compiler::MakeWithUnsharedModules(&caps);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kRuntimeColorFilter);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kRuntimeShader);
+        compiler->moduleForProgramKind(SkSL::ProgramKind::kRuntimeBlender);
         int after = heap_bytes_used();
         bench("sksl_compiler_runtimeeffect", after - before);
     }
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "src/core/SkVM.h"
+
+// Measures what SkVMBlitter pays per eval() call for work that only depends on its uniforms, by
+// blitting the same rows in runs of different lengths (anti-aliased edges often produce 1-pixel
+// runs).  With Builder::precompute() that work is done once up front; without it, it's hoisted
+// out of each call's loop, but still runs once per call.
+class SkVMPrecomputeBench : public Benchmark {
+public:
+    SkVMPrecomputeBench(bool precompute, int run) : fPrecompute(precompute), fRun(run) {
+        fName.printf("skvm_precompute_%s_run%d", precompute ? "on" : "off", run);
+    }
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        skvm::Builder b;
+        this->build(&b);
+        fProgram = b.done();
+
+        // right, y, angle, gamma, then two colors.
+        fUniforms = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        const float values[] = {0.5f, 2.2f, 0.9f, 0.1f, 0.1f, 1.0f, 0.2f, 0.6f, 0.8f, 1.0f};
+        memcpy(fUniforms.data() + 2, values, sizeof(values));
+        fUniforms.resize(fUniforms.size() + fProgram.precomputedBytes() / sizeof(int));
+        fProgram.precompute(fUniforms.data());
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; i++) {
+            for (int y = 0; y < kRows; y++) {
+                for (int x = 0; x < kWidth; x += fRun) {
+                    fUniforms[0] = x + fRun;
+                    fUniforms[1] = y;
+                    fProgram.eval(fRun, fUniforms.data(), fDst + x);
+                }
+            }
+        }
+    }
+
+private:
+    // Roughly what SkVMBlitter builds for a runtime shader that draws a rotated gradient between
+    // two colors, which it decodes from a gamma-encoded uniform.
+    void build(skvm::Builder* p) const {
+        skvm::UPtr uniforms = p->uniform();
+        skvm::Ptr dst = p->varying<uint32_t>();
+
+        const skvm::F32 x = p->to_F32(p->uniform32(uniforms, 0) - p->index()),
+                        y = p->to_F32(p->uniform32(uniforms, 4));
+        const skvm::F32 angle = p->uniformF(uniforms,  8),
+                        gamma = p->uniformF(uniforms, 12);
+        skvm::F32 t = x * p->approx_cos(angle) + y * p->approx_sin(angle);
+        t = p->clamp01(t * (1.0f / kWidth));
+
+        auto color = [&](int offset) -> skvm::Color {
+            return {p->approx_powf(p->uniformF(uniforms, offset +  0), gamma),
+                    p->approx_powf(p->uniformF(uniforms, offset +  4), gamma),
+                    p->approx_powf(p->uniformF(uniforms, offset +  8), gamma),
+                    p->uniformF(uniforms, offset + 12)};
+        };
+        const skvm::Color lo = color(16),
+                          hi = color(32);
+        const skvm::Color c = {p->lerp(lo.r, hi.r, t), p->lerp(lo.g, hi.g, t),
+                               p->lerp(lo.b, hi.b, t), p->lerp(lo.a, hi.a, t)};
+        p->store(skvm::SkColorType_to_PixelFormat(kN32_SkColorType), dst, c);
+
+        if (fPrecompute) {
+            p->precompute(uniforms, 8, 48);
+        }
+    }
+
+    static constexpr int kWidth = 256,
+                         kRows  = 16;
+
+    const bool       fPrecompute;
+    const int        fRun;
+    SkString         fName;
+    skvm::Program    fProgram;
+    std::vector<int> fUniforms;
+    uint32_t         fDst[kWidth];
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new SkVMPrecomputeBench(false,   1);)
+DEF_BENCH(return new SkVMPrecomputeBench(true,    1);)
+DEF_BENCH(return new SkVMPrecomputeBench(false,  16);)
+DEF_BENCH(return new SkVMPrecomputeBench(true,   16);)
+DEF_BENCH(return new SkVMPrecomputeBench(false, 256);)
+DEF_BENCH(return new SkVMPrecomputeBench(true,  256);)
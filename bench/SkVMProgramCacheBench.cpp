@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkStream.h"
+#include "src/core/SkVM.h"
+#include "src/core/SkVMProgramCache.h"
+
+// Measures how long it takes to get from an skvm::Builder to a runnable Program, i.e. the cost a
+// blitter pays on the first draw with a new paint, and the first pixels drawn with that program.
+//   cold:  optimize and JIT the program, as every new process does today.
+//   warm:  reload it from an SkVMProgramCache that was read back from a stream.
+class SkVMProgramCacheBench : public Benchmark {
+public:
+    SkVMProgramCacheBench(SkBlendMode mode, bool warm) : fMode(mode), fWarm(warm) {
+        fName.printf("skvm_first_draw_%s_%s", SkBlendMode_Name(mode), warm ? "warm" : "cold");
+    }
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        this->build(&fBuilder);
+        if (fWarm) {
+            // Round trip through a stream, as if an earlier process had written the cache.
+            SkVMProgramCache writer;
+            writer.findOrBuild(fBuilder);
+            SkDynamicMemoryWStream stream;
+            SkAssertResult(writer.writeTo(&stream));
+
+            std::unique_ptr<SkStreamAsset> in = stream.detachAsStream();
+            SkAssertResult(fCache.readFrom(in.get()));
+        }
+        for (int i = 0; i < kPixels; i++) {
+            fDst[i] = 0xff000000 | (i * 0x010203);
+        }
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        const float color[] = {0.25f, 0.5f, 0.75f, 0.5f};
+        for (int i = 0; i < loops; i++) {
+            skvm::Program program = fWarm ? fCache.findOrBuild(fBuilder)
+                                          : fBuilder.done();
+            program.eval(kPixels, fDst, color);
+        }
+    }
+
+private:
+    // Roughly what SkVMBlitter builds for a solid color paint drawn onto an N32 surface.
+    void build(skvm::Builder* p) const {
+        skvm::Ptr dst = p->varying<uint32_t>();
+        skvm::UPtr uniforms = p->uniform();
+
+        const skvm::PixelFormat fmt = skvm::SkColorType_to_PixelFormat(kN32_SkColorType);
+        skvm::Color src = {p->uniformF(uniforms, 0), p->uniformF(uniforms, 4),
+                           p->uniformF(uniforms, 8), p->uniformF(uniforms, 12)};
+        src = p->premul(src);
+        p->store(fmt, dst, p->blend(fMode, src, p->load(fmt, dst)));
+    }
+
+    static constexpr int kPixels = 256;
+
+    const SkBlendMode fMode;
+    const bool        fWarm;
+    SkString          fName;
+    skvm::Builder     fBuilder;
+    SkVMProgramCache  fCache;
+    uint32_t          fDst[kPixels];
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new SkVMProgramCacheBench(SkBlendMode::kSrcOver,   false);)
+DEF_BENCH(return new SkVMProgramCacheBench(SkBlendMode::kSrcOver,   true);)
+DEF_BENCH(return new SkVMProgramCacheBench(SkBlendMode::kColorBurn, false);)
+DEF_BENCH(return new SkVMProgramCacheBench(SkBlendMode::kColorBurn, true);)
+DEF_BENCH(return new SkVMProgramCacheBench(SkBlendMode::kLuminosity, false);)
+DEF_BENCH(return new SkVMProgramCacheBench(SkBlendMode::kLuminosity, true);)
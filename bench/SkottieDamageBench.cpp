@@ -0,0 +1,112 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+#include "modules/skottie/include/Skottie.h"
+#include "modules/skottie/utils/SkottieUtils.h"
+#include "tools/Resources.h"
+
+// Renders every frame of an animation into a raster surface, either redrawing the whole frame or
+// only the area damaged since the previous frame (skottie_utils::IncrementalRenderer). Reports the
+// average number of pixels touched per frame.
+class SkottieDamageBench final : public Benchmark {
+public:
+    SkottieDamageBench(const char* name, const char* source, bool incremental)
+        : fName(SkStringPrintf("skottie_%s_%s", incremental ? "damage" : "full", name))
+        , fSource(source)
+        , fIncremental(incremental) {}
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        auto data = GetResourceAsData(fSource);
+        if (!data) {
+            return;
+        }
+        auto anim = skottie::Animation::Make(static_cast<const char*>(data->data()),
+                                             data->size());
+        if (!anim) {
+            return;
+        }
+
+        const auto size = anim->size().toCeil();
+        if (fIncremental) {
+            fRenderer = skottie_utils::IncrementalRenderer::Make(anim, size);
+        } else {
+            fSurface = SkSurface::MakeRasterN32Premul(size.width(), size.height());
+        }
+        if (fRenderer || fSurface) {
+            fAnimation = std::move(anim);
+        }
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        if (!fAnimation) {
+            return;
+        }
+
+        const auto frames = static_cast<int>(fAnimation->outPoint() - fAnimation->inPoint());
+        while (loops-- > 0) {
+            for (int frame = 0; frame < frames; ++frame) {
+                fPixels += fIncremental ? this->renderIncremental(frame)
+                                        : this->renderFull(frame);
+                fFrames += 1;
+            }
+        }
+    }
+
+    void onPerCanvasPostDraw(SkCanvas*) override {
+        if (fFrames) {
+            SkDebugf("%s: %.0f pixels touched per frame\n", fName.c_str(),
+                     static_cast<double>(fPixels) / fFrames);
+        }
+    }
+
+private:
+    int64_t renderFull(int frame) {
+        fAnimation->seekFrame(frame);
+
+        auto* canvas = fSurface->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+        fAnimation->render(canvas);
+
+        return int64_t(fSurface->width()) * fSurface->height();
+    }
+
+    int64_t renderIncremental(int frame) {
+        int64_t pixels = 0;
+        for (SkRegion::Iterator it(fRenderer->renderFrame(frame)); !it.done(); it.next()) {
+            pixels += int64_t(it.rect().width()) * it.rect().height();
+        }
+
+        return pixels;
+    }
+
+    const SkString                                      fName;
+    const char*                                         fSource;
+    const bool                                          fIncremental;
+    sk_sp<skottie::Animation>                           fAnimation;
+    sk_sp<SkSurface>                                    fSurface;
+    std::unique_ptr<skottie_utils::IncrementalRenderer> fRenderer;
+    int64_t                                             fPixels = 0,
+                                                        fFrames = 0;
+};
+
+#define SKOTTIE_DAMAGE_BENCH(name, source)                                 \
+    DEF_BENCH(return new SkottieDamageBench(name, source, false);)         \
+    DEF_BENCH(return new SkottieDamageBench(name, source, true);)
+
+SKOTTIE_DAMAGE_BENCH("phonehub_connecting", "skottie/skottie-phonehub-connecting.json")
+SKOTTIE_DAMAGE_BENCH("phonehub_onboard",    "skottie/skottie-phonehub-onboard.json")
+SKOTTIE_DAMAGE_BENCH("text_animator",       "skottie/skottie-text-animator-1.json")
+
+#undef SKOTTIE_DAMAGE_BENCH
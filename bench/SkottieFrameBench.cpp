@@ -0,0 +1,91 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkSurface.h"
+#include "modules/skottie/include/Skottie.h"
+#include "src/core/SkTaskGroup.h"
+#include "tools/Resources.h"
+
+#include <vector>
+
+// Renders every frame of an animation the way a video export would, with the frames spread over
+// a number of threads. Each thread seeks and draws its own instance of the animation.
+class SkottieFrameBench final : public Benchmark {
+public:
+    SkottieFrameBench(const char* name, const char* source, int threads)
+        : fName(SkStringPrintf("skottie_frames_%s_%dthreads", name, threads))
+        , fSource(source)
+        , fThreads(threads) {}
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        auto data = GetResourceAsData(fSource);
+        if (!data) {
+            return;
+        }
+        auto anim = skottie::Animation::Builder(skottie::Animation::Builder::kAllowInstancing)
+                        .make(static_cast<const char*>(data->data()), data->size());
+        if (!anim) {
+            return;
+        }
+
+        const auto info = SkImageInfo::MakeN32Premul(anim->size().toCeil());
+        for (int i = 0; i < fThreads; ++i) {
+            fInstances.push_back(i == 0 ? anim : anim->makeInstance());
+            fSurfaces.push_back(SkSurface::MakeRaster(info));
+        }
+        fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        if (fInstances.empty()) {
+            return;
+        }
+
+        const auto frames = static_cast<int>(fInstances[0]->outPoint() -
+                                             fInstances[0]->inPoint());
+        SkTaskGroup tg(*fExecutor);
+        while (loops-- > 0) {
+            for (int i = 0; i < fThreads; ++i) {
+                tg.add([this, i, frames] {
+                    for (int frame = i; frame < frames; frame += fThreads) {
+                        fInstances[i]->seekFrame(frame);
+                        fInstances[i]->render(fSurfaces[i]->getCanvas());
+                    }
+                });
+            }
+            tg.wait();
+        }
+    }
+
+private:
+    const SkString                         fName;
+    const char*                            fSource;
+    const int                              fThreads;
+    std::vector<sk_sp<skottie::Animation>> fInstances;
+    std::vector<sk_sp<SkSurface>>          fSurfaces;
+    std::unique_ptr<SkExecutor>            fExecutor;
+};
+
+#define SKOTTIE_FRAME_BENCH(name, source)                                   \
+    DEF_BENCH(return new SkottieFrameBench(name, source, 1);)               \
+    DEF_BENCH(return new SkottieFrameBench(name, source, 2);)               \
+    DEF_BENCH(return new SkottieFrameBench(name, source, 4);)               \
+    DEF_BENCH(return new SkottieFrameBench(name, source, 8);)
+
+SKOTTIE_FRAME_BENCH("phonehub_connecting", "skottie/skottie-phonehub-connecting.json")
+SKOTTIE_FRAME_BENCH("sphere_effect",       "skottie/skottie-sphere-effect.json")
+SKOTTIE_FRAME_BENCH("text_scale_to_fit",   "skottie/skottie-text-scale-to-fit-minmax.json")
+
+#undef SKOTTIE_FRAME_BENCH
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkString.h"
+#include "modules/skottie/include/Skottie.h"
+#include "tools/Resources.h"
+
+// Seeks through every frame of an animation, without rendering: this is dominated by keyframe
+// evaluation (including the easing of cubic keyframes) and scene graph revalidation.
+class SkottieSeekBench final : public Benchmark {
+public:
+    SkottieSeekBench(const char* name, const char* source)
+        : fName(SkStringPrintf("skottie_seek_%s", name))
+        , fSource(source) {}
+
+    // Synthetic animation with many eased transform properties.
+    explicit SkottieSeekBench(int layers)
+        : fName(SkStringPrintf("skottie_seek_eased_%dlayers", layers))
+        , fLayers(layers) {}
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        if (fSource) {
+            auto data = GetResourceAsData(fSource);
+            if (data) {
+                fAnimation = skottie::Animation::Make(static_cast<const char*>(data->data()),
+                                                      data->size());
+            }
+            return;
+        }
+
+        const auto json = MakeEasedLayers(fLayers);
+        fAnimation = skottie::Animation::Make(json.c_str(), json.size());
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        if (!fAnimation) {
+            return;
+        }
+
+        const auto frames = static_cast<int>(fAnimation->outPoint() - fAnimation->inPoint());
+        while (loops-- > 0) {
+            for (int frame = 0; frame < frames; ++frame) {
+                fAnimation->seekFrame(frame);
+            }
+        }
+    }
+
+private:
+    static SkString MakeEasedLayers(int count) {
+        static constexpr char kEase[] = R"("o": { "x": [0.42], "y": [0] },
+                                           "i": { "x": [0.58], "y": [1] })";
+
+        SkString json(R"({ "v": "5.7.0", "fr": 60, "ip": 0, "op": 120, "w": 500, "h": 500,
+                           "layers": [)");
+        for (int i = 0; i < count; ++i) {
+            const auto x = (i * 37) % 500,
+                       y = (i * 91) % 500,
+                       t = (i * 7) % 60;
+            json.appendf(R"(%s{ "ty": 1, "ip": 0, "op": 120, "sw": 10, "sh": 10, "sc": "#4285f4",
+                                "ks": {
+                                  "o": { "a": 1, "k": [ { "t": %d, "s": [0], %s },
+                                                        { "t": %d, "s": [100] } ] },
+                                  "r": { "a": 1, "k": [ { "t": %d, "s": [0], %s },
+                                                        { "t": %d, "s": [360] } ] },
+                                  "s": { "a": 1, "k": [ { "t": %d, "s": [100, 100], %s },
+                                                        { "t": %d, "s": [50, 150] } ] },
+                                  "p": { "a": 1, "k": [ { "t": %d, "s": [%d, %d], %s },
+                                                        { "t": %d, "s": [%d, %d] } ] }
+                                } })",
+                         i ? "," : "",
+                         t, kEase, t + 60,
+                         t, kEase, t + 60,
+                         t, kEase, t + 60,
+                         t, x, y, kEase, t + 60, y, x);
+        }
+        json.append("] }");
+
+        return json;
+    }
+
+    const SkString            fName;
+    const char*               fSource = nullptr;
+    const int                 fLayers = 0;
+    sk_sp<skottie::Animation> fAnimation;
+};
+
+DEF_BENCH(return new SkottieSeekBench("phonehub_onboard", "skottie/skottie-phonehub-onboard.json");)
+DEF_BENCH(return new SkottieSeekBench("text_animator", "skottie/skottie-text-animator-1.json");)
+DEF_BENCH(return new SkottieSeekBench(1000);)
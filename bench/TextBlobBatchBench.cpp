@@ -0,0 +1,85 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/Benchmark.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkFont.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkShader.h"
+#include "include/core/SkTextBlob.h"
+#include "include/gpu/GrDirectContext.h"
+#include "src/core/SkCanvasPriv.h"
+#include "src/gpu/ganesh/ops/OpsTask.h"
+#include "src/gpu/ganesh/v1/SurfaceDrawContext_v1.h"
+#include "tools/ToolUtils.h"
+
+#include <vector>
+
+// Records and flushes a frame of many small, distinct text blobs, e.g. the labels of a chart. With
+// plain colors, each blob's glyphs are appended to the previous AtlasTextOp as they're recorded.
+// A color shader gives the same ops in the end, but each blob goes through processor analysis and
+// the OpsTask's search for an op to merge with. The flush includes filling the vertex buffer.
+class TextBlobBatchBench : public Benchmark {
+public:
+    TextBlobBatchBench(bool useShader) : fUseShader(useShader) {
+        fName.printf("text_blob_batch_%s", useShader ? "shader" : "color");
+    }
+
+    bool isSuitableFor(Backend backend) override { return backend == kGPU_Backend; }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        SkFont font(ToolUtils::create_portable_typeface("sans-serif", SkFontStyle()), 10);
+        for (int i = 0; i < kBlobs; i++) {
+            SkString label;
+            label.printf("%d.%d%%", i, (i * 7) % 10);
+            fBlobs.push_back(SkTextBlob::MakeFromString(label.c_str(), font));
+        }
+    }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        auto dContext = GrAsDirectContext(canvas->recordingContext());
+        auto sdc = SkCanvasPriv::TopDeviceSurfaceDrawContext(canvas);
+        if (!dContext || !sdc) {
+            return;
+        }
+
+        SkPaint paint;
+        for (int loop = 0; loop < loops; loop++) {
+            for (int i = 0; i < kBlobs; i++) {
+                const SkColor color = i & 1 ? SK_ColorBLACK : SK_ColorDKGRAY;
+                if (fUseShader) {
+                    paint.setShader(SkShaders::Color(color));
+                } else {
+                    paint.setColor(color);
+                }
+                canvas->drawTextBlob(fBlobs[i], (i % 16) * 40, 12 + (i / 16) * 12, paint);
+            }
+            fNumOps = sdc->testingOnly_PeekLastOpsTask()->numOpChains();
+            dContext->flushAndSubmit();
+        }
+    }
+
+    void onPerCanvasPostDraw(SkCanvas*) override {
+        SkDEBUGF("%s: %d op chains for %d blobs\n", fName.c_str(), fNumOps, kBlobs);
+    }
+
+private:
+    static constexpr int kBlobs = 512;
+
+    const bool fUseShader;
+    SkString fName;
+    std::vector<sk_sp<SkTextBlob>> fBlobs;
+    int fNumOps = 0;
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH(return new TextBlobBatchBench(false);)
+DEF_BENCH(return new TextBlobBatchBench(true);)
@@ -6,6 +6,7 @@
  */
 
 #include "bench/Benchmark.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkPath.h"
 #include "src/core/SkArenaAlloc.h"
 #include "src/gpu/ganesh/GrEagerVertexAllocator.h"
@@ -106,6 +107,57 @@ public:
 
 DEF_BENCH( return new PathToTrianglesBench(); );
 
+// All the tiger paths as one, which PathToTrianglesParallel() splits into groups of disjoint
+// contours.
+class CombinedPathToTrianglesBench : public TriangulatorBenchmark {
+public:
+    CombinedPathToTrianglesBench() : TriangulatorBenchmark("CombinedPathToTriangles") {}
+
+    void onDelayedSetup() override {
+        TriangulatorBenchmark::onDelayedSetup();
+        for (const SkPath& path : fPaths) {
+            fCombinedPath.addPath(path);
+        }
+    }
+
+    void doLoop() override {
+        bool isLinear;
+        GrTriangulator::PathToTriangles(fCombinedPath, kTigerTolerance, SkRect::MakeEmpty(), this,
+                                        &isLinear);
+    }
+
+    SkPath fCombinedPath;
+};
+
+DEF_BENCH( return new CombinedPathToTrianglesBench(); );
+
+class CombinedPathToTrianglesParallelBench : public TriangulatorBenchmark {
+public:
+    CombinedPathToTrianglesParallelBench()
+            : TriangulatorBenchmark("CombinedPathToTrianglesParallel") {}
+
+    void onDelayedSetup() override {
+        TriangulatorBenchmark::onDelayedSetup();
+        for (const SkPath& path : fPaths) {
+            fCombinedPath.addPath(path);
+        }
+        fExecutor = SkExecutor::MakeFIFOThreadPool();
+    }
+
+    void doLoop() override {
+        bool isLinear;
+        GrTriangulator::PathToTrianglesParallel(fCombinedPath, kTigerTolerance,
+                                                SkRect::MakeEmpty(), this, &isLinear,
+                                                fExecutor.get(), &fArenas);
+    }
+
+    SkPath fCombinedPath;
+    std::unique_ptr<SkExecutor> fExecutor;
+    GrTriangulatorArenas fArenas;
+};
+
+DEF_BENCH( return new CombinedPathToTrianglesParallelBench(); );
+
 class TriangulateInnerFanBench : public TriangulatorBenchmark {
 public:
     TriangulateInnerFanBench() : TriangulatorBenchmark("TriangulateInnerFan") {}
@@ -155,9 +155,10 @@ DEF_BENCH(return new VertBench(kColors_VertFlag | kTexture_VertFlag | kBilerp_Ve
 #include "tools/Resources.h"
 
 enum AtlasFlags {
-    kColors_Flag = 1 << 0,
-    kRotate_Flag = 1 << 1,
-    kPersp_Flag  = 1 << 2,
+    kColors_Flag   = 1 << 0,
+    kRotate_Flag   = 1 << 1,
+    kPersp_Flag    = 1 << 2,
+    kImageSet_Flag = 1 << 3,  // experimental_DrawEdgeAAImageSet() instead of drawAtlas()
 };
 
 class AtlasBench : public Benchmark {
@@ -173,6 +174,7 @@ class AtlasBench : public Benchmark {
     SkRSXform       fXforms[N];
     SkRect          fRects[N];
     SkColor         fColors[N];
+    SkCanvas::ImageSetEntry fEntries[N];
 
 public:
     AtlasBench(unsigned flags) : fFlags(flags) {
@@ -186,6 +188,10 @@ public:
         if (flags & kPersp_Flag) {
             fName.append("_persp");
         }
+        if (flags & kImageSet_Flag) {
+            SkASSERT(!(flags & (kColors_Flag | kRotate_Flag)));
+            fName.append("_imageset");
+        }
     }
     ~AtlasBench() override {}
 
@@ -212,6 +218,10 @@ protected:
                                          rand.nextF() * (imageH - 8), 8, 8);
             fColors[i] = rand.nextU() | 0xFF000000;
             fXforms[i] = SkRSXform::Make(scos, ssin, rand.nextF() * W, rand.nextF() * H);
+
+            fEntries[i].fImage = fAtlas;
+            fEntries[i].fSrcRect = fRects[i];
+            fEntries[i].fDstRect = SkRect::MakeXYWH(fXforms[i].fTx, fXforms[i].fTy, 8, 8);
         }
     }
     void onDraw(int loops, SkCanvas* canvas) override {
@@ -224,6 +234,14 @@ protected:
         if (fFlags & kPersp_Flag) {
             tiny_persp_effect(canvas);
         }
+        if (fFlags & kImageSet_Flag) {
+            for (int i = 0; i < loops; i++) {
+                canvas->experimental_DrawEdgeAAImageSet(fEntries, N, nullptr, nullptr,
+                                                        SkSamplingOptions(), paintPtr,
+                                                        SkCanvas::kFast_SrcRectConstraint);
+            }
+            return;
+        }
         for (int i = 0; i < loops; i++) {
             canvas->drawAtlas(fAtlas.get(), fXforms, fRects, colors, N, SkBlendMode::kModulate,
                               SkSamplingOptions(), cullRect, paintPtr);
@@ -239,4 +257,6 @@ DEF_BENCH(return new AtlasBench(kRotate_Flag);)
 DEF_BENCH(return new AtlasBench(kPersp_Flag);)
 DEF_BENCH(return new AtlasBench(kColors_Flag);)
 DEF_BENCH(return new AtlasBench(kColors_Flag | kRotate_Flag);)
+DEF_BENCH(return new AtlasBench(kImageSet_Flag);)
+DEF_BENCH(return new AtlasBench(kImageSet_Flag | kPersp_Flag);)
 
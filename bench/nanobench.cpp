@@ -140,6 +140,9 @@ static DEFINE_string(zoom, "1.0,0",
                      "function that ping-pongs between 1.0 and zoomMax.");
 static DEFINE_bool(bbh, true, "Build a BBH for SKPs?");
 static DEFINE_bool(loopSKP, true, "Loop SKPs like we do for micro benches?");
+static DEFINE_bool(lazySKPs, false,
+                   "Deserialize SKPs with SkPicture::MakeLazyFromData, decoding their commands "
+                   "during one playback? Compare max RSS against a run without.");
 static DEFINE_int(flushEvery, 10, "Flush --outResultsFile every Nth run.");
 static DEFINE_bool(gpuStats, false, "Print GPU stats after each gpu benchmark?");
 static DEFINE_bool(gpuStatsDump, false, "Dump GPU stats after each benchmark to json");
@@ -170,6 +173,9 @@ static DEFINE_string(images, "",
                      " is treated as a fatal error.");
 static DEFINE_bool(simpleCodec, false,
                    "Runs of a subset of the codec tests, always N32, Premul or Opaque");
+static DEFINE_int(brdThreads, 0,
+                  "If >0, BitmapRegionDecoder benches decode on a thread pool with this many "
+                  "threads, splitting JPEGs with restart markers into bands.");
 
 static DEFINE_string2(match, m, nullptr,
                "[~][^]substring[$] [...] of name to run.\n"
@@ -956,7 +962,7 @@ public:
             fBenchType  = "deserial";
             fSKPBytes = static_cast<double>(data->size());
             fSKPOps   = 0;
-            return new DeserializePictureBench(name.c_str(), std::move(data));
+            return new DeserializePictureBench(name.c_str(), std::move(data), FLAGS_lazySKPs);
         }
 
         // Then once each for each scale as SKPBenches (playback).
@@ -1213,7 +1219,7 @@ public:
                         }
 
                         return new BitmapRegionDecoderBench(basename.c_str(), encoded.get(),
-                                colorType, sampleSize, subset);
+                                colorType, sampleSize, subset, FLAGS_brdThreads);
                     }
                     fCurrentSubsetType = 0;
                     fCurrentSampleSize++;
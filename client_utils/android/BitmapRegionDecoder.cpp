@@ -47,7 +47,7 @@ int BitmapRegionDecoder::height() const {
 
 bool BitmapRegionDecoder::decodeRegion(SkBitmap* bitmap, BRDAllocator* allocator,
         const SkIRect& desiredSubset, int sampleSize, SkColorType dstColorType,
-        bool requireUnpremul, sk_sp<SkColorSpace> dstColorSpace) {
+        bool requireUnpremul, sk_sp<SkColorSpace> dstColorSpace, SkExecutor* executor) {
 
     // Fix the input sampleSize if necessary.
     if (sampleSize < 1) {
@@ -131,6 +131,7 @@ bool BitmapRegionDecoder::decodeRegion(SkBitmap* bitmap, BRDAllocator* allocator
     options.fSampleSize = sampleSize;
     options.fSubset = &subset;
     options.fZeroInitialized = zeroInit;
+    options.fExecutor = executor;
     void* dst = bitmap->getAddr(scaledOutX, scaledOutY);
 
     SkCodec::Result result = fCodec->getAndroidPixels(decodeInfo, dst, bitmap->rowBytes(),
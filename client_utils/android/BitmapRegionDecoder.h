@@ -20,10 +20,15 @@ class BitmapRegionDecoder final {
 public:
     static std::unique_ptr<BitmapRegionDecoder> Make(sk_sp<SkData> data);
 
+    /**
+     *  If executor is not null, parts of the region may be decoded in parallel on it.
+     *  See SkCodec::Options::fExecutor.
+     */
     bool decodeRegion(SkBitmap* bitmap, BRDAllocator* allocator,
                       const SkIRect& desiredSubset, int sampleSize,
                       SkColorType colorType, bool requireUnpremul,
-                      sk_sp<SkColorSpace> prefColorSpace);
+                      sk_sp<SkColorSpace> prefColorSpace,
+                      SkExecutor* executor = nullptr);
 
     SkEncodedImageFormat getEncodedFormat() { return fCodec->getEncodedFormat(); }
 
@@ -27,6 +27,7 @@
 class SkAndroidCodec;
 class SkColorSpace;
 class SkData;
+class SkExecutor;
 class SkFrameHolder;
 class SkImage;
 class SkPngChunkReader;
@@ -289,6 +290,7 @@ public:
             , fSubset(nullptr)
             , fFrameIndex(0)
             , fPriorFrame(kNoFrame)
+            , fExecutor(nullptr)
         {}
 
         ZeroInitialized            fZeroInitialized;
@@ -332,6 +334,15 @@ public:
          *  If set to kNoFrame, the codec will decode any necessary required frame(s) first.
          */
         int                        fPriorFrame;
+
+        /**
+         *  If not NULL, getPixels() and incremental decodes may use it to decode parts of the
+         *  image in parallel, blocking until they are all done.
+         *
+         *  Currently only JPEGs with restart markers, decoded without scaling, are split up.
+         *  Other images decode serially as if this were NULL.
+         */
+        SkExecutor*                fExecutor;
     };
 
     /**
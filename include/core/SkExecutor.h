@@ -22,6 +22,11 @@ public:
     static std::unique_ptr<SkExecutor> MakeLIFOThreadPool(int threads = 0,
                                                           bool allowBorrowing = true);
 
+    // Create a thread pool SkExecutor where each thread has its own queue of work. Work added by
+    // one of the pool's threads stays on that thread's queue unless an idle thread steals it.
+    static std::unique_ptr<SkExecutor> MakeWorkStealingThreadPool(int threads = 0,
+                                                                  bool allowBorrowing = true);
+
     // There is always a default SkExecutor available by calling SkExecutor::GetDefault().
     static SkExecutor& GetDefault();
     static void SetDefault(SkExecutor*);  // Does not take ownership.  Not thread safe.
@@ -11,6 +11,7 @@
 #include "include/core/SkRefCnt.h"
 
 class SkData;
+class SkExecutor;
 class SkImageGenerator;
 class SkOpenTypeSVGDecoder;
 class SkTraceMemoryDump;
@@ -163,6 +164,20 @@ public:
      *  Call early in main() to allow Skia to use a JIT to accelerate CPU-bound operations.
      */
     static void AllowJIT();
+
+    /**
+     *  If set, large CPU Gaussian blurs (blur mask filters and blur image filters) split each of
+     *  their passes into bands of rows or columns that run in parallel on this executor. The
+     *  results are identical to blurring on the calling thread. The executor must outlive any
+     *  blurs that use it. By default this is NULL, and blurs run on the calling thread.
+     *
+     *  This can be called while other threads are blurring; blurs already under way keep using
+     *  the executor they started with.
+     *
+     *  Returns the previous executor (which could be NULL).
+     */
+    static SkExecutor* SetBlurExecutor(SkExecutor*);
+    static SkExecutor* GetBlurExecutor();
 };
 
 class SkAutoGraphics {
@@ -82,6 +82,22 @@ public:
     static sk_sp<SkPicture> MakeFromData(const void* data, size_t size,
                                          const SkDeserialProcs* procs = nullptr);
 
+    /** Recreates SkPicture that was serialized into data, like MakeFromData(), but without
+        decoding its drawing commands first. The first playback of the returned SkPicture
+        decodes each command as it draws it. Later playbacks draw from commands decoded once,
+        the first time the SkPicture is played back again. This lowers the memory it takes to
+        draw a large SkPicture once. Paints, paths, images, and other objects the commands use
+        are still decoded before returning, and the commands are read through once to check
+        them: unlike MakeFromData(), which keeps the commands before one it can't decode, this
+        returns nullptr if any command can't be decoded.
+
+        @param data   container for serial data
+        @param procs  custom serial data decoders; may be nullptr
+        @return       SkPicture constructed from data
+    */
+    static sk_sp<SkPicture> MakeLazyFromData(const SkData* data,
+                                             const SkDeserialProcs* procs = nullptr);
+
     /** \class SkPicture::AbortCallback
         AbortCallback is an abstract class. An implementation of AbortCallback may
         passed as a parameter to SkPicture::playback, to stop it before all drawing
@@ -239,6 +255,7 @@ private:
     SkPicture();
     friend class SkBigPicture;
     friend class SkEmptyPicture;
+    friend class SkLazyPicture;
     friend class SkPicturePriv;
     template <typename> friend class SkMiniPicture;
 
@@ -113,6 +113,7 @@ private:
     void setTemporarilyImmutable();
     void restoreMutability();
     friend class SkSurface_Raster;  // For temporary immutable methods above.
+    friend class SkSurface_TiledRaster;
 
     void setImmutableWithID(uint32_t genID);
     friend void SkBitmapCache_setImmutableWithID(SkPixelRef*, uint32_t);
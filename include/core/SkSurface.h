@@ -28,6 +28,7 @@
 class SkCanvas;
 class SkCapabilities;
 class SkDeferredDisplayList;
+class SkExecutor;
 class SkPaint;
 class SkSurfaceCharacterization;
 class GrBackendRenderTarget;
@@ -176,6 +177,30 @@ public:
     static sk_sp<SkSurface> MakeRasterN32Premul(int width, int height,
                                                 const SkSurfaceProps* surfaceProps = nullptr);
 
+    /** Experimental. Allocates raster SkSurface whose SkCanvas records draws instead of
+        rasterizing them immediately. Recorded draws are rasterized when the surface contents
+        are needed: on SkCanvas::flush(), makeImageSnapshot(), draw(), peekPixels(),
+        readPixels() or writePixels(). The surface is then split into tiles of tileSize, and
+        each tile plays back only the recorded draws that intersect it, on executor.
+
+        Pixel results match a surface returned by MakeRaster(), except that
+        SkCanvas::readPixels() and SkCanvas::peekPixels() on getCanvas() fail; use the
+        SkSurface variants instead. Layers left open across a flush are resolved as if they
+        had been plain saves.
+
+        @param imageInfo     width, height, SkColorType, SkAlphaType, SkColorSpace,
+                             of raster surface; width and height must be greater than zero
+        @param executor      runs tile playback; must outlive SkSurface. If nullptr,
+                             SkExecutor::GetDefault() is used
+        @param tileSize      dimensions of each tile; must be greater than zero
+        @param surfaceProps  LCD striping orientation and setting for device independent fonts;
+                             may be nullptr
+        @return              SkSurface if all parameters are valid; otherwise, nullptr
+    */
+    static sk_sp<SkSurface> MakeRasterTiled(const SkImageInfo& imageInfo, SkExecutor* executor,
+                                            SkISize tileSize = {256, 256},
+                                            const SkSurfaceProps* surfaceProps = nullptr);
+
     /** Caller data passed to RenderTarget/TextureReleaseProc; may be nullptr. */
     typedef void* ReleaseContext;
 
@@ -178,6 +178,32 @@ public:
         return MakeForBlender(std::move(sksl), Options{});
     }
 
+    // Recreate an effect from its SkSL, the Options it was made with, and the blob returned by
+    // its compiledProgram(). This skips parsing and optimizing the SkSL, so clients can persist
+    // the blob (e.g. in a disk cache) to speed up effect creation in later runs.
+    //
+    // The blob is keyed by the SkSL, the Options, the kind of effect and the version of the SkSL
+    // compiler. If any of them differ, or the blob is damaged, these fail; the caller should then
+    // fall back to MakeForShader/MakeForColorFilter/MakeForBlender and replace the stale blob.
+    // The blob is not validated beyond that, so it must come from a trusted source.
+    static Result MakeForColorFilterFromCompiledProgram(SkString sksl, const SkData& compiled,
+                                                        const Options&);
+    static Result MakeForColorFilterFromCompiledProgram(SkString sksl, const SkData& compiled) {
+        return MakeForColorFilterFromCompiledProgram(std::move(sksl), compiled, Options{});
+    }
+
+    static Result MakeForShaderFromCompiledProgram(SkString sksl, const SkData& compiled,
+                                                   const Options&);
+    static Result MakeForShaderFromCompiledProgram(SkString sksl, const SkData& compiled) {
+        return MakeForShaderFromCompiledProgram(std::move(sksl), compiled, Options{});
+    }
+
+    static Result MakeForBlenderFromCompiledProgram(SkString sksl, const SkData& compiled,
+                                                    const Options&);
+    static Result MakeForBlenderFromCompiledProgram(SkString sksl, const SkData& compiled) {
+        return MakeForBlenderFromCompiledProgram(std::move(sksl), compiled, Options{});
+    }
+
     // Object that allows passing a SkShader, SkColorFilter or SkBlender as a child
     class ChildPtr {
     public:
@@ -246,6 +272,11 @@ public:
     // Returns the SkSL source of the runtime effect shader.
     const std::string& source() const;
 
+    // Returns the effect's parsed and optimized program, serialized for the FromCompiledProgram
+    // factories.
+    // Returns null if the program is too large to serialize.
+    sk_sp<SkData> compiledProgram() const;
+
     // Combined size of all 'uniform' variables. When calling makeColorFilter or makeShader,
     // provide an SkData of this size, containing values for all of those variables.
     size_t uniformSize() const;
@@ -290,12 +321,17 @@ private:
 
     static Result MakeFromSource(SkString sksl, const Options& options, SkSL::ProgramKind kind);
 
+    static Result MakeFromCompiledProgram(SkString sksl, const SkData& compiled,
+                                          const Options& options, SkSL::ProgramKind kind);
+
     static Result MakeInternal(std::unique_ptr<SkSL::Program> program,
                                const Options& options,
                                SkSL::ProgramKind kind);
 
     static SkSL::ProgramSettings MakeSettings(const Options& options);
 
+    static uint32_t HashSourceAndOptions(std::string_view sksl, const Options& options);
+
     uint32_t hash() const { return fHash; }
     bool usesSampleCoords()   const { return (fFlags & kUsesSampleCoords_Flag);   }
     bool samplesOutsideMain() const { return (fFlags & kSamplesOutsideMain_Flag); }
@@ -31,6 +31,7 @@ class GrResourceCache;
 class GrResourceProvider;
 class GrSurfaceProxy;
 class GrTextureProxy;
+class GrTriangulatorArenas;
 struct GrVkBackendContext;
 
 class SkImage;
@@ -876,6 +877,9 @@ private:
 
     std::unique_ptr<skgpu::v1::SmallPathAtlasMgr> fSmallPathAtlasMgr;
 
+    // Scratch memory for triangulating paths on fTaskGroup's executor.
+    std::unique_ptr<GrTriangulatorArenas> fTriangulatorArenas;
+
     friend class GrDirectContextPriv;
 
     using INHERITED = GrRecordingContext;
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef GrPersistentFileCache_DEFINED
+#define GrPersistentFileCache_DEFINED
+
+#include "include/core/SkTypes.h"
+#include "include/gpu/GrContextOptions.h"
+
+#include <memory>
+
+#if SK_SUPPORT_GPU
+
+/**
+ * A GrContextOptions::PersistentCache backed by a single pack file, so programs compiled by one run
+ * can be reused by the next. The pack is memory-mapped when the cache is created and entries from
+ * it are returned without copying, until the pack is first rewritten. Once the entries outgrow
+ * the byte budget, the least recently used ones are evicted. Changes are written back to the pack
+ * by a background thread, and on destruction.
+ *
+ * Entries packed by an older version of Skia's shader cache format are dropped when the pack is
+ * opened, rather than taking up budget until they're evicted. Data the backends store without that
+ * format's header, like Vulkan's pipeline cache, is always kept.
+ *
+ * One cache can be shared by multiple GrContexts that are created with the same options and have
+ * the same GrCaps, including contexts on different threads.
+ */
+class SK_API GrPersistentFileCache : public GrContextOptions::PersistentCache {
+public:
+    /**
+     * Creates a cache that reads the pack file at path, if there is one, and writes back to it.
+     * byteBudget limits the total size of the keys, data and descriptions kept.
+     */
+    static std::unique_ptr<GrPersistentFileCache> Make(const char* path, size_t byteBudget);
+
+    /**
+     * Writes the pack file now if anything changed since it was last written. Returns false if
+     * the pack couldn't be written.
+     */
+    virtual bool sync() = 0;
+
+    struct Stats {
+        int    fHits = 0;
+        int    fMisses = 0;
+        int    fStores = 0;
+        int    fEvictions = 0;
+        int    fDroppedEntries = 0;  // Stale entries skipped when the pack was opened.
+        size_t fBytesLoaded = 0;     // Bytes returned by load().
+        size_t fBytesStored = 0;     // Bytes passed to store().
+        int    fEntries = 0;
+        size_t fBytesUsed = 0;       // Keys, data and descriptions of the current entries.
+    };
+    virtual Stats stats() const = 0;
+    virtual void resetStats() = 0;
+
+protected:
+    GrPersistentFileCache() = default;
+};
+
+#endif
+
+#endif
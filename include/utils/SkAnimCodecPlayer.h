@@ -12,12 +12,16 @@
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSize.h"
+#include "include/private/SkMutex.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
+class SkExecutor;
 class SkImage;
+class SkTaskGroup;
 
 class SkAnimCodecPlayer {
 public:
@@ -51,16 +55,58 @@ public:
      */
     bool seek(uint32_t msec);
 
+    /**
+     *  Limits the memory used by decoded frames, in bytes. When over budget, the cached frames
+     *  furthest from the current frame in playback order are dropped first; the current frame is
+     *  always kept. Frames which are needed again are decoded from the closest cached frame they
+     *  depend on. Defaults to no limit, i.e. every decoded frame stays cached.
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     *  Decodes up to |frames| frames following the current one ahead of time on |executor|,
+     *  within the memory budget. Decoding starts on the next call to seek(). Passing a null
+     *  executor (or zero frames) disables decode-ahead. The executor must outlive the player.
+     */
+    void setDecodeAhead(SkExecutor* executor, int frames);
+
+    /**
+     *  Returns true iff the current frame is decoded already, i.e. getFrame() will not block on
+     *  decoding.
+     */
+    bool isFrameReady() const;
+
+    /**
+     *  Returns the memory used by the decoded frames currently cached, in bytes.
+     */
+    size_t cachedBytes() const;
 
 private:
     std::unique_ptr<SkCodec>        fCodec;
     SkImageInfo                     fImageInfo;
     std::vector<SkCodec::FrameInfo> fFrameInfos;
+    uint32_t                        fTotalDuration;
+
+    // Decode-ahead runs concurrently with the calling thread: fCodecMutex serializes decoding,
+    // and fCacheMutex guards the fields below it. fCodecMutex is always acquired first.
+    SkMutex                         fCodecMutex;
+    mutable SkMutex                 fCacheMutex;
     std::vector<sk_sp<SkImage> >    fImages;
+    size_t                          fCachedBytes = 0;
+    size_t                          fMemoryBudget = SIZE_MAX;
     int                             fCurrIndex = 0;
-    uint32_t                        fTotalDuration;
+
+    int                             fDecodeAheadFrames = 0;
+    std::atomic<bool>               fDecodeAheadScheduled{false};
+    std::unique_ptr<SkTaskGroup>    fDecodeAheadTasks;
 
     sk_sp<SkImage> getFrameAt(int index);
+    sk_sp<SkImage> decodeFrame(int index, const sk_sp<SkImage>& prior) SK_REQUIRES(fCodecMutex);
+    sk_sp<SkImage> decodeFrameChain(int index) SK_REQUIRES(fCodecMutex);
+    void cacheFrame(int index, sk_sp<SkImage>) SK_REQUIRES(fCacheMutex);
+    void purge() SK_REQUIRES(fCacheMutex);
+    int distanceFromCurrent(int index) const SK_REQUIRES(fCacheMutex);
+    void decodeAhead();
 };
 
 #endif
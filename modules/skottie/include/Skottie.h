@@ -35,7 +35,12 @@ class Scene;
 
 namespace skottie {
 
-namespace internal { class Animator; }
+namespace internal {
+
+class Animator;
+struct SharedAnimationData;
+
+} // namespace internal
 
 using ImageAsset = skresources::ImageAsset;
 using ResourceProvider = skresources::ResourceProvider;
@@ -95,6 +100,8 @@ public:
                                          // frames are only resolved when needed, at seek() time.
             kPreferEmbeddedFonts = 0x02, // Attempt to use the embedded fonts (glyph paths,
                                          // normally used as fallback) over native Skia typefaces.
+            kAllowInstancing     = 0x04, // Keep the parsed JSON, fonts and static images around,
+                                         // so that Animation::makeInstance() can share them.
         };
 
         explicit Builder(uint32_t flags = 0);
@@ -264,6 +271,26 @@ public:
     const SkString& version() const { return fVersion; }
     const SkSize&      size() const { return fSize;    }
 
+    /**
+     * Makes another instance of this animation, which can seek and render independently (e.g.
+     * a different frame on each of several threads).
+     *
+     * Instances share the parsed JSON, the resolved fonts and the static images (decoded once,
+     * when this animation was built) with this animation; only the scene graph and its animators
+     * are built per instance.  Multi-frame image and audio assets are loaded again for each
+     * instance.  Instances don't report to the PropertyObserver or MarkerObserver passed to the
+     * Builder.
+     *
+     * makeInstance() itself can be called from several threads at once, as long as the
+     * builder's ResourceProvider, Logger and ExpressionManager are thread safe.  ImageAssets
+     * needn't be: each instance loads its own multi-frame ones, and never calls the shared
+     * static ones.
+     *
+     * @return a new animation instance, or nullptr if the animation wasn't built with
+     *         Builder::kAllowInstancing.
+     */
+    sk_sp<Animation> makeInstance() const;
+
 private:
     enum Flags : uint32_t {
         kRequiresTopLevelIsolation = 1 << 0, // Needs to draw into a layer due to layer blending.
@@ -272,7 +299,8 @@ private:
     Animation(std::unique_ptr<sksg::Scene>,
               std::vector<sk_sp<internal::Animator>>&&,
               SkString ver, const SkSize& size,
-              double inPoint, double outPoint, double duration, double fps, uint32_t flags);
+              double inPoint, double outPoint, double duration, double fps, uint32_t flags,
+              sk_sp<internal::SharedAnimationData>);
 
     const std::unique_ptr<sksg::Scene>           fScene;
     const std::vector<sk_sp<internal::Animator>> fAnimators;
@@ -283,6 +311,7 @@ private:
                                                  fDuration,
                                                  fFPS;
     const uint32_t                               fFlags;
+    const sk_sp<internal::SharedAnimationData>   fSharedData;
 
     using INHERITED = SkNVRefCnt<Animation>;
 };
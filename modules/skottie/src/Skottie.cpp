@@ -142,6 +142,35 @@ AnimationBuilder::AnimationInfo AnimationBuilder::parse(const skjson::ObjectValu
     this->parseAssets(jroot["assets"]);
     this->parseFonts(jroot["fonts"], jroot["chars"]);
 
+    return this->attachComposition(jroot);
+}
+
+AnimationBuilder::AnimationInfo AnimationBuilder::parseInstance(const skjson::ObjectValue& jroot,
+                                                                const SharedAnimationData& shared) {
+    this->parseAssets(jroot["assets"]);
+    fFonts = shared.fFonts;
+    fImageAssetCache = shared.fImageAssets;
+
+    return this->attachComposition(jroot);
+}
+
+void AnimationBuilder::shareResources(SharedAnimationData* shared) {
+    shared->fFontMgr = fLazyFontMgr.getMaybeNull();
+    shared->fFonts = std::move(fFonts);
+
+    // Only static images whose frame we've already resolved are shared, along with that frame:
+    // ImageAssets aren't thread safe, so instances mustn't call into them.  Multi-frame assets
+    // keep their decoding state, and deferred ones resolve their frame on first seek.
+    fImageAssetCache.foreach([&](const SkString& id, FootageAssetInfo* info) {
+        if (!(fFlags & Animation::Builder::kDeferImageLoading) && !info->fAsset->isMultiFrame() &&
+            info->fFrameData.image) {
+            shared->fImageAssets.set(id, *info);
+        }
+    });
+}
+
+AnimationBuilder::AnimationInfo AnimationBuilder::attachComposition(
+        const skjson::ObjectValue& jroot) {
     AutoScope ascope(this);
     AutoPropertyTracker apt(this, jroot, PropertyObserver::NodeType::COMPOSITION);
     auto root = CompositionBuilder(*this, fCompSize, jroot).build(*this);
@@ -261,6 +290,9 @@ void AnimationBuilder::AutoPropertyTracker::updateContext(PropertyObserver* obse
     fBuilder->fPropertyObserverContext = name ? name->begin() : nullptr;
 }
 
+SharedAnimationData::SharedAnimationData() = default;
+SharedAnimationData::~SharedAnimationData() = default;
+
 } // namespace internal
 
 void Logger::log(Level, const char[], const char*) {}
@@ -338,15 +370,15 @@ sk_sp<Animation> Animation::Builder::make(const char* data, size_t data_len) {
     fStats.fJsonSize = data_len;
     const auto t0 = std::chrono::steady_clock::now();
 
-    const skjson::DOM dom(data, data_len);
-    if (!dom.root().is<skjson::ObjectValue>()) {
+    auto dom = std::make_unique<skjson::DOM>(data, data_len);
+    if (!dom->root().is<skjson::ObjectValue>()) {
         // TODO: more error info.
         if (fLogger) {
             fLogger->log(Logger::Level::kError, "Failed to parse JSON input.\n");
         }
         return nullptr;
     }
-    const auto& json = dom.root().as<skjson::ObjectValue>();
+    const auto& json = dom->root().as<skjson::ObjectValue>();
 
     const auto t1 = std::chrono::steady_clock::now();
     fStats.fJsonParseTimeMS = std::chrono::duration<float, std::milli>{t1-t0}.count();
@@ -372,6 +404,16 @@ sk_sp<Animation> Animation::Builder::make(const char* data, size_t data_len) {
     }
 
     SkASSERT(resolvedProvider);
+    sk_sp<internal::SharedAnimationData> shared;
+    if (fFlags & kAllowInstancing) {
+        shared = sk_make_sp<internal::SharedAnimationData>();
+        shared->fResourceProvider   = resolvedProvider;
+        shared->fLogger             = fLogger;
+        shared->fPrecompInterceptor = fPrecompInterceptor;
+        shared->fExpressionManager  = fExpressionManager;
+        shared->fFlags              = fFlags;
+    }
+
     internal::AnimationBuilder builder(std::move(resolvedProvider), fFontMgr,
                                        std::move(fPropertyObserver),
                                        std::move(fLogger),
@@ -394,6 +436,13 @@ sk_sp<Animation> Animation::Builder::make(const char* data, size_t data_len) {
         flags |= Animation::Flags::kRequiresTopLevelIsolation;
     }
 
+    if (shared && ainfo.fScene) {
+        builder.shareResources(shared.get());
+        shared->fDOM = std::move(dom);
+    } else {
+        shared = nullptr;
+    }
+
     return sk_sp<Animation>(new Animation(std::move(ainfo.fScene),
                                           std::move(ainfo.fAnimators),
                                           std::move(version),
@@ -402,7 +451,8 @@ sk_sp<Animation> Animation::Builder::make(const char* data, size_t data_len) {
                                           outPoint,
                                           duration,
                                           fps,
-                                          flags));
+                                          flags,
+                                          std::move(shared)));
 }
 
 sk_sp<Animation> Animation::Builder::makeFromFile(const char path[]) {
@@ -415,7 +465,8 @@ sk_sp<Animation> Animation::Builder::makeFromFile(const char path[]) {
 Animation::Animation(std::unique_ptr<sksg::Scene> scene,
                      std::vector<sk_sp<internal::Animator>>&& animators,
                      SkString version, const SkSize& size,
-                     double inPoint, double outPoint, double duration, double fps, uint32_t flags)
+                     double inPoint, double outPoint, double duration, double fps, uint32_t flags,
+                     sk_sp<internal::SharedAnimationData> shared)
     : fScene(std::move(scene))
     , fAnimators(std::move(animators))
     , fVersion(std::move(version))
@@ -424,7 +475,8 @@ Animation::Animation(std::unique_ptr<sksg::Scene> scene,
     , fOutPoint(outPoint)
     , fDuration(duration)
     , fFPS(fps)
-    , fFlags(flags) {}
+    , fFlags(flags)
+    , fSharedData(std::move(shared)) {}
 
 Animation::~Animation() = default;
 
@@ -459,6 +511,38 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderF
     fScene->render(canvas);
 }
 
+sk_sp<Animation> Animation::makeInstance() const {
+    TRACE_EVENT0("skottie", TRACE_FUNC);
+
+    if (!fSharedData) {
+        return nullptr;
+    }
+
+    Builder::Stats stats;
+    internal::AnimationBuilder builder(fSharedData->fResourceProvider,
+                                       fSharedData->fFontMgr,
+                                       nullptr,
+                                       fSharedData->fLogger,
+                                       nullptr,
+                                       fSharedData->fPrecompInterceptor,
+                                       fSharedData->fExpressionManager,
+                                       &stats, fSize, static_cast<float>(fDuration),
+                                       static_cast<float>(fFPS), fSharedData->fFlags);
+    auto ainfo = builder.parseInstance(fSharedData->fDOM->root().as<skjson::ObjectValue>(),
+                                       *fSharedData);
+
+    return sk_sp<Animation>(new Animation(std::move(ainfo.fScene),
+                                          std::move(ainfo.fAnimators),
+                                          fVersion,
+                                          fSize,
+                                          fInPoint,
+                                          fOutPoint,
+                                          fDuration,
+                                          fFPS,
+                                          fFlags,
+                                          fSharedData));
+}
+
 void Animation::seekFrame(double t, sksg::InvalidationController* ic) {
     TRACE_EVENT0("skottie", TRACE_FUNC);
 
@@ -26,6 +26,7 @@ class SkFontMgr;
 
 namespace skjson {
 class ArrayValue;
+class DOM;
 class ObjectValue;
 class Value;
 } // namespace skjson
@@ -64,6 +65,13 @@ public:
 
     AnimationInfo parse(const skjson::ObjectValue&);
 
+    // Builds a new scene graph and animators for an animation parsed before, reusing the fonts
+    // and images resolved at that time.
+    AnimationInfo parseInstance(const skjson::ObjectValue&, const SharedAnimationData&);
+
+    // Hands the resolved fonts and static images over to the animation's instances.
+    void shareResources(SharedAnimationData*);
+
     struct FontInfo {
         SkString                fFamily,
                                 fStyle,
@@ -181,12 +189,15 @@ public:
 private:
     friend class CompositionBuilder;
     friend class LayerBuilder;
+    friend struct SharedAnimationData;
 
     struct AttachLayerContext;
     struct AttachShapeContext;
     struct FootageAssetInfo;
     struct LayerInfo;
 
+    AnimationInfo attachComposition(const skjson::ObjectValue&);
+
     void parseAssets(const skjson::ArrayValue*);
     void parseFonts (const skjson::ObjectValue* jfonts,
                      const skjson::ArrayValue* jchars);
@@ -202,7 +213,7 @@ private:
 
     sk_sp<sksg::RenderNode> attachShape(const skjson::ArrayValue*, AttachShapeContext*,
                                         bool suppress_draws = false) const;
-    const FootageAssetInfo* loadFootageAsset(const skjson::ObjectValue&) const;
+    FootageAssetInfo* loadFootageAsset(const skjson::ObjectValue&) const;
     sk_sp<sksg::RenderNode> attachFootageAsset(const skjson::ObjectValue&, LayerInfo*) const;
 
     sk_sp<sksg::RenderNode> attachExternalPrecompLayer(const skjson::ObjectValue&,
@@ -262,8 +273,9 @@ private:
     };
 
     struct FootageAssetInfo {
-        sk_sp<ImageAsset> fAsset;
-        SkISize           fSize;
+        sk_sp<ImageAsset>     fAsset;
+        SkISize               fSize;
+        ImageAsset::FrameData fFrameData;  // The only frame of a static asset, once resolved.
     };
 
     class ScopedAssetRef {
@@ -291,6 +303,23 @@ private:
     using INHERITED = SkNoncopyable;
 };
 
+// The parts of an animation that don't change as it plays, shared by all its instances.
+struct SharedAnimationData final : public SkNVRefCnt<SharedAnimationData> {
+    SharedAnimationData();
+    ~SharedAnimationData();
+
+    std::unique_ptr<skjson::DOM> fDOM;
+    sk_sp<ResourceProvider>      fResourceProvider;
+    sk_sp<SkFontMgr>             fFontMgr;
+    sk_sp<Logger>                fLogger;
+    sk_sp<PrecompInterceptor>    fPrecompInterceptor;
+    sk_sp<ExpressionManager>     fExpressionManager;
+    uint32_t                     fFlags = 0;
+
+    SkTHashMap<SkString, AnimationBuilder::FontInfo>         fFonts;
+    SkTHashMap<SkString, AnimationBuilder::FootageAssetInfo> fImageAssets;
+};
+
 } // namespace internal
 } // namespace skottie
 
@@ -5,6 +5,8 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkStream.h"
@@ -18,8 +20,10 @@
 #include "tests/Test.h"
 #include "tools/ToolUtils.h"
 
+#include <atomic>
 #include <cmath>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -885,3 +889,168 @@ DEF_TEST(Skottie_Layer_NoType, r) {
     // passes if we don't crash
     REPORTER_ASSERT(r, anim);
 }
+
+DEF_TEST(Skottie_Instances, r) {
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 10,
+             "h": 10,
+             "fr": 10,
+             "ip": 0,
+             "op": 10,
+             "layers": [
+               {
+                 "ty": 1,
+                 "sw": 10,
+                 "sh": 10,
+                 "sc": "#ff0000",
+                 "ip": 0,
+                 "op": 10,
+                 "ks": {
+                   "o": { "a": 1, "k": [ { "t": 0, "s": [0] }, { "t": 9, "s": [100] } ] }
+                 }
+               }
+             ]
+           })";
+
+    auto render = [](const Animation& anim) {
+        SkBitmap bm;
+        bm.allocN32Pixels(10, 10);
+        bm.eraseColor(SK_ColorTRANSPARENT);
+        SkCanvas canvas(bm);
+        anim.render(&canvas);
+        return bm.getColor(5, 5);
+    };
+
+    // Instancing is opt-in.
+    auto plain = Animation::Make(json, strlen(json));
+    REPORTER_ASSERT(r, plain);
+    REPORTER_ASSERT(r, !plain->makeInstance());
+
+    auto anim = Animation::Builder(Animation::Builder::kAllowInstancing).make(json, strlen(json));
+    REPORTER_ASSERT(r, anim);
+    auto instance = anim->makeInstance();
+    REPORTER_ASSERT(r, instance);
+    REPORTER_ASSERT(r, instance->size() == anim->size());
+    REPORTER_ASSERT(r, instance->duration() == anim->duration());
+
+    // Each instance has its own animation state.
+    anim->seekFrame(0);
+    instance->seekFrame(9);
+    REPORTER_ASSERT(r, render(*anim) == SK_ColorTRANSPARENT);
+    REPORTER_ASSERT(r, render(*instance) == SK_ColorRED);
+
+    anim->seekFrame(9);
+    instance->seekFrame(0);
+    REPORTER_ASSERT(r, render(*anim) == SK_ColorRED);
+    REPORTER_ASSERT(r, render(*instance) == SK_ColorTRANSPARENT);
+
+    // Instances can be made from instances.
+    auto instance2 = instance->makeInstance();
+    REPORTER_ASSERT(r, instance2);
+    instance2->seekFrame(9);
+    REPORTER_ASSERT(r, render(*instance2) == SK_ColorRED);
+}
+
+DEF_TEST(Skottie_Instances_Threads, r) {
+    // A static image asset that counts its decodes, and notices if they overlap.
+    class TestAsset final : public skresources::ImageAsset {
+    public:
+        int frames() const { return fFrames; }
+        bool overlapped() const { return fOverlapped; }
+
+    private:
+        bool isMultiFrame() override { return false; }
+
+        sk_sp<SkImage> getFrame(float) override {
+            fOverlapped = fOverlapped || fBusy.exchange(true);
+            fFrames++;
+
+            SkBitmap bm;
+            bm.allocN32Pixels(10, 10);
+            bm.eraseColor(SK_ColorGREEN);
+            auto image = bm.asImage();
+
+            fBusy = false;
+            return image;
+        }
+
+        std::atomic<bool> fBusy{false},
+                          fOverlapped{false};
+        std::atomic<int>  fFrames{0};
+    };
+
+    class TestResourceProvider final : public skresources::ResourceProvider {
+    public:
+        explicit TestResourceProvider(sk_sp<TestAsset> asset) : fAsset(std::move(asset)) {}
+
+    private:
+        sk_sp<ImageAsset> loadImageAsset(const char[], const char[], const char[]) const override {
+            return fAsset;
+        }
+
+        const sk_sp<TestAsset> fAsset;
+    };
+
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 10,
+             "h": 10,
+             "fr": 10,
+             "ip": 0,
+             "op": 10,
+             "assets": [ { "id": "image", "p": "image.png", "u": "images/", "w": 10, "h": 10 } ],
+             "layers": [
+               {
+                 "ty": 2,
+                 "refId": "image",
+                 "ip": 0,
+                 "op": 10,
+                 "ks": {
+                   "o": { "a": 1, "k": [ { "t": 0, "s": [0] }, { "t": 9, "s": [100] } ] }
+                 }
+               }
+             ]
+           })";
+
+    auto asset = sk_make_sp<TestAsset>();
+    auto anim = Animation::Builder(Animation::Builder::kAllowInstancing)
+                    .setResourceProvider(sk_make_sp<TestResourceProvider>(asset))
+                    .make(json, strlen(json));
+    REPORTER_ASSERT(r, anim);
+    REPORTER_ASSERT(r, asset->frames() == 1);
+
+    static constexpr int kThreads = 8;
+    SkColor colors[kThreads] = {};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; i++) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 10; j++) {
+                auto instance = anim->makeInstance();
+                if (!instance) {
+                    return;
+                }
+                instance->seekFrame(9);
+
+                SkBitmap bm;
+                bm.allocN32Pixels(10, 10);
+                bm.eraseColor(SK_ColorTRANSPARENT);
+                SkCanvas canvas(bm);
+                instance->render(&canvas);
+                colors[i] = bm.getColor(5, 5);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Every instance reused the image decoded when anim was built.
+    REPORTER_ASSERT(r, asset->frames() == 1);
+    REPORTER_ASSERT(r, !asset->overlapped());
+    for (SkColor color : colors) {
+        REPORTER_ASSERT(r, color == SK_ColorGREEN);
+    }
+}
@@ -13,10 +13,17 @@
 
 namespace skottie::internal {
 
+AnimatablePropertyContainer::AnimatablePropertyContainer() = default;
+AnimatablePropertyContainer::~AnimatablePropertyContainer() = default;
+
 Animator::StateChanged AnimatablePropertyContainer::onSeek(float t) {
     // The very first seek must trigger a sync, to ensure proper SG setup.
     bool changed = !fHasSynced;
 
+    // Keyframed properties are independent of each other and of the remaining animators,
+    // so they can be evaluated in a single batch.
+    changed |= KeyframeAnimator::SeekBatch(fKeyframeAnimators, t);
+
     for (const auto& animator : fAnimators) {
         changed |= animator->seek(t);
     }
@@ -45,6 +52,7 @@ void AnimatablePropertyContainer::attachDiscardableAdapter(
 
 void AnimatablePropertyContainer::shrink_to_fit() {
     fAnimators.shrink_to_fit();
+    fKeyframeAnimators.shrink_to_fit();
 }
 
 bool AnimatablePropertyContainer::bindImpl(const AnimationBuilder& abuilder,
@@ -106,7 +114,7 @@ bool AnimatablePropertyContainer::bindImpl(const AnimationBuilder& abuilder,
         // as an animated property - apply immediately and discard the animator.
         animator->seek(0);
     } else {
-        fAnimators.push_back(std::move(animator));
+        fKeyframeAnimators.push_back(std::move(animator));
     }
 
     return true;
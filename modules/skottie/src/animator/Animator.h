@@ -25,6 +25,7 @@ namespace internal {
 
 class AnimationBuilder;
 class AnimatorBuilder;
+class KeyframeAnimator;
 
 class Animator : public SkRefCnt {
 public:
@@ -43,6 +44,8 @@ private:
 
 class AnimatablePropertyContainer : public Animator {
 public:
+    ~AnimatablePropertyContainer() override;
+
     // This is the workhorse for property binding: depending on whether the property is animated,
     // it will either apply immediately or instantiate and attach a keyframe animator, scoped to
     // this container.
@@ -60,9 +63,11 @@ public:
                             const skjson::ObjectValue* jobject,
                             SkV2* v, float* orientation);
 
-    bool isStatic() const { return fAnimators.empty(); }
+    bool isStatic() const { return fAnimators.empty() && fKeyframeAnimators.empty(); }
 
 protected:
+    AnimatablePropertyContainer();
+
     virtual void onSync() = 0;
 
     void shrink_to_fit();
@@ -74,8 +79,9 @@ private:
 
     bool bindImpl(const AnimationBuilder&, const skjson::ObjectValue*, AnimatorBuilder&);
 
-    std::vector<sk_sp<Animator>> fAnimators;
-    bool                         fHasSynced = false;
+    std::vector<sk_sp<Animator>>         fAnimators;
+    std::vector<sk_sp<KeyframeAnimator>> fKeyframeAnimators; // Seeked as a batch.
+    bool                                 fHasSynced = false;
 };
 
 } // namespace internal
@@ -7,16 +7,147 @@
 
 #include "modules/skottie/src/animator/KeyframeAnimator.h"
 
+#include "include/private/SkTPin.h"
+#include "include/private/SkVx.h"
 #include "modules/skottie/src/SkottieJson.h"
 
 #define DUMP_KF_RECORDS 0
 
 namespace skottie::internal {
 
+namespace {
+
+// Batched equivalent of SkCubicMap::computeYFromX(), for four mappers at once.  This is the same
+// Halley iteration as SkOpts::cubic_solver(), where lanes stop updating once they have converged.
+skvx::float4 compute_y_from_x(const skvx::float4 X[3], const skvx::float4 Y[3],
+                              const skvx::float4& x) {
+    auto t = x;
+    for (int iters = 0; iters < 8; ++iters) {
+        const auto f = ((X[0]*t + X[1])*t + X[2])*t - x;   // f   = At^3 + Bt^2 + Ct - x
+        const auto active = skvx::abs(f) > 0.00005f;
+        if (!skvx::any(active)) {
+            break;
+        }
+        const auto fp  = (3*X[0]*t + 2*X[1])*t + X[2];     // f'  = 3At^2 + 2Bt + C
+        const auto fpp = 6*X[0]*t + 2*X[1];                // f'' = 6At + 2B
+
+        t = skvx::if_then_else(active, t - (2*fp*f) / (2*fp*fp - f*fpp), t);
+    }
+
+    const auto y = ((Y[0]*t + Y[1])*t + Y[2])*t;
+
+    // Like SkCubicMap, pass through values at the very ends of the range.
+    return skvx::if_then_else((x <= 0.0000000001f) | (1 - x <= 0.0000000001f), x, y);
+}
+
+} // namespace
+
+CubicMapper::CubicMapper(SkPoint c0, SkPoint c1) : fMap(c0, c1) {
+    // Mirror SkCubicMap's coefficients: X values are clamped, Ys may fall outside [0..1].
+    c0.fX = SkTPin(c0.fX, 0.0f, 1.0f);
+    c1.fX = SkTPin(c1.fX, 0.0f, 1.0f);
+
+    const auto s0 = skvx::float2::Load(&c0) * 3,
+               s1 = skvx::float2::Load(&c1) * 3,
+               k0 = 1 + s0 - s1,
+               k1 = s1 - s0 - s0,
+               k2 = s0;
+
+    fX[0] = k0[0]; fX[1] = k1[0]; fX[2] = k2[0];
+    fY[0] = k0[1]; fY[1] = k1[1]; fY[2] = k2[1];
+
+    // Linear mappers are never instantiated (see AnimatorBuilder::parseMapping), which leaves the
+    // cube root case (At^3 == x) as the only one not requiring the solver.
+    fNeedsSolver = std::abs(fX[1]) > 0.0000001f || std::abs(fX[2]) > 0.0000001f;
+}
+
 KeyframeAnimator::~KeyframeAnimator() = default;
 
+Animator::StateChanged KeyframeAnimator::SeekBatch(SkSpan<const sk_sp<KeyframeAnimator>> animators,
+                                                   float t) {
+    static constexpr size_t kLanes = 4;
+
+    // Pending cubic mappings, in SoA form.
+    KeyframeAnimator* pending[kLanes];
+    LERPInfo          pending_info[kLanes];
+    float             x[kLanes], X[3][kLanes], Y[3][kLanes];
+    size_t            pending_count = 0;
+
+    bool changed = false;
+
+    const auto flush = [&]() {
+        // Unused lanes replicate the first one.
+        for (size_t i = pending_count; i < kLanes; ++i) {
+            x[i] = x[0];
+            for (size_t j = 0; j < 3; ++j) {
+                X[j][i] = X[j][0];
+                Y[j][i] = Y[j][0];
+            }
+        }
+
+        const skvx::float4 vX[] = { skvx::float4::Load(X[0]),
+                                    skvx::float4::Load(X[1]),
+                                    skvx::float4::Load(X[2]) },
+                           vY[] = { skvx::float4::Load(Y[0]),
+                                    skvx::float4::Load(Y[1]),
+                                    skvx::float4::Load(Y[2]) };
+        float y[kLanes];
+        compute_y_from_x(vX, vY, skvx::float4::Load(x)).store(y);
+
+        for (size_t i = 0; i < pending_count; ++i) {
+            pending_info[i].weight = y[i];
+            changed |= pending[i]->onApplyLERP(pending_info[i]);
+        }
+        pending_count = 0;
+    };
+
+    for (const auto& animator : animators) {
+        const CubicMapper* cm = nullptr;
+        auto lerp_info = animator->getLinearLERPInfo(t, &cm);
+
+        if (!cm || !cm->fNeedsSolver) {
+            if (cm) {
+                lerp_info.weight = cm->computeYFromX(lerp_info.weight);
+            }
+            changed |= animator->onApplyLERP(lerp_info);
+            continue;
+        }
+
+        pending[pending_count]      = animator.get();
+        pending_info[pending_count] = lerp_info;
+        x[pending_count] = lerp_info.weight;
+        for (size_t j = 0; j < 3; ++j) {
+            X[j][pending_count] = cm->fX[j];
+            Y[j][pending_count] = cm->fY[j];
+        }
+
+        if (++pending_count == kLanes) {
+            flush();
+        }
+    }
+
+    if (pending_count) {
+        flush();
+    }
+
+    return changed;
+}
+
 KeyframeAnimator::LERPInfo KeyframeAnimator::getLERPInfo(float t) const {
+    const CubicMapper* cm = nullptr;
+    auto lerp_info = this->getLinearLERPInfo(t, &cm);
+
+    if (cm) {
+        lerp_info.weight = cm->computeYFromX(lerp_info.weight);
+    }
+
+    return lerp_info;
+}
+
+KeyframeAnimator::LERPInfo KeyframeAnimator::getLinearLERPInfo(float t,
+                                                               const CubicMapper** cm) const {
     SkASSERT(!fKFs.empty());
+    SkASSERT(!*cm);
 
     if (t <= fKFs.front().t) {
         // Constant/clamped segment.
@@ -38,6 +169,13 @@ KeyframeAnimator::LERPInfo KeyframeAnimator::getLERPInfo(float t) const {
         return { 0, fCurrentSegment.kf0->v, fCurrentSegment.kf0->v };
     }
 
+    // Optional cubic mapper.
+    if (fCurrentSegment.kf0->mapping >= Keyframe::kCubicIndexOffset) {
+        const auto mapper_index =
+                SkToSizeT(fCurrentSegment.kf0->mapping - Keyframe::kCubicIndexOffset);
+        *cm = &fCMs[mapper_index];
+    }
+
     return {
         this->compute_weight(fCurrentSegment, t),
         fCurrentSegment.kf0->v,
@@ -73,16 +211,7 @@ KeyframeAnimator::KFSegment KeyframeAnimator::find_segment(float t) const {
 float KeyframeAnimator::compute_weight(const KFSegment &seg, float t) const {
     SkASSERT(seg.contains(t));
 
-    // Linear weight.
-    auto w = (t - seg.kf0->t) / (seg.kf1->t - seg.kf0->t);
-
-    // Optional cubic mapper.
-    if (seg.kf0->mapping >= Keyframe::kCubicIndexOffset) {
-        const auto mapper_index = SkToSizeT(seg.kf0->mapping - Keyframe::kCubicIndexOffset);
-        w = fCMs[mapper_index].computeYFromX(w);
-    }
-
-    return w;
+    return (t - seg.kf0->t) / (seg.kf1->t - seg.kf0->t);
 }
 
 AnimatorBuilder::~AnimatorBuilder() = default;
@@ -10,6 +10,7 @@
 
 #include "include/core/SkCubicMap.h"
 #include "include/core/SkPoint.h"
+#include "include/core/SkSpan.h"
 #include "include/private/SkNoncopyable.h"
 #include "modules/skottie/include/Skottie.h"
 #include "modules/skottie/src/animator/Animator.h"
@@ -59,10 +60,32 @@ struct Keyframe {
     inline static constexpr uint32_t kCubicIndexOffset = 2;
 };
 
+// Cubic mapper (Bezier interpolation) for a keyframe segment.  In addition to the SkCubicMap used
+// for individual lookups, it retains the polynomial coefficients such that batched seeks can solve
+// several mappers at once (see KeyframeAnimator::SeekBatch).
+class CubicMapper {
+public:
+    CubicMapper(SkPoint c0, SkPoint c1);
+
+    float computeYFromX(float x) const { return fMap.computeYFromX(x); }
+
+private:
+    friend class KeyframeAnimator;
+
+    SkCubicMap fMap;
+    float      fX[3],       // x(t) = fX[0]*t^3 + fX[1]*t^2 + fX[2]*t
+               fY[3];       // y(t) = fY[0]*t^3 + fY[1]*t^2 + fY[2]*t
+    bool       fNeedsSolver; // False for mappers which SkCubicMap inverts in closed form.
+};
+
 class KeyframeAnimator : public Animator {
 public:
     ~KeyframeAnimator() override;
 
+    // Seeks several keyframe animators to the same |t|.  Equivalent to seeking them one at a time,
+    // except that the cubic mappers of all active segments are solved together, four at a time.
+    static StateChanged SeekBatch(SkSpan<const sk_sp<KeyframeAnimator>>, float t);
+
     bool isConstant() const {
         SkASSERT(!fKFs.empty());
 
@@ -71,7 +94,7 @@ public:
     }
 
 protected:
-    KeyframeAnimator(std::vector<Keyframe> kfs, std::vector<SkCubicMap> cms)
+    KeyframeAnimator(std::vector<Keyframe> kfs, std::vector<CubicMapper> cms)
         : fKFs(std::move(kfs))
         , fCMs(std::move(cms)) {}
 
@@ -83,7 +106,16 @@ protected:
     // Main entry point: |t| -> LERPInfo
     LERPInfo getLERPInfo(float t) const;
 
+    // Updates the target value for a given LERPInfo.
+    virtual StateChanged onApplyLERP(const LERPInfo&) = 0;
+
 private:
+    StateChanged onSeek(float t) final { return this->onApplyLERP(this->getLERPInfo(t)); }
+
+    // Same as getLERPInfo(), but leaves out the cubic mapping of the weight: when the segment
+    // uses a cubic mapper, it is returned via |cm| and LERPInfo::weight is the linear weight.
+    LERPInfo getLinearLERPInfo(float t, const CubicMapper** cm) const;
+
     // Two sequential KFRecs determine how the value varies within [kf0 .. kf1)
     struct KFSegment {
         const Keyframe* kf0;
@@ -100,12 +132,12 @@ private:
     // Find the KFSegment containing |t|.
     KFSegment find_segment(float t) const;
 
-    // Given a |t| and a containing KFSegment, compute the local interpolation weight.
+    // Given a |t| and a containing KFSegment, compute the local linear interpolation weight.
     float compute_weight(const KFSegment& seg, float t) const;
 
-    const std::vector<Keyframe>   fKFs; // Keyframe records, one per AE/Lottie keyframe.
-    const std::vector<SkCubicMap> fCMs; // Optional cubic mappers (Bezier interpolation).
-    mutable KFSegment             fCurrentSegment = { nullptr, nullptr }; // Cached segment.
+    const std::vector<Keyframe>    fKFs; // Keyframe records, one per AE/Lottie keyframe.
+    const std::vector<CubicMapper> fCMs; // Optional cubic mappers (Bezier interpolation).
+    mutable KFSegment              fCurrentSegment = { nullptr, nullptr }; // Cached segment.
 };
 
 class AnimatorBuilder : public SkNoncopyable {
@@ -130,8 +162,8 @@ protected:
 
     bool parseKeyframes(const AnimationBuilder&, const skjson::ArrayValue&);
 
-    std::vector<Keyframe>   fKFs; // Keyframe records, one per AE/Lottie keyframe.
-    std::vector<SkCubicMap> fCMs; // Optional cubic mappers (Bezier interpolation).
+    std::vector<Keyframe>    fKFs; // Keyframe records, one per AE/Lottie keyframe.
+    std::vector<CubicMapper> fCMs; // Optional cubic mappers (Bezier interpolation).
 
 private:
     uint32_t parseMapping(const skjson::ObjectValue&);
@@ -18,15 +18,14 @@ namespace  {
 class ScalarKeyframeAnimator final : public KeyframeAnimator {
 public:
     ScalarKeyframeAnimator(std::vector<Keyframe> kfs,
-                           std::vector<SkCubicMap> cms,
+                           std::vector<CubicMapper> cms,
                            ScalarValue* target_value)
         : INHERITED(std::move(kfs), std::move(cms))
         , fTarget(target_value) {}
 
 private:
 
-    StateChanged onSeek(float t) override {
-        const auto& lerp_info = this->getLERPInfo(t);
+    StateChanged onApplyLERP(const LERPInfo& lerp_info) override {
         const auto  old_value = *fTarget;
 
         *fTarget = Lerp(lerp_info.vrec0.flt, lerp_info.vrec1.flt, lerp_info.weight);
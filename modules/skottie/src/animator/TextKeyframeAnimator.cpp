@@ -15,16 +15,14 @@ namespace skottie::internal {
 namespace  {
 class TextKeyframeAnimator final : public KeyframeAnimator {
 public:
-    TextKeyframeAnimator(std::vector<Keyframe> kfs, std::vector<SkCubicMap> cms,
+    TextKeyframeAnimator(std::vector<Keyframe> kfs, std::vector<CubicMapper> cms,
                          std::vector<TextValue> vs, TextValue* target_value)
         : INHERITED(std::move(kfs), std::move(cms))
         , fValues(std::move(vs))
         , fTarget(target_value) {}
 
 private:
-    StateChanged onSeek(float t) override {
-        const auto& lerp_info = this->getLERPInfo(t);
-
+    StateChanged onApplyLERP(const LERPInfo& lerp_info) override {
         // Text value keyframes are treated as selectors, not as interpolated values.
         if (*fTarget != fValues[SkToSizeT(lerp_info.vrec0.idx)]) {
             *fTarget = fValues[SkToSizeT(lerp_info.vrec0.idx)];
@@ -26,7 +26,7 @@ public:
         sk_sp<SkContourMeasure> cmeasure;
     };
 
-    Vec2KeyframeAnimator(std::vector<Keyframe> kfs, std::vector<SkCubicMap> cms,
+    Vec2KeyframeAnimator(std::vector<Keyframe> kfs, std::vector<CubicMapper> cms,
                          std::vector<SpatialValue> vs, Vec2Value* vec_target, float* rot_target)
         : INHERITED(std::move(kfs), std::move(cms))
         , fValues(std::move(vs))
@@ -48,10 +48,8 @@ private:
         return changed;
     }
 
-    StateChanged onSeek(float t) override {
-        auto get_lerp_info = [this](float t) {
-            auto lerp_info = this->getLERPInfo(t);
-
+    StateChanged onApplyLERP(const LERPInfo& info) override {
+        auto adjust_lerp_info = [this](LERPInfo lerp_info) {
             // When tracking rotation/orientation, the last keyframe requires special handling:
             // it doesn't store any spatial information but it is expected to maintain the
             // previous orientation (per AE semantics).
@@ -75,7 +73,7 @@ private:
             return lerp_info;
         };
 
-        const auto lerp_info = get_lerp_info(t);
+        const auto lerp_info = adjust_lerp_info(info);
 
         const auto& v0 = fValues[lerp_info.vrec0.idx];
         if (v0.cmeasure) {
@@ -73,7 +73,7 @@ namespace {
 class VectorKeyframeAnimator final : public KeyframeAnimator {
 public:
     VectorKeyframeAnimator(std::vector<Keyframe> kfs,
-                           std::vector<SkCubicMap> cms,
+                           std::vector<CubicMapper> cms,
                            std::vector<float> storage,
                            size_t vec_len,
                            std::vector<float>* target_value)
@@ -87,9 +87,7 @@ public:
     }
 
 private:
-    StateChanged onSeek(float t) override {
-        const auto& lerp_info = this->getLERPInfo(t);
-
+    StateChanged onApplyLERP(const LERPInfo& lerp_info) override {
         SkASSERT(lerp_info.vrec0.idx + fVecLen <= fStorage.size());
         SkASSERT(lerp_info.vrec1.idx + fVecLen <= fStorage.size());
         SkASSERT(fTarget->size() == fVecLen);
@@ -75,7 +75,7 @@ private:
 
 } // namespace
 
-const AnimationBuilder::FootageAssetInfo*
+AnimationBuilder::FootageAssetInfo*
 AnimationBuilder::loadFootageAsset(const skjson::ObjectValue& jimage) const {
     const skjson::StringValue* name = jimage["p"];
     const skjson::StringValue* path = jimage["u"];
@@ -98,12 +98,12 @@ AnimationBuilder::loadFootageAsset(const skjson::ObjectValue& jimage) const {
 
     const auto size = SkISize::Make(ParseDefault<int>(jimage["w"], 0),
                                     ParseDefault<int>(jimage["h"], 0));
-    return fImageAssetCache.set(res_id, { std::move(asset), size });
+    return fImageAssetCache.set(res_id, { std::move(asset), size, {} });
 }
 
 sk_sp<sksg::RenderNode> AnimationBuilder::attachFootageAsset(const skjson::ObjectValue& jimage,
                                                              LayerInfo* layer_info) const {
-    const auto* asset_info = this->loadFootageAsset(jimage);
+    auto* asset_info = this->loadFootageAsset(jimage);
     if (!asset_info) {
         return nullptr;
     }
@@ -127,8 +127,12 @@ sk_sp<sksg::RenderNode> AnimationBuilder::attachFootageAsset(const skjson::Objec
                                                                      -layer_info->fInPoint,
                                                                      1 / fFrameRate));
     } else {
-        // No animator needed, resolve the (only) frame upfront.
-        auto frame_data = asset_info->fAsset->getFrameData(0);
+        // No animator needed, resolve the (only) frame upfront.  This happens once per asset:
+        // instances share the result (see shareResources()) and never call into the asset.
+        if (!asset_info->fFrameData.image) {
+            asset_info->fFrameData = asset_info->fAsset->getFrameData(0);
+        }
+        auto frame_data = asset_info->fFrameData;
         if (!frame_data.image) {
             this->log(Logger::Level::kError, nullptr, "Could not load single-frame image asset.");
             return nullptr;
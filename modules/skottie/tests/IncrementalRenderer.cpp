@@ -0,0 +1,69 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+#include "modules/skottie/include/Skottie.h"
+#include "modules/skottie/utils/SkottieUtils.h"
+#include "tests/Test.h"
+#include "tools/Resources.h"
+
+using namespace skottie;
+
+DEF_TEST(Skottie_IncrementalRenderer, r) {
+    static constexpr const char* kAnimations[] = {
+        "skottie/skottie-dropshadow-style.json",   // drop shadow layer style
+        "skottie/skottie-effects-tranform.json",   // drop shadow effect
+        "skottie/skottie-directional-blur.json",
+        "skottie/skottie-outerglow-style.json",
+    };
+    static constexpr SkISize kSize = {128, 128};
+    static constexpr int     kMaxFrames = 100;
+
+    for (const char* path : kAnimations) {
+        auto data = GetResourceAsData(path);
+        if (!data) {
+            continue;
+        }
+        auto anim = Animation::Make(static_cast<const char*>(data->data()), data->size());
+        REPORTER_ASSERT(r, anim, "%s", path);
+        if (!anim) {
+            continue;
+        }
+
+        auto renderer = skottie_utils::IncrementalRenderer::Make(anim, kSize);
+        REPORTER_ASSERT(r, renderer);
+
+        SkBitmap incremental, full;
+        incremental.allocN32Pixels(kSize.width(), kSize.height());
+        full.allocN32Pixels(kSize.width(), kSize.height());
+        const auto dst = SkRect::Make(kSize);
+
+        // The renderer only redraws the damaged area on top of the previous frame. That should
+        // always produce the same pixels as drawing the whole frame from scratch.
+        const auto frames = static_cast<int>(anim->outPoint() - anim->inPoint());
+        const auto step   = std::max(1, frames / kMaxFrames);
+        for (int frame = 0; frame < frames; frame += step) {
+            renderer->renderFrame(frame);
+            REPORTER_ASSERT(r, renderer->surface()->readPixels(incremental, 0, 0));
+
+            full.eraseColor(SK_ColorTRANSPARENT);
+            SkCanvas canvas(full);
+            anim->render(&canvas, &dst);
+
+            for (int y = 0; y < kSize.height(); ++y)
+            for (int x = 0; x < kSize.width(); ++x) {
+                if (*incremental.getAddr32(x, y) != *full.getAddr32(x, y)) {
+                    ERRORF(r, "%s, frame %d: pixel (%d, %d) is %08x incrementally, %08x in full",
+                           path, frame, x, y, *incremental.getAddr32(x, y), *full.getAddr32(x, y));
+                    return;
+                }
+            }
+        }
+    }
+}
@@ -5,6 +5,9 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkCubicMap.h"
+#include "include/core/SkString.h"
+#include "include/private/SkTPin.h"
 #include "modules/skottie/include/ExternalLayer.h"
 #include "modules/skottie/src/SkottiePriv.h"
 #include "modules/skottie/src/SkottieValue.h"
@@ -13,6 +16,7 @@
 #include "tests/Test.h"
 
 #include <cmath>
+#include <vector>
 
 using namespace skottie;
 using namespace skottie::internal;
@@ -41,6 +45,30 @@ private:
     bool  fDidBind;
 };
 
+// Binds several scalar properties to the same container, such that they are seeked as a batch.
+class MockProperties final : public AnimatablePropertyContainer {
+public:
+    explicit MockProperties(const std::vector<SkString>& jprops) : fValues(jprops.size()) {
+        AnimationBuilder abuilder(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                  nullptr, {100, 100}, 10, 1, 0);
+        fDidBind = true;
+        for (size_t i = 0; i < jprops.size(); ++i) {
+            skjson::DOM json_dom(jprops[i].c_str(), jprops[i].size());
+            fDidBind &= this->bind(abuilder, json_dom.root(), &fValues[i]);
+        }
+    }
+
+    explicit operator bool() const { return fDidBind; }
+
+    const std::vector<ScalarValue>& operator()(float t) { this->seek(t); return fValues; }
+
+private:
+    void onSync() override {}
+
+    std::vector<ScalarValue> fValues;
+    bool                     fDidBind;
+};
+
 }  // namespace
 
 DEF_TEST(Skottie_Keyframe, reporter) {
@@ -168,3 +196,55 @@ DEF_TEST(Skottie_Keyframe, reporter) {
         REPORTER_ASSERT(reporter, SkScalarNearlyEqual(prop(0).y, 2));
     }
 }
+
+DEF_TEST(Skottie_KeyframeBatch, reporter) {
+    // A mix of cubic mappers (including one which SkCubicMap resolves as a cube root), a linear
+    // and a hold segment: the batched seek must match individually mapped keyframes.
+    static constexpr struct {
+        SkPoint c0, c1;
+        bool    hold;
+    } kMappings[] = {
+        {{ 0.42f,  0    }, { 0.58f, 1     }, false },
+        {{ 0.33f,  0    }, { 0.67f, 1     }, false },
+        {{ 0.17f,  0.67f}, { 0.83f, 0.33f }, false },
+        {{ 0,      0.5f }, { 0,     1     }, false },
+        {{ 0.68f, -0.55f}, { 0.27f, 1.55f }, false },
+        {{ 0.25f,  0.25f}, { 0.75f, 0.75f }, false },
+        {{ 0.9f,   0.1f }, { 0.1f,  0.9f  }, false },
+        {{ 0.5f,   0    }, { 0.5f,  1     }, true  },
+        {{ 0.1f,   0.9f }, { 0.2f,  1     }, false },
+    };
+
+    std::vector<SkString> jprops;
+    for (const auto& m : kMappings) {
+        jprops.push_back(SkStringPrintf(R"({
+                                          "a": 1,
+                                          "k": [
+                                            { "t": 1, "s": 0, "h": %d,
+                                              "o": { "x": %f, "y": %f },
+                                              "i": { "x": %f, "y": %f } },
+                                            { "t": 3, "s": 100 }
+                                          ]
+                                        })", m.hold, m.c0.fX, m.c0.fY, m.c1.fX, m.c1.fY));
+    }
+
+    MockProperties props(jprops);
+    REPORTER_ASSERT(reporter, props);
+    REPORTER_ASSERT(reporter, !props.isStatic());
+
+    for (float t = 0; t <= 4; t += 0.0625f) {
+        const auto& values = props(t);
+        const auto  x = SkTPin((t - 1) / 2, 0.0f, 1.0f);
+
+        for (size_t i = 0; i < SK_ARRAY_COUNT(kMappings); ++i) {
+            const auto& m = kMappings[i];
+            const auto expected = m.hold
+                ? (t < 3 ? 0 : 100)
+                : 100 * SkCubicMap(m.c0, m.c1).computeYFromX(x);
+
+            REPORTER_ASSERT(reporter, SkScalarNearlyEqual(values[i], expected, 0.001f),
+                            "mapping %zu, t: %g, value: %g, expected: %g",
+                            i, t, values[i], expected);
+        }
+    }
+}
@@ -7,6 +7,9 @@
 
 #include "modules/skottie/utils/SkottieUtils.h"
 
+#include "include/core/SkCanvas.h"
+#include "modules/sksg/include/SkSGInvalidationController.h"
+
 namespace skottie_utils {
 
 class CustomPropertyManager::PropertyInterceptor final : public skottie::PropertyObserver {
@@ -251,4 +254,51 @@ sk_sp<skottie::ExternalLayer> ExternalAnimationPrecompInterceptor::onLoadPrecomp
                 : nullptr;
 }
 
+std::unique_ptr<IncrementalRenderer> IncrementalRenderer::Make(sk_sp<skottie::Animation> anim,
+                                                               const SkISize& size) {
+    if (!anim) {
+        return nullptr;
+    }
+
+    auto surface = SkSurface::MakeRasterN32Premul(size.width(), size.height());
+    if (!surface) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<IncrementalRenderer>(
+                new IncrementalRenderer(std::move(anim), std::move(surface)));
+}
+
+IncrementalRenderer::IncrementalRenderer(sk_sp<skottie::Animation> anim,
+                                         sk_sp<SkSurface> surface)
+    : fAnimation(std::move(anim))
+    , fSurface(std::move(surface))
+    , fDst(SkRect::MakeIWH(fSurface->width(), fSurface->height()))
+    // Same mapping as skottie::Animation::render().
+    , fMatrix(SkMatrix::RectToRect(SkRect::MakeSize(fAnimation->size()), fDst,
+                                   SkMatrix::kCenter_ScaleToFit)) {}
+
+const SkRegion& IncrementalRenderer::renderFrame(double t) {
+    sksg::InvalidationController ic;
+    fAnimation->seekFrame(t, &ic);
+
+    const auto bounds = SkIRect::MakeWH(fSurface->width(), fSurface->height());
+
+    // Without a previous frame to build upon, everything needs to be drawn.
+    fDamage = fHasContent ? ic.computeDamage(fMatrix, bounds)
+                          : SkRegion(bounds);
+    fHasContent = true;
+
+    if (!fDamage.isEmpty()) {
+        auto* canvas = fSurface->getCanvas();
+        SkAutoCanvasRestore acr(canvas, true);
+
+        canvas->clipRegion(fDamage);
+        canvas->clear(SK_ColorTRANSPARENT);
+        fAnimation->render(canvas, &fDst);
+    }
+
+    return fDamage;
+}
+
 } // namespace skottie_utils
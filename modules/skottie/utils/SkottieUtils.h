@@ -8,6 +8,8 @@
 #ifndef SkottieUtils_DEFINED
 #define SkottieUtils_DEFINED
 
+#include "include/core/SkRegion.h"
+#include "include/core/SkSurface.h"
 #include "modules/skottie/include/ExternalLayer.h"
 #include "modules/skottie/include/Skottie.h"
 #include "modules/skottie/include/SkottieProperty.h"
@@ -126,6 +128,35 @@ private:
     const SkString                             fPrefix;
 };
 
+/**
+ * Renders an animation into a raster surface which retains its content between frames.
+ *
+ * Each frame only redraws the area damaged since the previous one (as tracked by the scene graph,
+ * see sksg::InvalidationController::computeDamage), on top of the previous frame's pixels.  For
+ * mostly static animations this skips most of the raster work.
+ *
+ * The animation must not be seeked through other means while attached to the renderer.
+ */
+class IncrementalRenderer final {
+public:
+    static std::unique_ptr<IncrementalRenderer> Make(sk_sp<skottie::Animation>, const SkISize&);
+
+    // Seeks the animation to frame |t| (see skottie::Animation::seekFrame()) and brings the
+    // surface up to date.  Returns the device area which was redrawn.
+    const SkRegion& renderFrame(double t);
+
+    SkSurface* surface() const { return fSurface.get(); }
+
+private:
+    IncrementalRenderer(sk_sp<skottie::Animation>, sk_sp<SkSurface>);
+
+    const sk_sp<skottie::Animation> fAnimation;
+    const sk_sp<SkSurface>          fSurface;
+    const SkRect                    fDst;
+    const SkMatrix                  fMatrix;     // animation -> surface coordinates
+    SkRegion                        fDamage;
+    bool                            fHasContent = false;
+};
 
 } // namespace skottie_utils
 
@@ -2,9 +2,12 @@
 #ifndef ParagraphCache_DEFINED
 #define ParagraphCache_DEFINED
 
+#include "include/core/SkSpan.h"
 #include "include/private/SkMutex.h"
+#include "modules/skshaper/include/SkShaper.h"
 #include "src/core/SkLRUCache.h"
 #include <functional>  // std::function
+#include <memory>
 
 #define PARAGRAPH_CACHE_STATS
 
@@ -24,6 +27,7 @@ enum InternalState {
 class ParagraphImpl;
 class ParagraphCacheKey;
 class ParagraphCacheValue;
+class ShapedRunCache;
 
 class ParagraphCache {
 public:
@@ -45,6 +49,20 @@ public:
 
     bool isPossiblyTextEditing(ParagraphImpl* paragraph);
 
+    // Shaped runs are cached on their own as well, keyed by the run's text, font, bidi level,
+    // language and font features. A paragraph that misses the cache above (after an edit, for
+    // instance) replays the runs it shares with earlier paragraphs and only reshapes the rest.
+    using ShapeRunsProc = std::function<void(SkShaper::RunHandler*)>;
+    void shapeRuns(SkSpan<const char> utf8, const SkFont& font, uint8_t bidiLevel,
+                   const SkString& language, SkSpan<const SkShaper::Feature> features,
+                   SkShaper::RunHandler* handler, const ShapeRunsProc& shape);
+
+    // The shaped run cache is limited by the memory its glyphs take rather than by count
+    void setShapedRunCacheLimit(size_t bytes);
+    size_t getShapedRunCacheLimit() const;
+    size_t getShapedRunCacheUsed() const;
+    int shapedRunCount() const;
+
  private:
 
     struct Entry;
@@ -63,6 +81,7 @@ public:
     SkLRUCache<ParagraphCacheKey, std::unique_ptr<Entry>, KeyHash> fLRUCacheMap;
     bool fCacheIsOn;
     ParagraphCacheValue* fLastCachedValue;
+    std::unique_ptr<ShapedRunCache> fShapedRunCache;
 
 #ifdef PARAGRAPH_CACHE_STATS
     int fTotalRequests;
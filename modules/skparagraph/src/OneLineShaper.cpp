@@ -720,10 +720,16 @@ bool OneLineShaper::shape() {
                         }
                     }
 
-                    shaper->shape(unresolvedText.begin(), unresolvedText.size(),
-                            fontIter, bidiIter,*scriptIter, langIter,
-                            adjustedFeatures.data(), adjustedFeatures.size(),
-                            limitlessWidth, this);
+                    // Only the runs that were not shaped before with the same font go to the
+                    // shaper; for the rest the cache replays the results into this handler
+                    fParagraph->fFontCollection->getParagraphCache()->shapeRuns(
+                            unresolvedText, font, defaultBidiLevel, block.fStyle.getLocale(),
+                            adjustedFeatures, this, [&](SkShaper::RunHandler* handler) {
+                        shaper->shape(unresolvedText.begin(), unresolvedText.size(),
+                                fontIter, bidiIter,*scriptIter, langIter,
+                                adjustedFeatures.data(), adjustedFeatures.size(),
+                                limitlessWidth, handler);
+                    });
 
                     // Take off the queue the block we tried to resolved -
                     // whatever happened, we have now smaller pieces of it to deal with
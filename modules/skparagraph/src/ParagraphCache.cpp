@@ -4,6 +4,7 @@
 #include "modules/skparagraph/include/FontArguments.h"
 #include "modules/skparagraph/include/ParagraphCache.h"
 #include "modules/skparagraph/src/ParagraphImpl.h"
+#include "src/core/SkTInternalLList.h"
 
 namespace skia {
 namespace textlayout {
@@ -22,6 +23,13 @@ namespace {
     bool exactlyEqual(SkScalar x, SkScalar y) {
         return x == y || (x != x && y != y);
     }
+
+    uint32_t mix(uint32_t hash, uint32_t data) {
+        hash += data;
+        hash += (hash << 10);
+        hash ^= (hash >> 6);
+        return hash;
+    }
 }  // namespace
 
 class ParagraphCacheKey {
@@ -52,7 +60,6 @@ public:
     const SkString& text() const { return fText; }
 
 private:
-    static uint32_t mix(uint32_t hash, uint32_t data);
     uint32_t computeHash() const;
 
     SkString fText;
@@ -96,13 +103,6 @@ public:
     TextIndex fTrailingSpaces;
 };
 
-uint32_t ParagraphCacheKey::mix(uint32_t hash, uint32_t data) {
-    hash += data;
-    hash += (hash << 10);
-    hash ^= (hash >> 6);
-    return hash;
-}
-
 uint32_t ParagraphCacheKey::computeHash() const {
     uint32_t hash = 0;
     for (auto& ph : fPlaceholders) {
@@ -233,6 +233,303 @@ bool ParagraphCacheKey::operator==(const ParagraphCacheKey& other) const {
     return true;
 }
 
+class ShapedRunKey {
+public:
+    ShapedRunKey(SkSpan<const char> utf8, const SkFont& font, uint8_t bidiLevel,
+                 const SkString& language, SkSpan<const SkShaper::Feature> features)
+        : fText(utf8.data(), utf8.size())
+        , fFont(font)
+        , fBidiLevel(bidiLevel)
+        , fLanguage(language)
+        , fFeatures(features.data(), SkToInt(features.size())) {
+        fHash = computeHash();
+    }
+
+    bool operator==(const ShapedRunKey& other) const;
+
+    uint32_t hash() const { return fHash; }
+
+    size_t bytes() const {
+        return fText.size() + fLanguage.size() + fFeatures.size() * sizeof(SkShaper::Feature);
+    }
+
+private:
+    uint32_t computeHash() const;
+
+    SkString fText;
+    SkFont fFont;
+    uint8_t fBidiLevel;
+    SkString fLanguage;
+    SkTArray<SkShaper::Feature, true> fFeatures;
+    uint32_t fHash;
+};
+
+uint32_t ShapedRunKey::computeHash() const {
+    uint32_t hash = 0;
+    hash = mix(hash, SkGoodHash()(fFont.getTypeface() ? fFont.getTypeface()->uniqueID() : 0));
+    hash = mix(hash, SkGoodHash()(fFont.getSize()));
+    hash = mix(hash, SkGoodHash()(fFont.getSkewX()));
+    hash = mix(hash, SkGoodHash()(fFont.isEmbolden()));
+    hash = mix(hash, SkGoodHash()(fBidiLevel));
+    hash = mix(hash, SkGoodHash()(fLanguage));
+    for (auto& feature : fFeatures) {
+        hash = mix(hash, SkGoodHash()(feature.tag));
+        hash = mix(hash, SkGoodHash()(feature.value));
+        hash = mix(hash, SkGoodHash()(feature.start));
+        hash = mix(hash, SkGoodHash()(feature.end));
+    }
+    hash = mix(hash, SkGoodHash()(fText));
+    return hash;
+}
+
+bool ShapedRunKey::operator==(const ShapedRunKey& other) const {
+    if (fHash != other.fHash || fText.size() != other.fText.size() ||
+        fFeatures.size() != other.fFeatures.size()) {
+        return false;
+    }
+    if (!(fFont == other.fFont) || fBidiLevel != other.fBidiLevel ||
+        fLanguage != other.fLanguage) {
+        return false;
+    }
+    for (int i = 0; i < fFeatures.count(); ++i) {
+        auto& fa = fFeatures[i];
+        auto& fb = other.fFeatures[i];
+        if (fa.tag != fb.tag || fa.value != fb.value ||
+            fa.start != fb.start || fa.end != fb.end) {
+            return false;
+        }
+    }
+    return fText == other.fText;
+}
+
+// Everything the shaper handed out for one text run, with the positions made relative to each
+// glyph run's origin so it can be replayed anywhere in a paragraph
+struct ShapedRunValue {
+    struct GlyphRun {
+        SkFont fFont;
+        uint8_t fBidiLevel;
+        SkVector fAdvance;
+        SkShaper::RunHandler::Range fUtf8Range;
+        SkTArray<SkGlyphID, true> fGlyphs;
+        SkTArray<SkPoint, true> fPositions;
+        SkTArray<SkPoint, true> fOffsets;
+        SkTArray<uint32_t, true> fClusters;
+    };
+
+    size_t bytes() const {
+        size_t bytes = fGlyphRuns.size() * sizeof(GlyphRun);
+        for (auto& run : fGlyphRuns) {
+            bytes += run.fGlyphs.size() * sizeof(SkGlyphID) +
+                     run.fPositions.size() * sizeof(SkPoint) +
+                     run.fOffsets.size() * sizeof(SkPoint) +
+                     run.fClusters.size() * sizeof(uint32_t);
+        }
+        return bytes;
+    }
+
+    SkTArray<GlyphRun> fGlyphRuns;
+};
+
+// Passes the shaper's output on to the paragraph's run handler, keeping a copy of it
+class ShapedRunRecorder final : public SkShaper::RunHandler {
+public:
+    explicit ShapedRunRecorder(SkShaper::RunHandler* handler) : fHandler(handler) { }
+
+    ShapedRunValue detach() { return std::move(fValue); }
+
+private:
+    void beginLine() override { fHandler->beginLine(); }
+    void runInfo(const RunInfo& info) override { fHandler->runInfo(info); }
+    void commitRunInfo() override { fHandler->commitRunInfo(); }
+    void commitLine() override { fHandler->commitLine(); }
+
+    Buffer runBuffer(const RunInfo& info) override {
+        fBuffer = fHandler->runBuffer(info);
+        return fBuffer;
+    }
+
+    void commitRunBuffer(const RunInfo& info) override {
+        auto count = SkToInt(info.glyphCount);
+        auto& run = fValue.fGlyphRuns.push_back();
+        run.fFont = info.fFont;
+        run.fBidiLevel = info.fBidiLevel;
+        run.fAdvance = info.fAdvance;
+        run.fUtf8Range = info.utf8Range;
+        run.fGlyphs.push_back_n(count, fBuffer.glyphs);
+        run.fPositions.push_back_n(count, fBuffer.positions);
+        for (auto& position : run.fPositions) {
+            position -= fBuffer.point;
+        }
+        if (fBuffer.offsets) {
+            run.fOffsets.push_back_n(count, fBuffer.offsets);
+        }
+        if (fBuffer.clusters) {
+            run.fClusters.push_back_n(count, fBuffer.clusters);
+        }
+        fHandler->commitRunBuffer(info);
+    }
+
+    SkShaper::RunHandler* fHandler;
+    Buffer fBuffer = {};
+    ShapedRunValue fValue;
+};
+
+class ShapedRunCache {
+public:
+    // Fits the runs of a few hundred short paragraphs
+    static constexpr size_t kDefaultLimit = 2 * 1024 * 1024;
+
+    ShapedRunCache() : fLimit(kDefaultLimit), fUsed(0) { }
+
+    ~ShapedRunCache() { this->reset(); }
+
+    // Replays the cached runs into the handler; returns false on a cache miss
+    bool find(const ShapedRunKey& key, SkShaper::RunHandler* handler) {
+        SkAutoMutexExclusive lock(fMutex);
+#ifdef PARAGRAPH_CACHE_STATS
+        ++fTotalRequests;
+#endif
+        Entry** found = fMap.find(key);
+        if (!found) {
+#ifdef PARAGRAPH_CACHE_STATS
+            ++fCacheMisses;
+#endif
+            return false;
+        }
+        Entry* entry = *found;
+        if (entry != fLRU.head()) {
+            fLRU.remove(entry);
+            fLRU.addToHead(entry);
+        }
+        replay(entry->fValue, handler);
+        return true;
+    }
+
+    void insert(ShapedRunKey&& key, ShapedRunValue&& value) {
+        auto bytes = sizeof(Entry) + key.bytes() + value.bytes();
+        SkAutoMutexExclusive lock(fMutex);
+        if (bytes > fLimit || fMap.find(key)) {
+            return;
+        }
+        Entry* entry = new Entry(std::move(key), std::move(value), bytes);
+        fMap.set(entry);
+        fLRU.addToHead(entry);
+        fUsed += bytes;
+        this->purge(fLimit);
+    }
+
+    void setLimit(size_t bytes) {
+        SkAutoMutexExclusive lock(fMutex);
+        fLimit = bytes;
+        this->purge(fLimit);
+    }
+
+    size_t limit() const {
+        SkAutoMutexExclusive lock(fMutex);
+        return fLimit;
+    }
+
+    size_t used() const {
+        SkAutoMutexExclusive lock(fMutex);
+        return fUsed;
+    }
+
+    int count() const {
+        SkAutoMutexExclusive lock(fMutex);
+        return fMap.count();
+    }
+
+    void reset() {
+        SkAutoMutexExclusive lock(fMutex);
+#ifdef PARAGRAPH_CACHE_STATS
+        fTotalRequests = 0;
+        fCacheMisses = 0;
+#endif
+        this->purge(0);
+    }
+
+    void printStatistics() const {
+#ifdef PARAGRAPH_CACHE_STATS
+        SkAutoMutexExclusive lock(fMutex);
+        SkDebugf("Shaped run requests: %d\n", fTotalRequests);
+        SkDebugf("Shaped run miss %%: %f\n",
+                 (fTotalRequests > 0) ? 100.f * fCacheMisses / fTotalRequests : 0.f);
+        SkDebugf("Shaped run memory: %zu of %zu bytes\n", fUsed, fLimit);
+#endif
+    }
+
+private:
+    struct Entry {
+        Entry(ShapedRunKey&& key, ShapedRunValue&& value, size_t bytes)
+            : fKey(std::move(key)), fValue(std::move(value)), fBytes(bytes) { }
+
+        ShapedRunKey fKey;
+        ShapedRunValue fValue;
+        size_t fBytes;
+
+        SK_DECLARE_INTERNAL_LLIST_INTERFACE(Entry);
+    };
+
+    struct Traits {
+        static const ShapedRunKey& GetKey(Entry* entry) { return entry->fKey; }
+        static uint32_t Hash(const ShapedRunKey& key) { return key.hash(); }
+    };
+
+    static void replay(const ShapedRunValue& value, SkShaper::RunHandler* handler) {
+        using RunInfo = SkShaper::RunHandler::RunInfo;
+        auto runInfo = [](const ShapedRunValue::GlyphRun& run) {
+            return RunInfo{run.fFont, run.fBidiLevel, run.fAdvance,
+                           SkToSizeT(run.fGlyphs.size()), run.fUtf8Range};
+        };
+
+        handler->beginLine();
+        for (auto& run : value.fGlyphRuns) {
+            handler->runInfo(runInfo(run));
+        }
+        handler->commitRunInfo();
+        for (auto& run : value.fGlyphRuns) {
+            const RunInfo info = runInfo(run);
+            const auto buffer = handler->runBuffer(info);
+            for (int i = 0; i < run.fGlyphs.size(); ++i) {
+                buffer.glyphs[i] = run.fGlyphs[i];
+                buffer.positions[i] = run.fPositions[i] + buffer.point;
+                if (buffer.offsets) {
+                    buffer.offsets[i] = run.fOffsets.empty() ? SkPoint{0, 0} : run.fOffsets[i];
+                } else if (!run.fOffsets.empty()) {
+                    buffer.positions[i] += run.fOffsets[i];
+                }
+                if (buffer.clusters) {
+                    buffer.clusters[i] = run.fClusters.empty() ? 0 : run.fClusters[i];
+                }
+            }
+            handler->commitRunBuffer(info);
+        }
+        handler->commitLine();
+    }
+
+    // Drops the least recently used runs until the cache fits into the given size
+    void purge(size_t bytes) {
+        while (fUsed > bytes) {
+            Entry* entry = fLRU.tail();
+            SkASSERT(entry);
+            fUsed -= entry->fBytes;
+            fMap.remove(entry->fKey);
+            fLRU.remove(entry);
+            delete entry;
+        }
+    }
+
+    mutable SkMutex fMutex;
+    SkTHashTable<Entry*, ShapedRunKey, Traits> fMap;
+    SkTInternalLList<Entry> fLRU;
+    size_t fLimit;
+    size_t fUsed;
+#ifdef PARAGRAPH_CACHE_STATS
+    int fTotalRequests = 0;
+    int fCacheMisses = 0;
+#endif
+};
+
 struct ParagraphCache::Entry {
 
     Entry(ParagraphCacheValue* value) : fValue(value) {}
@@ -244,6 +541,7 @@ ParagraphCache::ParagraphCache()
     , fLRUCacheMap(kMaxEntries)
     , fCacheIsOn(true)
     , fLastCachedValue(nullptr)
+    , fShapedRunCache(std::make_unique<ShapedRunCache>())
 #ifdef PARAGRAPH_CACHE_STATS
     , fTotalRequests(0)
     , fCacheMisses(0)
@@ -282,6 +580,7 @@ void ParagraphCache::printStatistics() {
     SkDebugf("Cache miss %%: %f\n", (fTotalRequests > 0) ? 100.f * fCacheMisses / fTotalRequests : 0.f);
     int cacheHits = fTotalRequests - fCacheMisses;
     SkDebugf("Hash miss %%: %f\n", (cacheHits > 0) ? 100.f * fHashMisses / cacheHits : 0.f);
+    fShapedRunCache->printStatistics();
     SkDebugf("---------------------\n");
 }
 
@@ -298,6 +597,7 @@ void ParagraphCache::reset() {
 #endif
     fLRUCacheMap.reset();
     fLastCachedValue = nullptr;
+    fShapedRunCache->reset();
 }
 
 bool ParagraphCache::findParagraph(ParagraphImpl* paragraph) {
@@ -352,6 +652,42 @@ bool ParagraphCache::updateParagraph(ParagraphImpl* paragraph) {
     }
 }
 
+void ParagraphCache::shapeRuns(SkSpan<const char> utf8, const SkFont& font, uint8_t bidiLevel,
+                               const SkString& language,
+                               SkSpan<const SkShaper::Feature> features,
+                               SkShaper::RunHandler* handler, const ShapeRunsProc& shape) {
+    if (!fCacheIsOn) {
+        shape(handler);
+        return;
+    }
+
+    ShapedRunKey key(utf8, font, bidiLevel, language, features);
+    if (fShapedRunCache->find(key, handler)) {
+        return;
+    }
+
+    // Shape outside of the lock; the runs are only added once they are all there
+    ShapedRunRecorder recorder(handler);
+    shape(&recorder);
+    fShapedRunCache->insert(std::move(key), recorder.detach());
+}
+
+void ParagraphCache::setShapedRunCacheLimit(size_t bytes) {
+    fShapedRunCache->setLimit(bytes);
+}
+
+size_t ParagraphCache::getShapedRunCacheLimit() const {
+    return fShapedRunCache->limit();
+}
+
+size_t ParagraphCache::getShapedRunCacheUsed() const {
+    return fShapedRunCache->used();
+}
+
+int ParagraphCache::shapedRunCount() const {
+    return fShapedRunCache->count();
+}
+
 // Special situation: (very) long paragraph that is close to the last formatted paragraph
 #define NOCACHE_PREFIX_LENGTH 40
 bool ParagraphCache::isPossiblyTextEditing(ParagraphImpl* paragraph) {
@@ -5127,6 +5127,69 @@ UNIX_ONLY_TEST(SkParagraph_CacheStyles, reporter) {
     test(2, false);
 }
 
+UNIX_ONLY_TEST(SkParagraph_CacheShapedRuns, reporter) {
+    sk_sp<ResourceFontCollection> fontCollection = sk_make_sp<ResourceFontCollection>();
+    if (!fontCollection->fontsFound()) return;
+    sk_sp<ResourceFontCollection> noCacheCollection = sk_make_sp<ResourceFontCollection>();
+    noCacheCollection->getParagraphCache()->turnOn(false);
+    auto cache = fontCollection->getParagraphCache();
+
+    ParagraphStyle paragraph_style;
+    paragraph_style.turnHintingOff();
+
+    TextStyle text_style;
+    text_style.setFontFamilies({SkString("Roboto")});
+    text_style.setColor(SK_ColorBLACK);
+    TextStyle bold_style = text_style;
+    bold_style.setFontStyle(SkFontStyle::Bold());
+
+    auto build = [&](sk_sp<FontCollection> collection, const char* text1, const char* text2) {
+        ParagraphBuilderImpl builder(paragraph_style, collection);
+        builder.pushStyle(text_style);
+        builder.addText(text1, strlen(text1));
+        builder.pop();
+        builder.pushStyle(bold_style);
+        builder.addText(text2, strlen(text2));
+        builder.pop();
+        auto paragraph = builder.Build();
+        paragraph->layout(TestCanvasWidth);
+        return paragraph;
+    };
+
+    auto paragraph1 = build(fontCollection, "Plain text, ", "bold text");
+    REPORTER_ASSERT(reporter, cache->shapedRunCount() == 2);
+
+    // Only the edited span gets shaped again
+    auto paragraph2 = build(fontCollection, "Plain text, ", "bold text edited");
+    REPORTER_ASSERT(reporter, cache->shapedRunCount() == 3);
+
+    // The replayed runs match the ones the shaper produces
+    auto expected = build(noCacheCollection, "Plain text, ", "bold text edited");
+    auto runs = static_cast<ParagraphImpl*>(paragraph2.get())->runs();
+    auto expectedRuns = static_cast<ParagraphImpl*>(expected.get())->runs();
+    REPORTER_ASSERT(reporter, runs.size() == expectedRuns.size());
+    for (size_t i = 0; i < std::min(runs.size(), expectedRuns.size()); ++i) {
+        auto& run = runs[i];
+        auto& expectedRun = expectedRuns[i];
+        REPORTER_ASSERT(reporter, run.textRange() == expectedRun.textRange());
+        REPORTER_ASSERT(reporter, run.size() == expectedRun.size());
+        for (size_t g = 0; g < std::min(run.size(), expectedRun.size()); ++g) {
+            REPORTER_ASSERT(reporter, run.glyphs()[g] == expectedRun.glyphs()[g]);
+            REPORTER_ASSERT(reporter, run.positions()[g] == expectedRun.positions()[g]);
+            REPORTER_ASSERT(reporter, run.clusterIndex(g) == expectedRun.clusterIndex(g));
+        }
+    }
+
+    // The cache never holds more than it is allowed to
+    auto used = cache->getShapedRunCacheUsed();
+    cache->setShapedRunCacheLimit(used - 1);
+    REPORTER_ASSERT(reporter, cache->getShapedRunCacheUsed() < used);
+    REPORTER_ASSERT(reporter, cache->shapedRunCount() < 3);
+    cache->setShapedRunCacheLimit(0);
+    REPORTER_ASSERT(reporter, cache->shapedRunCount() == 0);
+    REPORTER_ASSERT(reporter, cache->getShapedRunCacheUsed() == 0);
+}
+
 UNIX_ONLY_TEST(SkParagraph_EmptyParagraphWithLineBreak, reporter) {
     sk_sp<ResourceFontCollection> fontCollection = sk_make_sp<ResourceFontCollection>();
     if (!fontCollection->fontsFound()) return;
@@ -9,10 +9,12 @@
 #define SkSGInvalidationController_DEFINED
 
 #include "include/core/SkMatrix.h"
+#include "include/core/SkRegion.h"
 #include "include/core/SkTypes.h"
 
 #include <vector>
 
+struct SkIRect;
 struct SkRect;
 
 namespace sksg {
@@ -35,6 +37,15 @@ public:
     auto begin() const { return fRects.cbegin(); }
     auto   end() const { return fRects.cend();   }
 
+    /**
+     * Coalesces the invalidated rects into a device space region, suitable for clipping a partial
+     * redraw: rects are mapped by |ctm|, clipped to |deviceBounds|, and rounded out with two extra
+     * pixels, for anti-aliasing and for filtered content resampled from its layer.  When the union
+     * would need more than |maxRects| rects, the region is simplified to its bounds.
+     */
+    SkRegion computeDamage(const SkMatrix& ctm, const SkIRect& deviceBounds,
+                           int maxRects = 16) const;
+
     void reset();
 
 private:
@@ -29,6 +29,33 @@ void InvalidationController::inval(const SkRect& r, const SkMatrix& ctm) {
     fBounds.join(*rect);
 }
 
+SkRegion InvalidationController::computeDamage(const SkMatrix& ctm, const SkIRect& deviceBounds,
+                                               int maxRects) const {
+    const auto clip = SkRect::Make(deviceBounds);
+
+    SkRegion damage;
+    for (const auto& r : fRects) {
+        // Clip before rounding, as initial invalidations are (nearly) unbounded.  One pixel of
+        // padding covers anti-aliasing.  Image filters render into integer-aligned layers that
+        // can be resampled into place, so their output can reach one pixel further.
+        SkRect dr;
+        if (dr.intersect(ctm.mapRect(r).makeOutset(2, 2), clip)) {
+            damage.op(dr.roundOut(), SkRegion::kUnion_Op);
+        }
+    }
+
+    if (damage.isComplex()) {
+        int count = 0;
+        for (SkRegion::Iterator it(damage); !it.done(); it.next()) {
+            if (++count > maxRects) {
+                return SkRegion(damage.getBounds());
+            }
+        }
+    }
+
+    return damage;
+}
+
 void InvalidationController::reset() {
     fRects.clear();
     fBounds.setEmpty();
@@ -10,6 +10,7 @@
 #if !defined(SK_BUILD_FOR_GOOGLE3)
 
 #include "include/core/SkRect.h"
+#include "include/core/SkRegion.h"
 #include "include/private/SkTo.h"
 #include "modules/sksg/include/SkSGDraw.h"
 #include "modules/sksg/include/SkSGGroup.h"
@@ -348,11 +349,64 @@ static void inval_group_remove(skiatest::Reporter* reporter) {
     grp->addChild(draw);
 }
 
+static void inval_damage(skiatest::Reporter* reporter) {
+    auto color = sksg::Color::Make(SK_ColorBLACK);
+    auto r1    = sksg::Rect::Make(SkRect::MakeWH(100, 100)),
+         r2    = sksg::Rect::Make(SkRect::MakeXYWH(200, 0, 100, 100));
+    auto grp   = sksg::Group::Make();
+    grp->addChild(sksg::Draw::Make(r1, color));
+    grp->addChild(sksg::Draw::Make(r2, color));
+
+    const auto ctm    = SkMatrix::Scale(2, 2);
+    const auto bounds = SkIRect::MakeWH(1000, 500);
+
+    {
+        // The initial revalidation damages everything.
+        sksg::InvalidationController ic;
+        grp->revalidate(&ic, SkMatrix::I());
+        REPORTER_ASSERT(reporter, ic.computeDamage(ctm, bounds) == SkRegion(bounds));
+    }
+
+    {
+        // Nothing changed.
+        sksg::InvalidationController ic;
+        grp->revalidate(&ic, SkMatrix::I());
+        REPORTER_ASSERT(reporter, ic.computeDamage(ctm, bounds).isEmpty());
+    }
+
+    {
+        // Moving r1 damages its old and new (overlapping) locations, in device space and
+        // padded for anti-aliasing.
+        r1->setL(50); r1->setR(150);
+        sksg::InvalidationController ic;
+        grp->revalidate(&ic, SkMatrix::I());
+
+        REPORTER_ASSERT(reporter, ic.computeDamage(ctm, bounds) ==
+                                  SkRegion(SkIRect::MakeLTRB(0, 0, 302, 202)));
+    }
+
+    {
+        // Disjoint damage, simplified to its bounds when exceeding the rect budget.
+        r1->setL(0); r1->setR(100);
+        r2->setT(100); r2->setB(200);
+        sksg::InvalidationController ic;
+        grp->revalidate(&ic, SkMatrix::I());
+
+        SkRegion expected;
+        expected.op(SkIRect::MakeLTRB(0, 0, 302, 202), SkRegion::kUnion_Op);
+        expected.op(SkIRect::MakeLTRB(398, 0, 602, 402), SkRegion::kUnion_Op);
+        REPORTER_ASSERT(reporter, ic.computeDamage(ctm, bounds) == expected);
+        REPORTER_ASSERT(reporter, ic.computeDamage(ctm, bounds, 1) ==
+                                  SkRegion(expected.getBounds()));
+    }
+}
+
 DEF_TEST(SGInvalidation, reporter) {
     inval_test1(reporter);
     inval_test2(reporter);
     inval_test3(reporter);
     inval_group_remove(reporter);
+    inval_damage(reporter);
 }
 
 #endif // !defined(SK_BUILD_FOR_GOOGLE3)
@@ -202,6 +202,7 @@ SKIA_PUBLIC_HDRS = [
     "include/gpu/GrDirectContext.h",
     "include/gpu/GrDriverBugWorkarounds.h",
     "include/gpu/GrDriverBugWorkaroundsAutogen.h",
+    "include/gpu/GrPersistentFileCache.h",
     "include/gpu/GrRecordingContext.h",
     "include/gpu/GrSurfaceInfo.h",
     "include/gpu/GrTypes.h",
@@ -380,6 +381,7 @@ BASE_SRCS_ALL = [
     "src/core/SkBlurMF.cpp",
     "src/core/SkBlurMask.cpp",
     "src/core/SkBlurMask.h",
+    "src/core/SkBlurPriv.h",
     "src/core/SkBuffer.cpp",
     "src/core/SkBuffer.h",
     "src/core/SkBuiltInCodeSnippetID.h",
@@ -501,6 +503,8 @@ BASE_SRCS_ALL = [
     "src/core/SkLRUCache.h",
     "src/core/SkLatticeIter.cpp",
     "src/core/SkLatticeIter.h",
+    "src/core/SkLazyPicture.cpp",
+    "src/core/SkLazyPicture.h",
     "src/core/SkLeanWindows.h",
     "src/core/SkLineClipper.cpp",
     "src/core/SkLineClipper.h",
@@ -711,6 +715,8 @@ BASE_SRCS_ALL = [
     "src/core/SkVM.h",
     "src/core/SkVMBlitter.cpp",
     "src/core/SkVMBlitter.h",
+    "src/core/SkVMProgramCache.cpp",
+    "src/core/SkVMProgramCache.h",
     "src/core/SkVM_fwd.h",
     "src/core/SkValidationUtils.h",
     "src/core/SkVertState.cpp",
@@ -912,6 +918,7 @@ BASE_SRCS_ALL = [
     "src/gpu/ganesh/GrPaint.h",
     "src/gpu/ganesh/GrPersistentCacheUtils.cpp",
     "src/gpu/ganesh/GrPersistentCacheUtils.h",
+    "src/gpu/ganesh/GrPersistentFileCache.cpp",
     "src/gpu/ganesh/GrPipeline.cpp",
     "src/gpu/ganesh/GrPipeline.h",
     "src/gpu/ganesh/GrPixmap.h",
@@ -1258,6 +1265,7 @@ BASE_SRCS_ALL = [
     "src/image/SkSurface_Gpu.cpp",
     "src/image/SkSurface_Gpu.h",
     "src/image/SkSurface_Raster.cpp",
+    "src/image/SkSurface_TiledRaster.cpp",
     "src/images/SkImageEncoder.cpp",
     "src/images/SkImageEncoderFns.h",
     "src/images/SkImageEncoderPriv.h",
@@ -1441,6 +1449,8 @@ BASE_SRCS_ALL = [
     "src/sksl/SkSLBuiltinMap.h",
     "src/sksl/SkSLBuiltinTypes.cpp",
     "src/sksl/SkSLBuiltinTypes.h",
+    "src/sksl/SkSLCompileService.cpp",
+    "src/sksl/SkSLCompileService.h",
     "src/sksl/SkSLCompiler.cpp",
     "src/sksl/SkSLCompiler.h",
     "src/sksl/SkSLConstantFolder.cpp",
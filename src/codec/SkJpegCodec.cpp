@@ -16,6 +16,11 @@
 #include "src/codec/SkCodecPriv.h"
 #include "src/codec/SkJpegDecoderMgr.h"
 #include "src/codec/SkParseEncodedOrigin.h"
+#include "src/core/SkAutoMalloc.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <numeric>
+#include <vector>
 
 // stdio is needed for libjpeg-turbo
 #include <stdio.h>
@@ -532,6 +537,13 @@ SkCodec::Result SkJpegCodec::onGetPixels(const SkImageInfo& dstInfo,
         return kUnimplemented;
     }
 
+    if (options.fExecutor) {
+        if (auto bands = this->makeRestartBands(dstInfo, 0, dstInfo.height())) {
+            return this->decodeRestartBands(*bands, dstInfo, dst, dstRowBytes, options,
+                                            rowsDecoded);
+        }
+    }
+
     // Get a pointer to the decompress info since we will use it quite frequently
     jpeg_decompress_struct* dinfo = fDecoderMgr->dinfo();
 
@@ -567,6 +579,374 @@ SkCodec::Result SkJpegCodec::onGetPixels(const SkImageInfo& dstInfo,
     return kSuccess;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Parallel decoding
+//
+// A baseline JPEG with restart markers can be split into horizontal bands which decode
+// independently.  Each band is a copy of the headers, with the frame height patched, followed by
+// the entropy coded data between two restart markers, renumbered to start from RST0.
+//
+// Fancy upsampling of the chroma reads one iMCU row above and below each row, so every band also
+// decodes (and throws away) at least one iMCU row on each side of the rows it outputs.  That
+// keeps the result identical to a serial decode.
+
+class JpegRestartBands {
+public:
+    struct Band {
+        int fFirstIMCURow;  // The iMCU rows in this band's stream.
+        int fEndIMCURow;
+        int fTop;           // The rows of the image this band outputs.
+        int fBottom;
+    };
+
+    /*
+     * Returns nullptr if data is not a single scan, baseline JPEG with restart markers, or if
+     * rows [top, bottom) can not be split into at least two bands.
+     */
+    static std::unique_ptr<JpegRestartBands> Make(const uint8_t* data, size_t size,
+                                                  int top, int bottom);
+
+    const std::vector<Band>& bands() const { return fBands; }
+
+    // The first row of the image decoded by a band.
+    int streamTop(const Band& band) const { return band.fFirstIMCURow * fIMCUHeight; }
+
+    size_t bandSize(const Band& band) const {
+        return fEntropyStart + this->entropyEnd(band) - this->entropyBegin(band) + 2;
+    }
+
+    // Writes bandSize() bytes of JPEG for a band to dst.
+    void writeBand(const Band& band, uint8_t* dst) const;
+
+private:
+    JpegRestartBands() = default;
+
+    int firstMCU(int iMCURow) const { return iMCURow * fMCUsPerIMCURow; }
+
+    // Restart markers follow every fRestartInterval MCUs.  These are the markers in fMarkers
+    // immediately before and after a band's MCUs, if any.
+    int firstMarker(const Band& band) const {
+        return this->firstMCU(band.fFirstIMCURow) / fRestartInterval;
+    }
+    int endMarker(const Band& band) const {
+        return band.fEndIMCURow == fTotalIMCURows
+                ? SkToInt(fMarkers.size())
+                : this->firstMCU(band.fEndIMCURow) / fRestartInterval - 1;
+    }
+
+    size_t entropyBegin(const Band& band) const {
+        return band.fFirstIMCURow == 0 ? fEntropyStart
+                                       : fMarkers[this->firstMarker(band) - 1] + 2;
+    }
+    size_t entropyEnd(const Band& band) const {
+        return band.fEndIMCURow == fTotalIMCURows ? fEntropyEnd
+                                                  : fMarkers[this->endMarker(band)];
+    }
+
+    const uint8_t*      fData            = nullptr;
+    size_t              fSOFOffset       = 0;  // Offset of the SOF segment's length.
+    size_t              fEntropyStart    = 0;  // Just past the SOS segment.
+    size_t              fEntropyEnd      = 0;  // The marker that ends the scan.
+    int                 fHeight          = 0;
+    int                 fIMCUHeight      = 0;
+    int                 fTotalIMCURows   = 0;
+    int                 fMCUsPerIMCURow  = 0;
+    int                 fRestartInterval = 0;
+    std::vector<size_t> fMarkers;              // Offset of each RSTn marker in the scan.
+    std::vector<Band>   fBands;
+};
+
+static inline int read_u16(const uint8_t* p) { return (p[0] << 8) | p[1]; }
+
+std::unique_ptr<JpegRestartBands> JpegRestartBands::Make(const uint8_t* data, size_t size,
+                                                         int top, int bottom) {
+    // Bands smaller than this are not worth the overlap, nor the cost of setting up a decoder.
+    constexpr int kMinBandHeight = 128;
+    constexpr int kMaxBands      = 32;
+
+    std::unique_ptr<JpegRestartBands> bands(new JpegRestartBands);
+    bands->fData = data;
+
+    // Find the frame, the restart interval and the start of the (only) scan.
+    int width = 0, components = 0, maxH = 1, maxV = 1;
+    size_t offset = 2;  // Skip the SOI marker.
+    for (;;) {
+        if (offset >= size || data[offset] != 0xFF) {
+            return nullptr;
+        }
+        while (offset < size && data[offset] == 0xFF) {
+            offset++;
+        }
+        if (offset + 3 > size) {
+            return nullptr;
+        }
+        const uint8_t marker = data[offset++];
+        const size_t length = read_u16(data + offset);
+        if (length < 2 || offset + length > size) {
+            return nullptr;
+        }
+        const uint8_t* segment = data + offset;
+        switch (marker) {
+            case 0xC0:  // SOF0 and SOF1, sequential Huffman coded.
+            case 0xC1:
+                if (length < 8) {
+                    return nullptr;
+                }
+                bands->fSOFOffset = offset;
+                bands->fHeight = read_u16(segment + 3);
+                width          = read_u16(segment + 5);
+                components     = segment[7];
+                if (components < 1 || length < 8 + 3 * (size_t)components) {
+                    return nullptr;
+                }
+                for (int i = 0; i < components; i++) {
+                    const uint8_t sampling = segment[8 + 3*i + 1];
+                    maxH = std::max(maxH, sampling >> 4);
+                    maxV = std::max(maxV, sampling & 0xF);
+                }
+                break;
+            case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:  // Other SOFn.
+            case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+                return nullptr;
+            case 0xDD:  // DRI
+                if (length < 4) {
+                    return nullptr;
+                }
+                bands->fRestartInterval = read_u16(segment + 2);
+                break;
+            case 0xDA:  // SOS
+                // Scans with fewer components mean the image has several scans.
+                if (length < 3 || segment[2] != components) {
+                    return nullptr;
+                }
+                bands->fEntropyStart = offset + length;
+                break;
+            case 0xD9:  // EOI
+                return nullptr;
+        }
+        if (bands->fEntropyStart) {
+            break;
+        }
+        offset += length;
+    }
+
+    // An image with a DNL marker has no height in its frame header.
+    if (bands->fHeight == 0 || width == 0 || bands->fRestartInterval == 0) {
+        return nullptr;
+    }
+
+    // With one component an MCU is a single block, whatever its sampling factors.  Rather than
+    // handle the unusual single component images that have several block rows per iMCU row, we
+    // decode those serially.
+    if (components == 1 && (maxH != 1 || maxV != 1)) {
+        return nullptr;
+    }
+    const int mcuWidth = 8 * maxH;
+    bands->fIMCUHeight     = 8 * maxV;
+    bands->fMCUsPerIMCURow = (width + mcuWidth - 1) / mcuWidth;
+    bands->fTotalIMCURows  = (bands->fHeight + bands->fIMCUHeight - 1) / bands->fIMCUHeight;
+
+    // Find the restart markers.  Within the scan 0xFF is always followed by a zero byte, more
+    // 0xFF fill bytes, or a marker.  Any marker other than RSTn ends the scan.
+    bands->fEntropyEnd = size;
+    for (const uint8_t* p = data + bands->fEntropyStart; ; ) {
+        p = (const uint8_t*)memchr(p, 0xFF, data + size - p);
+        if (!p || p + 1 >= data + size) {
+            break;
+        }
+        const uint8_t next = p[1];
+        if (next == 0xFF) {
+            p += 1;
+        } else if (next == 0x00) {
+            p += 2;
+        } else if (next >= 0xD0 && next <= 0xD7) {
+            // Markers are numbered in sequence.  If they're not, the data is corrupt and we'll let
+            // the serial decode deal with it.
+            if (next - 0xD0 != (int)(bands->fMarkers.size() % 8)) {
+                return nullptr;
+            }
+            bands->fMarkers.push_back(p - data);
+            p += 2;
+        } else {
+            bands->fEntropyEnd = p - data;
+            break;
+        }
+    }
+    const int64_t totalMCUs = (int64_t)bands->fMCUsPerIMCURow * bands->fTotalIMCURows;
+    const int64_t restarts = (totalMCUs - 1) / bands->fRestartInterval;
+    if ((int64_t)bands->fMarkers.size() != restarts) {
+        return nullptr;
+    }
+
+    // A band's stream may start at the first iMCU row, or any row whose first MCU follows a
+    // restart marker.  That happens every "period" iMCU rows.
+    const int period = bands->fRestartInterval /
+                       std::gcd(bands->fRestartInterval, bands->fMCUsPerIMCURow);
+    const int iMCUHeight = bands->fIMCUHeight,
+              totalRows  = bands->fTotalIMCURows;
+    auto prevStart = [&](int row) { return row - row % period; };
+    auto nextStart = [&](int row) {
+        return std::min(totalRows, (row + period - 1) / period * period);
+    };
+
+    // Split [top, bottom) on rows where a stream may start, as evenly as those allow.
+    const int bandHeight = std::max(kMinBandHeight, (bottom - top + kMaxBands - 1) / kMaxBands);
+    const int step = std::max(1, bandHeight / (period * iMCUHeight)) * period;
+    for (int y = top; y < bottom; ) {
+        const int split = (y / iMCUHeight + step) / step * step * iMCUHeight;
+        const int end = bottom - split < bandHeight / 2 ? bottom : std::min(bottom, split);
+
+        Band band;
+        band.fTop    = y;
+        band.fBottom = end;
+        // One iMCU row of context above and below the rows we output, where there are any.
+        const int firstRow = y / iMCUHeight,
+                  lastRow  = (end - 1) / iMCUHeight;
+        band.fFirstIMCURow = prevStart(std::max(0, firstRow - 1));
+        band.fEndIMCURow   = nextStart(std::min(totalRows, lastRow + 2));
+        bands->fBands.push_back(band);
+        y = end;
+    }
+    if (bands->fBands.size() < 2) {
+        return nullptr;
+    }
+    return bands;
+}
+
+void JpegRestartBands::writeBand(const Band& band, uint8_t* dst) const {
+    const size_t begin = this->entropyBegin(band),
+                 end   = this->entropyEnd(band);
+
+    memcpy(dst, fData, fEntropyStart);
+    const int height = std::min(band.fEndIMCURow * fIMCUHeight, fHeight) -
+                       band.fFirstIMCURow * fIMCUHeight;
+    dst[fSOFOffset + 3] = height >> 8;
+    dst[fSOFOffset + 4] = height & 0xFF;
+
+    uint8_t* entropy = dst + fEntropyStart;
+    memcpy(entropy, fData + begin, end - begin);
+    const int first = band.fFirstIMCURow == 0 ? 0 : this->firstMarker(band);
+    for (int i = first; i < this->endMarker(band); i++) {
+        entropy[fMarkers[i] - begin + 1] = 0xD0 + ((i - first) & 7);
+    }
+
+    uint8_t* eoi = entropy + (end - begin);
+    eoi[0] = 0xFF;
+    eoi[1] = 0xD9;
+}
+
+SkJpegCodec::~SkJpegCodec() = default;
+
+std::unique_ptr<JpegRestartBands> SkJpegCodec::makeRestartBands(const SkImageInfo& dstInfo,
+                                                               int top, int bottom) {
+    // Bands are only split on iMCU rows of the unscaled image.
+    if (dstInfo.dimensions() != this->dimensions()) {
+        return nullptr;
+    }
+    SkStream* stream = this->stream();
+    const void* data = stream->getMemoryBase();
+    if (!data || !stream->hasLength()) {
+        return nullptr;
+    }
+    return JpegRestartBands::Make(static_cast<const uint8_t*>(data), stream->getLength(),
+                                  top, bottom);
+}
+
+SkCodec::Result SkJpegCodec::decodeRestartBands(const JpegRestartBands& restartBands,
+                                                const SkImageInfo& dstInfo, void* dst,
+                                                size_t rowBytes, const Options& options,
+                                                int* rowsDecoded) {
+    SkASSERT(options.fExecutor);
+    const std::vector<JpegRestartBands::Band>& bands = restartBands.bands();
+    const int top = options.fSubset ? options.fSubset->top() : 0;
+    const int width = options.fSubset ? options.fSubset->width() : dstInfo.width();
+
+    std::vector<Result> results(bands.size(), kSuccess);
+    std::vector<int> rows(bands.size(), 0);
+    SkTaskGroup tasks(*options.fExecutor);
+    tasks.batch(SkToInt(bands.size()), [&](int i) {
+        const JpegRestartBands::Band& band = bands[i];
+        sk_sp<SkData> data = SkData::MakeUninitialized(restartBands.bandSize(band));
+        restartBands.writeBand(band, static_cast<uint8_t*>(data->writable_data()));
+
+        // Each band reads the same headers as we did, so only a default profile (from
+        // SkRawCodec) needs to be passed along.
+        std::unique_ptr<SkEncodedInfo::ICCProfile> profile;
+        if (const skcms_ICCProfile* icc = this->getEncodedInfo().profile()) {
+            profile = SkEncodedInfo::ICCProfile::Make(*icc);
+        }
+        std::unique_ptr<SkCodec> codec = SkJpegCodec::MakeFromStream(
+                SkMemoryStream::Make(std::move(data)), &results[i], std::move(profile));
+        if (!codec) {
+            return;
+        }
+
+        const SkImageInfo bandInfo = dstInfo.makeDimensions(codec->dimensions());
+        const SkIRect bandSubset = SkIRect::MakeXYWH(options.fSubset ? options.fSubset->x() : 0,
+                                                     0, width, bandInfo.height());
+        Options bandOptions;
+        bandOptions.fSubset = options.fSubset ? &bandSubset : nullptr;
+        results[i] = codec->startScanlineDecode(bandInfo, &bandOptions);
+        if (results[i] != kSuccess) {
+            return;
+        }
+
+        // Rows above the band only provide context for the ones we keep.
+        const size_t minRowBytes = dstInfo.makeWH(width, 1).minRowBytes();
+        SkAutoMalloc scratch(minRowBytes);
+        for (int y = restartBands.streamTop(band); y < band.fTop; y++) {
+            if (1 != codec->getScanlines(scratch.get(), 1, minRowBytes)) {
+                results[i] = kIncompleteInput;
+                return;
+            }
+        }
+
+        const int count = band.fBottom - band.fTop;
+        rows[i] = codec->getScanlines(SkTAddOffset<void>(dst, (band.fTop - top) * rowBytes),
+                                      count, rowBytes);
+        if (rows[i] != count) {
+            results[i] = kIncompleteInput;
+        }
+    });
+    tasks.wait();
+
+    for (size_t i = 0; i < bands.size(); i++) {
+        if (results[i] != kSuccess) {
+            *rowsDecoded = bands[i].fTop - top + rows[i];
+            return results[i];
+        }
+    }
+    return kSuccess;
+}
+
+SkCodec::Result SkJpegCodec::onStartIncrementalDecode(const SkImageInfo& dstInfo, void* dst,
+                                                      size_t rowBytes, const Options& options) {
+    // We only decode incrementally to split the rows among the bands, otherwise
+    // SkAndroidCodec's fallback to scanline decoding is just as good. Bands write
+    // unsampled rows, so SkSampledCodec must not pass an executor when sampling.
+    if (!options.fExecutor) {
+        return kUnimplemented;
+    }
+    const int top    = options.fSubset ? options.fSubset->top()    : 0,
+              bottom = options.fSubset ? options.fSubset->bottom() : dstInfo.height();
+    fRestartBands = this->makeRestartBands(dstInfo, top, bottom);
+    if (!fRestartBands) {
+        return kUnimplemented;
+    }
+    fIncrementalDst = dst;
+    fIncrementalRowBytes = rowBytes;
+    return kSuccess;
+}
+
+SkCodec::Result SkJpegCodec::onIncrementalDecode(int* rowsDecoded) {
+    SkASSERT(fRestartBands);
+    const Result result = this->decodeRestartBands(*fRestartBands, this->dstInfo(),
+                                                   fIncrementalDst, fIncrementalRowBytes,
+                                                   this->options(), rowsDecoded);
+    fRestartBands.reset();
+    return result;
+}
+
 bool SkJpegCodec::allocateStorage(const SkImageInfo& dstInfo) {
     int dstWidth = dstInfo.width();
 
@@ -643,6 +1023,10 @@ void SkJpegCodec::initializeSwizzler(const SkImageInfo& dstInfo, const Options&
 }
 
 SkSampler* SkJpegCodec::getSampler(bool createIfNecessary) {
+    // Restart bands are decoded at full resolution, straight into the destination.
+    if (fRestartBands) {
+        return nullptr;
+    }
     if (!createIfNecessary || fSwizzler) {
         SkASSERT(!fSwizzler || (fSwizzleSrcRow && fStorage.get() == fSwizzleSrcRow));
         return fSwizzler.get();
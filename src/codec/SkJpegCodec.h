@@ -15,6 +15,7 @@
 #include "src/codec/SkSwizzler.h"
 
 class JpegDecoderMgr;
+class JpegRestartBands;
 
 /*
  *
@@ -31,6 +32,8 @@ public:
      */
     static std::unique_ptr<SkCodec> MakeFromStream(std::unique_ptr<SkStream>, Result*);
 
+    ~SkJpegCodec() override;
+
 protected:
 
     /*
@@ -49,6 +52,13 @@ protected:
 
     Result onGetYUVAPlanes(const SkYUVAPixmaps& yuvaPixmaps) override;
 
+    /*
+     * Only implemented when Options::fExecutor is set, to decode bands of the image in parallel.
+     */
+    Result onStartIncrementalDecode(const SkImageInfo& dstInfo, void* dst, size_t rowBytes,
+                                    const Options&) override;
+    Result onIncrementalDecode(int* rowsDecoded) override;
+
     SkEncodedImageFormat onGetEncodedFormat() const override {
         return SkEncodedImageFormat::kJPEG;
     }
@@ -109,6 +119,18 @@ private:
     bool SK_WARN_UNUSED_RESULT allocateStorage(const SkImageInfo& dstInfo);
     int readRows(const SkImageInfo& dstInfo, void* dst, size_t rowBytes, int count, const Options&);
 
+    /*
+     * Parallel decoding of images with restart markers.
+     *
+     * makeRestartBands() splits rows [top, bottom) of the image into bands that can be decoded
+     * independently, or returns nullptr if the image can not be split.  decodeRestartBands()
+     * then decodes them on options.fExecutor.
+     */
+    std::unique_ptr<JpegRestartBands> makeRestartBands(const SkImageInfo& dstInfo,
+                                                       int top, int bottom);
+    Result decodeRestartBands(const JpegRestartBands&, const SkImageInfo& dstInfo, void* dst,
+                              size_t rowBytes, const Options&, int* rowsDecoded);
+
     /*
      * Scanline decoding.
      */
@@ -136,6 +158,11 @@ private:
 
     std::unique_ptr<SkSwizzler>        fSwizzler;
 
+    // Set between onStartIncrementalDecode() and onIncrementalDecode().
+    std::unique_ptr<JpegRestartBands>  fRestartBands;
+    void*                              fIncrementalDst = nullptr;
+    size_t                             fIncrementalRowBytes = 0;
+
     friend class SkRawCodec;
 
     using INHERITED = SkCodec;
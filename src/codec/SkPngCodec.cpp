@@ -465,6 +465,30 @@ static skcms_PixelFormat png_select_xform_format(const SkEncodedInfo& info) {
     return skcms_PixelFormat_RGBA_8888;
 }
 
+void SkPngCodec::applyXformRows(void* dst, size_t dstRowBytes,
+                                const void* src, size_t srcRowBytes, int count) {
+    switch (fXformMode) {
+        case kSwizzleOnly_XformMode:
+            fSwizzler->swizzleRows(dst, dstRowBytes, (const uint8_t*) src, srcRowBytes, count);
+            return;
+        case kColorOnly_XformMode:
+            // libpng's rows are always tightly packed, so this only depends on the destination.
+            if (dstRowBytes == this->dstInfo().minRowBytes()) {
+                this->applyColorXform(dst, src, fXformWidth * count);
+                return;
+            }
+            break;
+        case kSwizzleColor_XformMode:
+            break;
+    }
+
+    for (int y = 0; y < count; y++) {
+        this->applyXformRow(dst, src);
+        dst = SkTAddOffset<void>(dst, dstRowBytes);
+        src = SkTAddOffset<const void>(src, srcRowBytes);
+    }
+}
+
 void SkPngCodec::applyXformRow(void* dst, const void* src) {
     switch (fXformMode) {
         case kSwizzleOnly_XformMode:
@@ -498,6 +522,9 @@ public:
         , fRowBytes(0)
         , fFirstRow(0)
         , fLastRow(0)
+        , fBatchRowBytes(0)
+        , fRowsPerBatch(0)
+        , fRowsInBatch(0)
     {}
 
     static void AllRowsCallback(png_structp png_ptr, png_bytep row, png_uint_32 rowNum, int /*pass*/) {
@@ -518,6 +545,12 @@ private:
     int                         fLastRow;
     int                         fRowsNeeded;
 
+    // Variables for batching narrow rows in decodeAllRows
+    SkAutoTMalloc<uint8_t>      fBatch;
+    size_t                      fBatchRowBytes;
+    int                         fRowsPerBatch;
+    int                         fRowsInBatch;
+
     using INHERITED = SkPngCodec;
 
     static SkPngNormalDecoder* GetDecoder(png_structp png_ptr) {
@@ -534,7 +567,21 @@ private:
         fFirstRow = 0;
         fLastRow = height - 1;
 
+        // Narrow rows cost more to hand over one at a time than to convert. Collect enough
+        // of them to fill kBatchBytes, then convert the whole batch at once.
+        constexpr size_t kBatchBytes = 16 * 1024;
+        fBatchRowBytes = png_get_rowbytes(this->png_ptr(), this->info_ptr());
+        fRowsPerBatch = 0;
+        if (fBatchRowBytes > 0) {
+            fRowsPerBatch = SkTo<int>(std::min<size_t>(kBatchBytes / fBatchRowBytes, height));
+        }
+        fRowsInBatch = 0;
+        if (fRowsPerBatch > 1) {
+            fBatch.reset(fRowsPerBatch * fBatchRowBytes);
+        }
+
         const bool success = this->processData();
+        this->flushBatch();
         if (success && fRowsWrittenToOutput == height) {
             return kSuccess;
         }
@@ -547,12 +594,28 @@ private:
     }
 
     void allRowsCallback(png_bytep row, int rowNum) {
-        SkASSERT(rowNum == fRowsWrittenToOutput);
+        SkASSERT(rowNum == fRowsWrittenToOutput + fRowsInBatch);
+        if (fRowsPerBatch > 1) {
+            memcpy(fBatch.get() + fRowsInBatch * fBatchRowBytes, row, fBatchRowBytes);
+            if (++fRowsInBatch == fRowsPerBatch) {
+                this->flushBatch();
+            }
+            return;
+        }
         fRowsWrittenToOutput++;
         this->applyXformRow(fDst, row);
         fDst = SkTAddOffset<void>(fDst, fRowBytes);
     }
 
+    void flushBatch() {
+        if (fRowsInBatch > 0) {
+            this->applyXformRows(fDst, fRowBytes, fBatch.get(), fBatchRowBytes, fRowsInBatch);
+            fDst = SkTAddOffset<void>(fDst, fRowsInBatch * fRowBytes);
+            fRowsWrittenToOutput += fRowsInBatch;
+            fRowsInBatch = 0;
+        }
+    }
+
     void setRange(int firstRow, int lastRow, void* dst, size_t rowBytes) override {
         png_set_progressive_read_fn(this->png_ptr(), this, nullptr, RowCallback, nullptr);
         fFirstRow = firstRow;
@@ -54,6 +54,9 @@ protected:
 
     SkSampler* getSampler(bool createIfNecessary) override;
     void applyXformRow(void* dst, const void* src);
+    // Like calling applyXformRow() on count rows, but converts them all at once when it can.
+    void applyXformRows(void* dst, size_t dstRowBytes, const void* src, size_t srcRowBytes,
+                        int count);
 
     voidp png_ptr() { return fPng_ptr; }
     voidp info_ptr() { return fInfo_ptr; }
@@ -211,6 +211,9 @@ SkCodec::Result SkSampledCodec::sampledDecode(const SkImageInfo& info, void* pix
         // SkImageInfo, startIncrementalDecode uses them to determine which rows to
         // decode.
         AndroidOptions incrementalOptions = options;
+        // Parallel decodes write rows straight into the destination, so they cannot be
+        // combined with the sampler.
+        incrementalOptions.fExecutor = nullptr;
         SkIRect incrementalSubset;
         if (options.fSubset) {
             incrementalSubset.fTop     = subsetY;
@@ -624,6 +624,55 @@ static void swizzle_rgba16_to_bgra_premul(
     }
 }
 
+// These strip to 8 bits, then convert that in place.  The first pass leaves the row in L1, so
+// the second costs little, and each pass is vectorized.
+static void fast_swizzle_rgba16_to_rgba_unpremul(
+        void* dst, const uint8_t* src, int width, int bpp, int deltaSrc, int offset,
+        const SkPMColor ctable[]) {
+
+    // This function must not be called if we are sampling.  If we are not
+    // sampling, deltaSrc should equal bpp.
+    SkASSERT(deltaSrc == bpp);
+
+    SkOpts::RGBA16_to_RGBA((uint32_t*) dst, src + offset, width);
+}
+
+static void fast_swizzle_rgba16_to_rgba_premul(
+        void* dst, const uint8_t* src, int width, int bpp, int deltaSrc, int offset,
+        const SkPMColor ctable[]) {
+
+    // This function must not be called if we are sampling.  If we are not
+    // sampling, deltaSrc should equal bpp.
+    SkASSERT(deltaSrc == bpp);
+
+    SkOpts::RGBA16_to_RGBA((uint32_t*) dst, src + offset, width);
+    SkOpts::RGBA_to_rgbA((uint32_t*) dst, (const uint32_t*) dst, width);
+}
+
+static void fast_swizzle_rgba16_to_bgra_unpremul(
+        void* dst, const uint8_t* src, int width, int bpp, int deltaSrc, int offset,
+        const SkPMColor ctable[]) {
+
+    // This function must not be called if we are sampling.  If we are not
+    // sampling, deltaSrc should equal bpp.
+    SkASSERT(deltaSrc == bpp);
+
+    SkOpts::RGBA16_to_RGBA((uint32_t*) dst, src + offset, width);
+    SkOpts::RGBA_to_BGRA((uint32_t*) dst, (const uint32_t*) dst, width);
+}
+
+static void fast_swizzle_rgba16_to_bgra_premul(
+        void* dst, const uint8_t* src, int width, int bpp, int deltaSrc, int offset,
+        const SkPMColor ctable[]) {
+
+    // This function must not be called if we are sampling.  If we are not
+    // sampling, deltaSrc should equal bpp.
+    SkASSERT(deltaSrc == bpp);
+
+    SkOpts::RGBA16_to_RGBA((uint32_t*) dst, src + offset, width);
+    SkOpts::RGBA_to_bgrA((uint32_t*) dst, (const uint32_t*) dst, width);
+}
+
 // kCMYK
 //
 // CMYK is stored as four bytes per pixel.
@@ -983,6 +1032,8 @@ std::unique_ptr<SkSwizzler> SkSwizzler::Make(const SkEncodedInfo& encodedInfo,
                     if (16 == encodedInfo.bitsPerComponent()) {
                         proc = premultiply ? &swizzle_rgba16_to_rgba_premul :
                                              &swizzle_rgba16_to_rgba_unpremul;
+                        fastProc = premultiply ? &fast_swizzle_rgba16_to_rgba_premul :
+                                                 &fast_swizzle_rgba16_to_rgba_unpremul;
                         break;
                     }
 
@@ -1010,6 +1061,8 @@ std::unique_ptr<SkSwizzler> SkSwizzler::Make(const SkEncodedInfo& encodedInfo,
                     if (16 == encodedInfo.bitsPerComponent()) {
                         proc = premultiply ? &swizzle_rgba16_to_bgra_premul :
                                              &swizzle_rgba16_to_bgra_unpremul;
+                        fastProc = premultiply ? &fast_swizzle_rgba16_to_bgra_premul :
+                                                 &fast_swizzle_rgba16_to_bgra_unpremul;
                         break;
                     }
 
@@ -1236,3 +1289,23 @@ void SkSwizzler::swizzle(void* dst, const uint8_t* SK_RESTRICT src) {
     fActualProc(SkTAddOffset<void>(dst, fDstOffsetBytes), src, fSwizzleWidth, fSrcBPP,
             fSampleX * fSrcBPP, fSrcOffsetUnits, fColorTable);
 }
+
+void SkSwizzler::swizzleRows(void* dst, size_t dstRowBytes,
+                             const uint8_t* SK_RESTRICT src, size_t srcRowBytes, int count) {
+    SkASSERT(nullptr != dst && nullptr != src);
+    // The fast procs are only used without sampling, and always work on whole bytes.
+    const bool packed = fFastProc && fActualProc == fFastProc
+                     && 0 == fSrcOffsetUnits && 0 == fDstOffsetBytes
+                     && srcRowBytes == (size_t) fSwizzleWidth * fSrcBPP
+                     && dstRowBytes == (size_t) fSwizzleWidth * fDstBPP;
+    if (packed) {
+        fActualProc(dst, src, fSwizzleWidth * count, fSrcBPP, fSrcBPP, 0, fColorTable);
+        return;
+    }
+
+    for (int y = 0; y < count; y++) {
+        this->swizzle(dst, src);
+        dst = SkTAddOffset<void>(dst, dstRowBytes);
+        src = SkTAddOffset<const uint8_t>(src, srcRowBytes);
+    }
+}
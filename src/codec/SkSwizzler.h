@@ -61,6 +61,14 @@ public:
      */
     void swizzle(void* dst, const uint8_t* SK_RESTRICT src);
 
+    /**
+     *  Swizzle count consecutive rows, as if by calling swizzle() on each.
+     *  When the rows on both sides are tightly packed and we are neither
+     *  sampling nor subsetting, they are converted in a single call.
+     */
+    void swizzleRows(void* dst, size_t dstRowBytes,
+                     const uint8_t* SK_RESTRICT src, size_t srcRowBytes, int count);
+
     int fillWidth() const override {
         return fAllocatedWidth;
     }
@@ -555,6 +555,45 @@ void SkBitmapDevice::drawAtlas(const SkRSXform xform[],
     BDDraw(this).drawAtlas(xform, tex, colors, count, std::move(blender), paint);
 }
 
+void SkBitmapDevice::drawEdgeAAImageSet(const SkCanvas::ImageSetEntry set[], int count,
+                                        const SkPoint dstClips[],
+                                        const SkMatrix preViewMatrices[],
+                                        const SkSamplingOptions& sampling, const SkPaint& paint,
+                                        SkCanvas::SrcRectConstraint constraint) {
+    // Sampling outside of src is fine unless we are filtering, or asked not to.
+    const bool canBatch = constraint == SkCanvas::kFast_SrcRectConstraint ||
+                          sampling == SkSamplingOptions();
+
+    // Consecutive entries drawing the same image without a dst clip are drawn with one blitter.
+    // We never reorder entries, as overlapping entries have to blend in order.
+    int clipIndex = 0;
+    for (int i = 0; i < count;) {
+        int run = 1;
+        if (canBatch && !set[i].fHasClip) {
+            while (i + run < count && set[i + run].fImage == set[i].fImage &&
+                   !set[i + run].fHasClip) {
+                run++;
+            }
+
+            const SkImage_Base* image = as_IB(set[i].fImage.get());
+            SkBitmap bitmap;
+            if (run > 1 && image->getROPixels(image->directContext(), &bitmap) &&
+                BDDraw(this).drawImageSet(bitmap, set + i, run, preViewMatrices, sampling, paint)) {
+                i += run;
+                continue;
+            }
+        }
+
+        const SkPoint* clips = dstClips ? dstClips + clipIndex : nullptr;
+        this->INHERITED::drawEdgeAAImageSet(set + i, run, clips, preViewMatrices, sampling, paint,
+                                            constraint);
+        for (int j = i; j < i + run; ++j) {
+            clipIndex += set[j].fHasClip ? 4 : 0;
+        }
+        i += run;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void SkBitmapDevice::drawDevice(SkBaseDevice* device, const SkSamplingOptions& sampling,
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkBlurPriv_DEFINED
+#define SkBlurPriv_DEFINED
+
+#include "include/core/SkTypes.h"
+
+class SkExecutor;
+
+// CPU blurs (SkMaskBlurFilter and SkBlurImageFilter) blur each row or column of a pass on its own,
+// so bands of them can run on SkGraphics::SetBlurExecutor()'s executor with identical results.
+
+// Blurs smaller than this are faster on one thread than it takes to hand out the work.
+static constexpr int64_t kMinPixelsPerThreadedBlur = 256 * 256;
+
+// Rows or columns blurred by each task.
+static constexpr int kLinesPerBlurBand = 32;
+
+// Returns the executor to blur a pass over this many pixels on, or nullptr to blur it on the
+// calling thread.
+SkExecutor* SkBlurExecutorFor(int64_t pixels);
+
+// For tests: while alive, blurs started on this thread use the given executor (nullptr for none)
+// instead of SkGraphics::GetBlurExecutor(), without touching the process-wide setting.
+class SkScopedBlurExecutor {
+public:
+    explicit SkScopedBlurExecutor(SkExecutor*);
+    ~SkScopedBlurExecutor();
+
+    SkScopedBlurExecutor(const SkScopedBlurExecutor&) = delete;
+    SkScopedBlurExecutor& operator=(const SkScopedBlurExecutor&) = delete;
+
+private:
+    SkScopedBlurExecutor* fPrev;
+    SkExecutor*           fExecutor;
+
+    friend SkExecutor* SkBlurExecutorFor(int64_t);
+};
+
+#endif  // SkBlurPriv_DEFINED
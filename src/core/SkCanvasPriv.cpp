@@ -112,6 +112,10 @@ void SkCanvasPriv::DrawMesh(SkCanvas* canvas,
 
 #if GR_TEST_UTILS
 
+SkStrikeDeviceInfo SkCanvasPriv::TopDeviceStrikeDeviceInfo(SkCanvas* canvas) {
+    return canvas->topDevice()->strikeDeviceInfo();
+}
+
 #if SK_SUPPORT_GPU
 #include "src/gpu/ganesh/BaseDevice.h"
 
@@ -13,6 +13,7 @@
 
 class SkReadBuffer;
 class SkWriteBuffer;
+struct SkStrikeDeviceInfo;
 
 #if GR_TEST_UTILS
 namespace skgpu {
@@ -74,6 +75,8 @@ public:
     static skgpu::v1::SurfaceDrawContext* TopDeviceSurfaceDrawContext(SkCanvas*);
 #endif
     static skgpu::SurfaceFillContext* TopDeviceSurfaceFillContext(SkCanvas*);
+    // The surface props and scaler context flags the top device makes glyph strikes with.
+    static SkStrikeDeviceInfo TopDeviceStrikeDeviceInfo(SkCanvas*);
 #endif // GR_TEST_UTILS
     static GrRenderTargetProxy* TopDeviceTargetProxy(SkCanvas*);
 
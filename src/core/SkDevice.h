@@ -52,6 +52,10 @@ struct SkStrikeDeviceInfo {
     const SkScalerContextFlags fScalerContextFlags;
     // This is a pointer so this can be compiled without SK_GPU_SUPPORT.
     const sktext::gpu::SDFTControl* const fSDFTControl;
+    // Rasterize glyph masks as sub runs are created, instead of when they are first added to the
+    // atlas. Devices that record on one thread for another thread to flush set this, so that the
+    // recording threads do the rasterizing.
+    const bool fPrepareGlyphImages = false;
 };
 
 class SkBaseDevice : public SkRefCnt, public SkMatrixProvider {
@@ -72,6 +72,11 @@ public:
                       bool skipColorXform) const;
     void  drawAtlas(const SkRSXform[], const SkRect[], const SkColor[], int count,
                     sk_sp<SkBlender>, const SkPaint&);
+    /* Draws entries that all sample the same bitmap, without dst clips, with one blitter.
+       Returns false, having drawn nothing, if they have to be drawn one at a time. */
+    bool  drawImageSet(const SkBitmap&, const SkCanvas::ImageSetEntry[], int count,
+                       const SkMatrix preViewMatrices[], const SkSamplingOptions&,
+                       const SkPaint&) const;
 
     /**
      *  Overwrite the target with the path's coverage (i.e. its mask).
@@ -14,6 +14,7 @@
 #include "src/core/SkColorSpaceXformSteps.h"
 #include "src/core/SkCoreBlitters.h"
 #include "src/core/SkDraw.h"
+#include "src/core/SkImagePriv.h"
 #include "src/core/SkMatrixProvider.h"
 #include "src/core/SkRasterClip.h"
 #include "src/core/SkRasterPipeline.h"
@@ -23,11 +24,16 @@
 #include "src/shaders/SkShaderBase.h"
 
 static void fill_rect(const SkMatrix& ctm, const SkRasterClip& rc,
-                      const SkRect& r, SkBlitter* blitter, SkPath* scratchPath) {
+                      const SkRect& r, SkBlitter* blitter, SkPath* scratchPath,
+                      bool antiAlias = false) {
     if (ctm.rectStaysRect()) {
         SkRect dr;
         ctm.mapRect(&dr, r);
-        SkScan::FillRect(dr, rc, blitter);
+        if (antiAlias) {
+            SkScan::AntiFillRect(dr, rc, blitter);
+        } else {
+            SkScan::FillRect(dr, rc, blitter);
+        }
     } else {
         SkPoint pts[4];
         r.toQuad(pts);
@@ -35,7 +41,11 @@ static void fill_rect(const SkMatrix& ctm, const SkRasterClip& rc,
 
         scratchPath->rewind();
         scratchPath->addPoly(pts, 4, true);
-        SkScan::FillPath(*scratchPath, rc, blitter);
+        if (antiAlias) {
+            SkScan::AntiFillPath(*scratchPath, rc, blitter);
+        } else {
+            SkScan::FillPath(*scratchPath, rc, blitter);
+        }
     }
 }
 
@@ -214,3 +224,86 @@ void SkDraw::drawAtlas(const SkRSXform xform[],
         }
     }
 }
+
+bool SkDraw::drawImageSet(const SkBitmap& bitmap,
+                          const SkCanvas::ImageSetEntry set[],
+                          int count,
+                          const SkMatrix preViewMatrices[],
+                          const SkSamplingOptions& sampling,
+                          const SkPaint& paint) const {
+    if (gUseSkVMBlitter || paint.getMaskFilter()) {
+        return false;
+    }
+
+    SkSTArenaAlloc<256> alloc;
+
+    SkPaint p(paint);
+    p.setStyle(SkPaint::kFill_Style);
+    p.setShader(nullptr);
+
+    // This is the shader drawImageRect() would use, but with its matrix updated for each entry.
+    // Alpha-only images are blended with the paint color, so they have no updatable stages.
+    sk_sp<SkShader> shader = SkMakeBitmapShaderForPaint(paint, bitmap, SkTileMode::kClamp,
+                                                        SkTileMode::kClamp, sampling, nullptr,
+                                                        kNever_SkCopyPixelsMode);
+    if (!shader) {
+        return false;
+    }
+
+    SkRasterPipeline pipeline(&alloc);
+    SkStageRec rec = {&pipeline,
+                      &alloc,
+                      fDst.colorType(),
+                      fDst.colorSpace(),
+                      p,
+                      nullptr,
+                      *fMatrixProvider};
+    SkStageUpdater* updater = as_SB(shader.get())->appendUpdatableStages(rec);
+    if (!updater) {
+        return false;
+    }
+
+    // Like colors in drawAtlas(), each entry's alpha is late-bound, if any of them needs it.
+    float* alpha = nullptr;
+    bool isOpaque = shader->isOpaque() && p.getAlphaf() == 1;
+    for (int i = 0; i < count && isOpaque; ++i) {
+        isOpaque = set[i].fAlpha == 1;
+    }
+    if (!isOpaque) {
+        alpha = alloc.make<float>(1.0f);
+        pipeline.append(SkRasterPipeline::scale_1_float, alpha);
+    }
+
+    auto blitter = SkCreateRasterPipelineBlitter(
+            fDst, p, pipeline, isOpaque, &alloc, fRC->clipShader());
+    if (!blitter) {
+        return false;
+    }
+    SkPath scratchPath;
+
+    const SkRect bounds = SkRect::Make(bitmap.bounds());
+    for (int i = 0; i < count; ++i) {
+        // As drawImageRect() does, only draw the part of src that is inside the image.
+        SkRect src = set[i].fSrcRect;
+        if (src.isEmpty() || !src.intersect(bounds)) {
+            continue;
+        }
+        if (alpha) {
+            *alpha = p.getAlphaf() * set[i].fAlpha;
+        }
+
+        SkMatrix mx = SkMatrix::RectToRect(set[i].fSrcRect, set[i].fDstRect);
+        if (set[i].fMatrixIndex >= 0) {
+            mx.postConcat(preViewMatrices[set[i].fMatrixIndex]);
+        }
+        mx.postConcat(fMatrixProvider->localToDevice());
+
+        // As in SkBaseDevice::drawEdgeAAImageSet(), only entries with all four edges antialiased
+        // are drawn with antialiasing.
+        if (updater->update(mx)) {
+            fill_rect(mx, *fRC, src, blitter, &scratchPath,
+                      set[i].fAAFlags == SkCanvas::kAll_QuadAAFlags);
+        }
+    }
+    return true;
+}
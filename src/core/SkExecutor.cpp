@@ -10,6 +10,8 @@
 #include "include/private/SkSemaphore.h"
 #include "include/private/SkSpinlock.h"
 #include "include/private/SkTArray.h"
+#include "include/private/SkTemplates.h"
+#include <atomic>
 #include <deque>
 #include <thread>
 
@@ -139,6 +141,123 @@ private:
     bool                  fAllowBorrowing;
 };
 
+// The work-stealing pool whose threads the current thread belongs to, if any, and its deque there.
+struct SkWorkerID {
+    const SkExecutor* fPool = nullptr;
+    int               fIndex = 0;
+};
+static thread_local SkWorkerID gCurrentWorker;
+
+// An SkWorkStealingThreadPool gives each of its threads a deque of work. Work added by one of
+// those threads goes on the back of its own deque, where that thread will find it next. Work added
+// by other threads is dealt out across the deques in turn. A thread that runs out of work steals
+// the oldest work from the other deques.
+class SkWorkStealingThreadPool final : public SkExecutor {
+public:
+    explicit SkWorkStealingThreadPool(int threads, bool allowBorrowing)
+            : fQueueCount(threads), fQueues(threads), fAllowBorrowing(allowBorrowing) {
+        for (int i = 0; i < threads; i++) {
+            fThreads.emplace_back(&Loop, this, i);
+        }
+    }
+
+    ~SkWorkStealingThreadPool() override {
+        // Signal one more than there is work for each thread. A thread that finds no work to do
+        // once fShuttingDown is set exits.
+        fShuttingDown.store(true, std::memory_order_relaxed);
+        fWorkAvailable.signal(fThreads.count());
+        for (int i = 0; i < fThreads.count(); i++) {
+            fThreads[i].join();
+        }
+    }
+
+    void add(std::function<void(void)> work) override {
+        int index = gCurrentWorker.fPool == this
+                ? gCurrentWorker.fIndex
+                : fNextQueue.fetch_add(1, std::memory_order_relaxed) % fQueueCount;
+        {
+            SkAutoSpinlock lock(fQueues[index].fLock);
+            fQueues[index].fWork.emplace_back(std::move(work));
+        }
+        fWorkAvailable.signal(1);
+    }
+
+    void borrow() override {
+        // A borrowing thread that is one of ours runs its own most recent work first, which is
+        // usually work it's waiting on.
+        if (fAllowBorrowing && fWorkAvailable.try_wait()) {
+            SkAssertResult(this->do_work());
+        }
+    }
+
+private:
+    struct Queue {
+        SkSpinlock                            fLock;
+        std::deque<std::function<void(void)>> fWork;
+    };
+
+    // Pops the newest work from this thread's own deque, or else the oldest from any other.
+    bool pop(std::function<void(void)>* work) {
+        const int count = SkToInt(fQueueCount);
+        int self = -1;
+        if (gCurrentWorker.fPool == this) {
+            self = gCurrentWorker.fIndex;
+            SkAutoSpinlock lock(fQueues[self].fLock);
+            if (!fQueues[self].fWork.empty()) {
+                *work = std::move(fQueues[self].fWork.back());
+                fQueues[self].fWork.pop_back();
+                return true;
+            }
+        }
+        const int start = self >= 0 ? self + 1
+                                    : fNextQueue.load(std::memory_order_relaxed) % count;
+        for (int i = 0; i < count; i++) {
+            const int index = (start + i) % count;
+            if (index == self) {
+                continue;
+            }
+            Queue& victim = fQueues[index];
+            SkAutoSpinlock lock(victim.fLock);
+            if (!victim.fWork.empty()) {
+                *work = std::move(victim.fWork.front());
+                victim.fWork.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // This method should be called only after taking a count from fWorkAvailable.
+    bool do_work() {
+        std::function<void(void)> work;
+        while (!this->pop(&work)) {
+            if (fShuttingDown.load(std::memory_order_relaxed)) {
+                return false;  // This is Loop()'s signal to shut down.
+            }
+            // Another thread took the work we looked at first. There's more in another deque.
+            std::this_thread::yield();
+        }
+
+        work();
+        return true;
+    }
+
+    static void Loop(SkWorkStealingThreadPool* pool, int index) {
+        gCurrentWorker = {pool, index};
+        do {
+            pool->fWorkAvailable.wait();
+        } while (pool->do_work());
+    }
+
+    SkTArray<std::thread>  fThreads;
+    const uint32_t         fQueueCount;
+    SkAutoTArray<Queue>    fQueues;
+    std::atomic<uint32_t>  fNextQueue{0};
+    SkSemaphore            fWorkAvailable;
+    std::atomic<bool>      fShuttingDown{false};
+    bool                   fAllowBorrowing;
+};
+
 std::unique_ptr<SkExecutor> SkExecutor::MakeFIFOThreadPool(int threads, bool allowBorrowing) {
     using WorkList = std::deque<std::function<void(void)>>;
     return std::make_unique<SkThreadPool<WorkList>>(threads > 0 ? threads : num_cores(),
@@ -149,3 +268,8 @@ std::unique_ptr<SkExecutor> SkExecutor::MakeLIFOThreadPool(int threads, bool all
     return std::make_unique<SkThreadPool<WorkList>>(threads > 0 ? threads : num_cores(),
                                                     allowBorrowing);
 }
+std::unique_ptr<SkExecutor> SkExecutor::MakeWorkStealingThreadPool(int threads,
+                                                                   bool allowBorrowing) {
+    return std::make_unique<SkWorkStealingThreadPool>(threads > 0 ? threads : num_cores(),
+                                                      allowBorrowing);
+}
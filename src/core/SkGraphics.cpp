@@ -18,6 +18,7 @@
 #include "include/core/SkStream.h"
 #include "include/core/SkTime.h"
 #include "src/core/SkBlitter.h"
+#include "src/core/SkBlurPriv.h"
 #include "src/core/SkCpu.h"
 #include "src/core/SkGeometry.h"
 #include "src/core/SkImageFilter_Base.h"
@@ -28,6 +29,7 @@
 #include "src/core/SkTSearch.h"
 #include "src/core/SkTypefaceCache.h"
 
+#include <atomic>
 #include <stdlib.h>
 
 void SkGraphics::Init() {
@@ -159,3 +161,32 @@ extern bool gSkVMAllowJIT;
 void SkGraphics::AllowJIT() {
     gSkVMAllowJIT = true;
 }
+
+static std::atomic<SkExecutor*> gBlurExecutor{nullptr};
+
+SkExecutor* SkGraphics::SetBlurExecutor(SkExecutor* executor) {
+    return gBlurExecutor.exchange(executor, std::memory_order_acq_rel);
+}
+
+SkExecutor* SkGraphics::GetBlurExecutor() {
+    return gBlurExecutor.load(std::memory_order_acquire);
+}
+
+static thread_local SkScopedBlurExecutor* gScopedBlurExecutor = nullptr;
+
+SkScopedBlurExecutor::SkScopedBlurExecutor(SkExecutor* executor)
+        : fPrev(gScopedBlurExecutor), fExecutor(executor) {
+    gScopedBlurExecutor = this;
+}
+
+SkScopedBlurExecutor::~SkScopedBlurExecutor() {
+    SkASSERT(gScopedBlurExecutor == this);
+    gScopedBlurExecutor = fPrev;
+}
+
+SkExecutor* SkBlurExecutorFor(int64_t pixels) {
+    if (pixels < kMinPixelsPerThreadedBlur) {
+        return nullptr;
+    }
+    return gScopedBlurExecutor ? gScopedBlurExecutor->fExecutor : SkGraphics::GetBlurExecutor();
+}
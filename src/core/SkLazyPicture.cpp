@@ -0,0 +1,112 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkLazyPicture.h"
+
+#include "include/core/SkTextBlob.h"
+#include "include/core/SkVertices.h"
+#include "include/utils/SkNoDrawCanvas.h"
+#include "src/core/SkPicturePlayback.h"
+#include "src/core/SkReadBuffer.h"
+
+#if SK_SUPPORT_GPU
+#include "include/private/chromium/Slug.h"
+#endif
+
+namespace {
+
+// SkPicturePlayback asks whether to abort before it reads each command.
+class OpCounter final : public SkPicture::AbortCallback {
+public:
+    bool abort() override {
+        fCount++;
+        return false;
+    }
+
+    int fCount = 0;
+};
+
+// Counts nested ops like SkBigPicture: a picture drawn by reference counts as its own ops.
+class NestedOpCounter final : public SkNoDrawCanvas {
+public:
+    explicit NestedOpCounter(const SkRect& cull) : SkNoDrawCanvas(cull.roundOut()) {}
+
+    int fPictureOps = 0;
+    int fPictures = 0;
+
+protected:
+    void onDrawPicture(const SkPicture* picture, const SkMatrix*, const SkPaint*) override {
+        fPictureOps += picture->approximateOpCount(true);
+        fPictures++;
+    }
+};
+
+}  // namespace
+
+sk_sp<SkLazyPicture> SkLazyPicture::Make(const SkPictInfo& info,
+                                         std::unique_ptr<SkPictureData> data) {
+    if (!data || !data->opData()) {
+        return nullptr;
+    }
+
+    // Eager deserialization would stop recording at the first command it can't decode. Finding
+    // that out now, rather than at every playback, costs decoding the commands twice, but not
+    // keeping them.
+    OpCounter ops;
+    NestedOpCounter canvas(info.fCullRect);
+    SkReadBuffer validity;
+    SkPicturePlayback(data.get()).draw(&canvas, &ops, &validity);
+    if (!validity.isValid()) {
+        return nullptr;
+    }
+
+    const int nestedOpCount = ops.fCount - canvas.fPictures + canvas.fPictureOps;
+    return sk_sp<SkLazyPicture>(
+            new SkLazyPicture(info, std::move(data), ops.fCount, nestedOpCount));
+}
+
+SkLazyPicture::SkLazyPicture(const SkPictInfo& info, std::unique_ptr<SkPictureData> data,
+                             int opCount, int nestedOpCount)
+        : fInfo(info)
+        , fData(std::move(data))
+        , fOpCount(opCount)
+        , fNestedOpCount(nestedOpCount)
+        , fDataBytes(fData->approximateBytesUsed()) {}
+
+SkLazyPicture::~SkLazyPicture() = default;
+
+void SkLazyPicture::playback(SkCanvas* canvas, AbortCallback* callback) const {
+    SkASSERT(canvas);
+
+    // A picture drawn once may never be drawn again, so the first playback decodes commands
+    // straight into the canvas. One drawn twice is likely to be drawn many more times, so from
+    // then on it's worth having decoded them all into a recording.
+    if (!fPlayedBack.exchange(true, std::memory_order_relaxed)) {
+        SkPicturePlayback(fData.get()).draw(canvas, callback, nullptr);
+        return;
+    }
+    this->recorded()->playback(canvas, callback);
+}
+
+const SkPicture* SkLazyPicture::recorded() const {
+    fRecordOnce([this] {
+        fRecorded = SkPicture::Forwardport(fInfo, fData.get(), nullptr);
+        fRecordedBytes.store(fRecorded ? fRecorded->approximateBytesUsed() : 0,
+                             std::memory_order_relaxed);
+    });
+    return fRecorded.get();
+}
+
+SkRect SkLazyPicture::cullRect() const { return fInfo.fCullRect; }
+
+int SkLazyPicture::approximateOpCount(bool nested) const {
+    return nested ? fNestedOpCount : fOpCount;
+}
+
+size_t SkLazyPicture::approximateBytesUsed() const {
+    return sizeof(*this) + fDataBytes + fRecordedBytes.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkLazyPicture_DEFINED
+#define SkLazyPicture_DEFINED
+
+#include "include/core/SkPicture.h"
+#include "include/private/SkOnce.h"
+#include "src/core/SkPictureData.h"
+
+#include <atomic>
+#include <memory>
+
+// An SkPicture made by SkPicture::MakeLazyFromData(), which keeps its drawing commands in their
+// serialized form. The first playback decodes each command as it replays it. Later playbacks
+// replay a picture recorded from the commands the first time one is needed.
+class SkLazyPicture final : public SkPicture {
+public:
+    // Reads through the commands once, without drawing or keeping them, to check that they can
+    // all be decoded and to count them. Returns nullptr if they can't.
+    static sk_sp<SkLazyPicture> Make(const SkPictInfo&, std::unique_ptr<SkPictureData>);
+
+    ~SkLazyPicture() override;
+
+    void playback(SkCanvas*, AbortCallback*) const override;
+    SkRect cullRect() const override;
+    int approximateOpCount(bool nested) const override;
+    size_t approximateBytesUsed() const override;
+
+private:
+    SkLazyPicture(const SkPictInfo&, std::unique_ptr<SkPictureData>, int opCount,
+                  int nestedOpCount);
+
+    const SkPicture* recorded() const;
+
+    const SkPictInfo                     fInfo;
+    std::unique_ptr<const SkPictureData> fData;
+    const int                            fOpCount;
+    const int                            fNestedOpCount;  // Counting the ops of nested pictures.
+    const size_t                         fDataBytes;
+
+    mutable std::atomic<bool>            fPlayedBack{false};
+    mutable SkOnce                       fRecordOnce;
+    mutable sk_sp<SkPicture>             fRecorded;
+    mutable std::atomic<size_t>          fRecordedBytes{0};
+};
+
+#endif//SkLazyPicture_DEFINED
@@ -8,13 +8,16 @@
 #include "src/core/SkMaskBlurFilter.h"
 
 #include "include/core/SkColorPriv.h"
+#include "include/core/SkExecutor.h"
 #include "include/private/SkMalloc.h"
 #include "include/private/SkTPin.h"
 #include "include/private/SkTemplates.h"
 #include "include/private/SkTo.h"
 #include "include/private/SkVx.h"
 #include "src/core/SkArenaAlloc.h"
+#include "src/core/SkBlurPriv.h"
 #include "src/core/SkGaussFilter.h"
+#include "src/core/SkTaskGroup.h"
 
 #include <cmath>
 #include <climits>
@@ -956,6 +959,18 @@ static SkIPoint small_blur(double sigmaX, double sigmaY, const SkMask& src, SkMa
     return {radiusX, radiusY};
 }
 
+// Blurs bands of rows on the executor (see SkBlurPriv.h), each with its own scan buffer.
+template <typename BlurRowsFn>
+static void blur_in_bands(SkExecutor& executor, int rows, size_t bufferSize,
+                          BlurRowsFn&& blurRows) {
+    SkTaskGroup bands(executor);
+    bands.batch((rows + kLinesPerBlurBand - 1) / kLinesPerBlurBand, [&](int i) {
+        SkAutoTMalloc<uint32_t> buffer(bufferSize);
+        blurRows(i * kLinesPerBlurBand, std::min(rows, (i + 1) * kLinesPerBlurBand), buffer.get());
+    });
+    bands.wait();
+}
+
 // TODO: assuming sigmaW = sigmaH. Allow different sigmas. Right now the
 // API forces the sigmas to be the same.
 SkIPoint SkMaskBlurFilter::blur(const SkMask& src, SkMask* dst) const {
@@ -989,9 +1004,6 @@ SkIPoint SkMaskBlurFilter::blur(const SkMask& src, SkMask* dst) const {
         dstH = dst->fBounds.height();
     SkASSERT(srcW >= 0 && srcH >= 0 && dstW >= 0 && dstH >= 0);
 
-    auto bufferSize = std::max(planW.bufferSize(), planH.bufferSize());
-    auto buffer = alloc.makeArrayDefault<uint32_t>(bufferSize);
-
     // Blur both directions.
     int tmpW = srcH,
         tmpH = dstW;
@@ -1003,57 +1015,71 @@ SkIPoint SkMaskBlurFilter::blur(const SkMask& src, SkMask* dst) const {
     auto tmp = alloc.makeArrayDefault<uint8_t>(tmpW * tmpH);
 
     // Blur horizontally, and transpose.
-    const PlanGauss::Scan& scanW = planW.makeBlurScan(srcW, buffer);
-    switch (src.fFormat) {
-        case SkMask::kBW_Format: {
-            const uint8_t* bwStart = src.fImage;
-            auto start = SkMask::AlphaIter<SkMask::kBW_Format>(bwStart, 0);
-            auto end = SkMask::AlphaIter<SkMask::kBW_Format>(bwStart + (srcW / 8), srcW % 8);
-            for (int y = 0; y < srcH; ++y, start >>= src.fRowBytes, end >>= src.fRowBytes) {
-                auto tmpStart = &tmp[y];
-                scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
-            }
-        } break;
-        case SkMask::kA8_Format: {
-            const uint8_t* a8Start = src.fImage;
-            auto start = SkMask::AlphaIter<SkMask::kA8_Format>(a8Start);
-            auto end = SkMask::AlphaIter<SkMask::kA8_Format>(a8Start + srcW);
-            for (int y = 0; y < srcH; ++y, start >>= src.fRowBytes, end >>= src.fRowBytes) {
-                auto tmpStart = &tmp[y];
-                scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
-            }
-        } break;
-        case SkMask::kARGB32_Format: {
-            const uint32_t* argbStart = reinterpret_cast<const uint32_t*>(src.fImage);
-            auto start = SkMask::AlphaIter<SkMask::kARGB32_Format>(argbStart);
-            auto end = SkMask::AlphaIter<SkMask::kARGB32_Format>(argbStart + srcW);
-            for (int y = 0; y < srcH; ++y, start >>= src.fRowBytes, end >>= src.fRowBytes) {
-                auto tmpStart = &tmp[y];
-                scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
-            }
-        } break;
-        case SkMask::kLCD16_Format: {
-            const uint16_t* lcdStart = reinterpret_cast<const uint16_t*>(src.fImage);
-            auto start = SkMask::AlphaIter<SkMask::kLCD16_Format>(lcdStart);
-            auto end = SkMask::AlphaIter<SkMask::kLCD16_Format>(lcdStart + srcW);
-            for (int y = 0; y < srcH; ++y, start >>= src.fRowBytes, end >>= src.fRowBytes) {
-                auto tmpStart = &tmp[y];
-                scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
-            }
-        } break;
-        default:
-            SK_ABORT("Unhandled format.");
-    }
+    auto blurRows = [&](int yStart, int yEnd, uint32_t* buffer) {
+        const PlanGauss::Scan& scanW = planW.makeBlurScan(srcW, buffer);
+        const size_t srcRB = src.fRowBytes;
+        const uint8_t* rowStart = src.fImage + yStart * srcRB;
+        switch (src.fFormat) {
+            case SkMask::kBW_Format: {
+                auto start = SkMask::AlphaIter<SkMask::kBW_Format>(rowStart, 0);
+                auto end = SkMask::AlphaIter<SkMask::kBW_Format>(rowStart + (srcW / 8), srcW % 8);
+                for (int y = yStart; y < yEnd; ++y, start >>= srcRB, end >>= srcRB) {
+                    auto tmpStart = &tmp[y];
+                    scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
+                }
+            } break;
+            case SkMask::kA8_Format: {
+                auto start = SkMask::AlphaIter<SkMask::kA8_Format>(rowStart);
+                auto end = SkMask::AlphaIter<SkMask::kA8_Format>(rowStart + srcW);
+                for (int y = yStart; y < yEnd; ++y, start >>= srcRB, end >>= srcRB) {
+                    auto tmpStart = &tmp[y];
+                    scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
+                }
+            } break;
+            case SkMask::kARGB32_Format: {
+                const uint32_t* argbStart = reinterpret_cast<const uint32_t*>(rowStart);
+                auto start = SkMask::AlphaIter<SkMask::kARGB32_Format>(argbStart);
+                auto end = SkMask::AlphaIter<SkMask::kARGB32_Format>(argbStart + srcW);
+                for (int y = yStart; y < yEnd; ++y, start >>= srcRB, end >>= srcRB) {
+                    auto tmpStart = &tmp[y];
+                    scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
+                }
+            } break;
+            case SkMask::kLCD16_Format: {
+                const uint16_t* lcdStart = reinterpret_cast<const uint16_t*>(rowStart);
+                auto start = SkMask::AlphaIter<SkMask::kLCD16_Format>(lcdStart);
+                auto end = SkMask::AlphaIter<SkMask::kLCD16_Format>(lcdStart + srcW);
+                for (int y = yStart; y < yEnd; ++y, start >>= srcRB, end >>= srcRB) {
+                    auto tmpStart = &tmp[y];
+                    scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
+                }
+            } break;
+            default:
+                SK_ABORT("Unhandled format.");
+        }
+    };
 
     // Blur vertically (scan in memory order because of the transposition),
     // and transpose back to the original orientation.
-    const PlanGauss::Scan& scanH = planH.makeBlurScan(tmpW, buffer);
-    for (int y = 0; y < tmpH; y++) {
-        auto tmpStart = &tmp[y * tmpW];
-        auto dstStart = &dst->fImage[y];
+    auto blurColumns = [&](int yStart, int yEnd, uint32_t* buffer) {
+        const PlanGauss::Scan& scanH = planH.makeBlurScan(tmpW, buffer);
+        for (int y = yStart; y < yEnd; y++) {
+            auto tmpStart = &tmp[y * tmpW];
+            auto dstStart = &dst->fImage[y];
+
+            scanH.blur(tmpStart, tmpStart + tmpW,
+                       dstStart, dst->fRowBytes, dstStart + dst->fRowBytes * dstH);
+        }
+    };
 
-        scanH.blur(tmpStart, tmpStart + tmpW,
-                   dstStart, dst->fRowBytes, dstStart + dst->fRowBytes * dstH);
+    auto bufferSize = std::max(planW.bufferSize(), planH.bufferSize());
+    if (SkExecutor* executor = SkBlurExecutorFor((int64_t)srcW * srcH)) {
+        blur_in_bands(*executor, srcH, bufferSize, blurRows);
+        blur_in_bands(*executor, tmpH, bufferSize, blurColumns);
+    } else {
+        auto buffer = alloc.makeArrayDefault<uint32_t>(bufferSize);
+        blurRows(0, srcH, buffer);
+        blurColumns(0, tmpH, buffer);
     }
 
     return {SkTo<int32_t>(borderW), SkTo<int32_t>(borderH)};
@@ -70,6 +70,7 @@ namespace SkOpts {
     DEFINE_DEFAULT(gray_to_RGB1);
     DEFINE_DEFAULT(grayA_to_RGBA);
     DEFINE_DEFAULT(grayA_to_rgbA);
+    DEFINE_DEFAULT(RGBA16_to_RGBA);
     DEFINE_DEFAULT(inverted_CMYK_to_RGB1);
     DEFINE_DEFAULT(inverted_CMYK_to_BGR1);
 
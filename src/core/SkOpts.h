@@ -47,7 +47,8 @@ namespace SkOpts {
                            RGB_to_BGR1,     // i.e. swap RB and insert an opaque alpha
                            gray_to_RGB1,    // i.e. expand to color channels + an opaque alpha
                            grayA_to_RGBA,   // i.e. expand to color channels
-                           grayA_to_rgbA;   // i.e. expand to color channels and premultiply
+                           grayA_to_rgbA,   // i.e. expand to color channels and premultiply
+                           RGBA16_to_RGBA;  // i.e. keep the high byte of big-endian components
 
     extern void (*memset16)(uint16_t[], uint16_t, int);
     extern void SK_SPI(*memset32)(uint32_t[], uint32_t, int);
@@ -12,6 +12,7 @@
 #include "include/core/SkSerialProcs.h"
 #include "include/private/SkTo.h"
 #include "src/core/SkCanvasPriv.h"
+#include "src/core/SkLazyPicture.h"
 #include "src/core/SkMathPriv.h"
 #include "src/core/SkPictureCommon.h"
 #include "src/core/SkPictureData.h"
@@ -160,6 +161,32 @@ sk_sp<SkPicture> SkPicture::MakeFromData(const SkData* data, const SkDeserialPro
     return MakeFromStream(&stream, procs, nullptr);
 }
 
+sk_sp<SkPicture> SkPicture::MakeLazyFromData(const SkData* data,
+                                             const SkDeserialProcs* procsPtr) {
+    if (!data) {
+        return nullptr;
+    }
+    SkMemoryStream stream(data->data(), data->size());
+    SkPictInfo info;
+    uint8_t trailingStreamByteAfterPictInfo;
+    if (!StreamIsSKP(&stream, &info) || !stream.readU8(&trailingStreamByteAfterPictInfo)) {
+        return nullptr;
+    }
+    if (trailingStreamByteAfterPictInfo != kPictureData_TrailingStreamByteAfterPictInfo) {
+        // There are no commands of ours to defer decoding. Custom pictures are up to fPictureProc.
+        stream.rewind();
+        return MakeFromStream(&stream, procsPtr, nullptr);
+    }
+
+    SkDeserialProcs procs;
+    if (procsPtr) {
+        procs = *procsPtr;
+    }
+    std::unique_ptr<SkPictureData> pictureData(
+            SkPictureData::CreateFromStream(&stream, info, procs, nullptr));
+    return SkLazyPicture::Make(info, std::move(pictureData));
+}
+
 sk_sp<SkPicture> SkPicture::MakeFromStream(SkStream* stream, const SkDeserialProcs* procsPtr,
                                            SkTypefacePlayback* typefaces) {
     SkPictInfo info;
@@ -553,6 +553,37 @@ bool SkPictureData::parseBuffer(SkReadBuffer& buffer) {
     return true;
 }
 
+size_t SkPictureData::approximateBytesUsed() const {
+    size_t bytes = sizeof(*this) + (fOpData ? fOpData->size() : 0)
+                 + fPaints.count() * sizeof(SkPaint);
+    for (const SkPath& path : fPaths) {
+        bytes += path.approximateBytesUsed();
+    }
+    for (const auto& pic : fPictures) {
+        bytes += pic->approximateBytesUsed();
+    }
+    for (const auto& drawable : fDrawables) {
+        bytes += drawable->approximateBytesUsed();
+    }
+    for (const auto& blob : fTextBlobs) {
+        bytes += sizeof(SkTextBlob);
+        for (SkTextBlobRunIterator it(blob.get()); !it.done(); it.next()) {
+            bytes += it.glyphCount() * (sizeof(SkGlyphID) + it.scalarsPerGlyph() * sizeof(SkScalar))
+                   + (it.clusters() ? it.glyphCount() * sizeof(uint32_t) : 0)
+                   + it.textSize();
+        }
+    }
+    for (const auto& vertices : fVertices) {
+        bytes += vertices->approximateSize();
+    }
+    for (const auto& image : fImages) {
+        // Lazy images keep their encoded data until they're drawn.
+        sk_sp<SkData> encoded = image->isLazyGenerated() ? image->refEncodedData() : nullptr;
+        bytes += encoded ? encoded->size() : image->imageInfo().computeMinByteSize();
+    }
+    return bytes;
+}
+
 const SkPaint* SkPictureData::optionalPaint(SkReadBuffer* reader) const {
     int index = reader->readInt();
     if (index == 0) {
@@ -91,6 +91,9 @@ public:
 
     const sk_sp<SkData>& opData() const { return fOpData; }
 
+    // The op data and the objects it refers to, like SkPicture::approximateBytesUsed().
+    size_t approximateBytesUsed() const;
+
 protected:
     explicit SkPictureData(const SkPictInfo& info);
 
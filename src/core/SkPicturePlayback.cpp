@@ -64,7 +64,7 @@ void SkPicturePlayback::draw(SkCanvas* canvas,
         }
 
         if (!reader.validate(size > 0 && op > UNUSED && op <= LAST_DRAWTYPE_ENUM)) {
-            return;
+            break;
         }
 
         this->handleOp(&reader, (DrawType)op, size, canvas, initialMatrix);
@@ -7,6 +7,8 @@
 
 #include "src/core/SkRTree.h"
 
+#include "include/private/SkVx.h"
+
 SkRTree::SkRTree() : fCount(0) {}
 
 void SkRTree::insert(const SkRect boundsArray[], int N) {
@@ -33,7 +35,7 @@ void SkRTree::insert(const SkRect boundsArray[], int N) {
             fNodes.reserve(1);
             Node* n = this->allocateNodeAtLevel(0);
             n->fNumChildren = 1;
-            n->fChildren[0] = branches[0];
+            n->setChild(0, branches[0]);
             fRoot.fSubtree = n;
             fRoot.fBounds  = branches[0].fBounds;
         } else {
@@ -45,14 +47,29 @@ void SkRTree::insert(const SkRect boundsArray[], int N) {
 
 SkRTree::Node* SkRTree::allocateNodeAtLevel(uint16_t level) {
     SkDEBUGCODE(Node* p = fNodes.data());
-    fNodes.push_back(Node{});
-    Node& out = fNodes.back();
+    Node& out = fNodes.emplace_back();
     SkASSERT(fNodes.data() == p);  // If this fails, we didn't reserve() enough.
     out.fNumChildren = 0;
     out.fLevel = level;
+    for (int i = 0; i < kPaddedChildren; i++) {
+        out.fLeft[i] = out.fTop[i] = SK_FloatInfinity;
+        out.fRight[i] = out.fBottom[i] = SK_FloatNegativeInfinity;
+    }
     return &out;
 }
 
+void SkRTree::Node::setChild(int i, const Branch& branch) {
+    fLeft[i]   = branch.fBounds.fLeft;
+    fTop[i]    = branch.fBounds.fTop;
+    fRight[i]  = branch.fBounds.fRight;
+    fBottom[i] = branch.fBounds.fBottom;
+    if (fLevel == 0) {
+        fChildren[i].fOpIndex = branch.fOpIndex;
+    } else {
+        fChildren[i].fSubtree = branch.fSubtree;
+    }
+}
+
 // This function parallels bulkLoad, but just counts how many nodes bulkLoad would allocate.
 int SkRTree::CountNodes(int branches) {
     if (branches == 1) {
@@ -123,14 +140,14 @@ SkRTree::Branch SkRTree::bulkLoad(std::vector<Branch>* branches, int level) {
         }
         Node* n = allocateNodeAtLevel(level);
         n->fNumChildren = 1;
-        n->fChildren[0] = (*branches)[currentBranch];
+        n->setChild(0, (*branches)[currentBranch]);
         Branch b;
         b.fBounds = (*branches)[currentBranch].fBounds;
         b.fSubtree = n;
         ++currentBranch;
         for (int k = 1; k < incrementBy && currentBranch < (int)branches->size(); ++k) {
             b.fBounds.join((*branches)[currentBranch].fBounds);
-            n->fChildren[k] = (*branches)[currentBranch];
+            n->setChild(k, (*branches)[currentBranch]);
             ++n->fNumChildren;
             ++currentBranch;
         }
@@ -148,12 +165,29 @@ void SkRTree::search(const SkRect& query, std::vector<int>* results) const {
 }
 
 void SkRTree::search(Node* node, const SkRect& query, std::vector<int>* results) const {
-    for (int i = 0; i < node->fNumChildren; ++i) {
-        if (SkRect::Intersects(node->fChildren[i].fBounds, query)) {
+    // Stored bounds are never empty and the query isn't either, so testing each edge against the
+    // opposite edge of the query matches SkRect::Intersects().
+    using float4 = skvx::Vec<4, float>;
+    const float4 queryL = query.fLeft,
+                 queryT = query.fTop,
+                 queryR = query.fRight,
+                 queryB = query.fBottom;
+    for (int i = 0; i < node->fNumChildren; i += 4) {
+        const auto hits = (float4::Load(node->fLeft   + i) < queryR) &
+                          (float4::Load(node->fTop    + i) < queryB) &
+                          (queryL < float4::Load(node->fRight  + i)) &
+                          (queryT < float4::Load(node->fBottom + i));
+        if (!any(hits)) {
+            continue;
+        }
+        for (int j = i; j < i + 4; ++j) {
+            if (!hits[j - i]) {
+                continue;
+            }
             if (0 == node->fLevel) {
-                results->push_back(node->fChildren[i].fOpIndex);
+                results->push_back(node->fChildren[j].fOpIndex);
             } else {
-                this->search(node->fChildren[i].fSubtree, query, results);
+                this->search(node->fChildren[j].fSubtree, query, results);
             }
         }
     }
@@ -57,10 +57,23 @@ private:
         SkRect fBounds;
     };
 
+    // A node keeps its children's bounds edge by edge, so that search() can test four children
+    // against the query at once. Slots past fNumChildren hold bounds that intersect nothing.
+    static constexpr int kPaddedChildren = (kMaxChildren + 3) & ~3;
+
     struct Node {
         uint16_t fNumChildren;
         uint16_t fLevel;
-        Branch fChildren[kMaxChildren];
+        float fLeft  [kPaddedChildren],
+              fTop   [kPaddedChildren],
+              fRight [kPaddedChildren],
+              fBottom[kPaddedChildren];
+        union {
+            Node* fSubtree;
+            int fOpIndex;
+        } fChildren[kMaxChildren];
+
+        void setChild(int i, const Branch&);
     };
 
     void search(Node* root, const SkRect& query, std::vector<int>* results) const;
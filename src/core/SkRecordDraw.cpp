@@ -7,6 +7,8 @@
 
 #include "include/core/SkBBHFactory.h"
 #include "include/core/SkImage.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkRegion.h"
 #include "include/private/SkTDArray.h"
 #include "src/core/SkCanvasPriv.h"
 #include "src/core/SkColorFilterBase.h"
@@ -14,6 +16,8 @@
 #include "src/core/SkRecordDraw.h"
 #include "src/utils/SkPatchUtils.h"
 
+#include <vector>
+
 void SkRecordDraw(const SkRecord& record,
                   SkCanvas* canvas,
                   SkPicture const* const drawablePicts[],
@@ -577,3 +581,186 @@ void SkRecordFillBounds(const SkRect& cullRect, const SkRecord& record,
         }
     }
 }
+
+namespace SkRecords {
+
+// Decides whether two ops at the same index draw the same thing, given that every op before them
+// did.  Anything we can't compare cheaply is treated as different: that only costs us a little
+// extra damage.  Refs to immutable objects (images, pictures, text blobs, effects in paints) are
+// compared by identity.
+class SameOp {
+public:
+    template <typename A, typename B>
+    bool operator()(const A&, const B&) const { return false; }
+
+    template <typename T>
+    bool operator()(const T& a, const T& b) const { return Same(a, b); }
+
+private:
+    template <typename T>
+    static bool Same(const T&, const T&) { return false; }
+
+    template <typename T>
+    static bool SameOptional(const Optional<T>& a, const Optional<T>& b) {
+        return a ? (b && *a == *b) : !b;
+    }
+    static bool SameOpAA(const ClipOpAndAA& a, const ClipOpAndAA& b) {
+        return a.op() == b.op() && a.aa() == b.aa();
+    }
+
+    static bool Same(const NoOp&, const NoOp&) { return true; }
+    static bool Same(const Save&, const Save&) { return true; }
+    static bool Same(const ResetClip&, const ResetClip&) { return true; }
+    static bool Same(const Restore& a, const Restore& b) { return a.matrix == b.matrix; }
+    static bool Same(const SaveLayer& a, const SaveLayer& b) {
+        return SameOptional(a.bounds, b.bounds) && SameOptional(a.paint, b.paint) &&
+               a.backdrop == b.backdrop && a.saveLayerFlags == b.saveLayerFlags &&
+               a.backdropScale == b.backdropScale;
+    }
+    static bool Same(const SaveBehind& a, const SaveBehind& b) {
+        return SameOptional(a.subset, b.subset);
+    }
+
+    static bool Same(const SetMatrix& a, const SetMatrix& b) { return a.matrix == b.matrix; }
+    static bool Same(const SetM44& a, const SetM44& b)       { return a.matrix == b.matrix; }
+    static bool Same(const Concat& a, const Concat& b)       { return a.matrix == b.matrix; }
+    static bool Same(const Concat44& a, const Concat44& b)   { return a.matrix == b.matrix; }
+    static bool Same(const Translate& a, const Translate& b) {
+        return a.dx == b.dx && a.dy == b.dy;
+    }
+    static bool Same(const Scale& a, const Scale& b) { return a.sx == b.sx && a.sy == b.sy; }
+
+    static bool Same(const ClipPath& a, const ClipPath& b) {
+        return a.path == b.path && SameOpAA(a.opAA, b.opAA);
+    }
+    static bool Same(const ClipRRect& a, const ClipRRect& b) {
+        return a.rrect == b.rrect && SameOpAA(a.opAA, b.opAA);
+    }
+    static bool Same(const ClipRect& a, const ClipRect& b) {
+        return a.rect == b.rect && SameOpAA(a.opAA, b.opAA);
+    }
+    static bool Same(const ClipRegion& a, const ClipRegion& b) {
+        return a.region == b.region && a.op == b.op;
+    }
+    static bool Same(const ClipShader& a, const ClipShader& b) {
+        return a.shader == b.shader && a.op == b.op;
+    }
+
+    static bool Same(const DrawArc& a, const DrawArc& b) {
+        return a.paint == b.paint && a.oval == b.oval && a.startAngle == b.startAngle &&
+               a.sweepAngle == b.sweepAngle && a.useCenter == b.useCenter;
+    }
+    static bool Same(const DrawDRRect& a, const DrawDRRect& b) {
+        return a.paint == b.paint && a.outer == b.outer && a.inner == b.inner;
+    }
+    static bool Same(const DrawImage& a, const DrawImage& b) {
+        return SameOptional(a.paint, b.paint) && a.image == b.image &&
+               a.left == b.left && a.top == b.top && a.sampling == b.sampling;
+    }
+    static bool Same(const DrawImageRect& a, const DrawImageRect& b) {
+        return SameOptional(a.paint, b.paint) && a.image == b.image && a.src == b.src &&
+               a.dst == b.dst && a.sampling == b.sampling && a.constraint == b.constraint;
+    }
+    static bool Same(const DrawOval& a, const DrawOval& b) {
+        return a.paint == b.paint && a.oval == b.oval;
+    }
+    static bool Same(const DrawPaint& a, const DrawPaint& b) { return a.paint == b.paint; }
+    static bool Same(const DrawPath& a, const DrawPath& b) {
+        return a.paint == b.paint && a.path == b.path;
+    }
+    static bool Same(const DrawPicture& a, const DrawPicture& b) {
+        return SameOptional(a.paint, b.paint) && a.picture == b.picture && a.matrix == b.matrix;
+    }
+    static bool Same(const DrawPoints& a, const DrawPoints& b) {
+        return a.paint == b.paint && a.mode == b.mode && a.count == b.count &&
+               0 == memcmp(a.pts, b.pts, a.count * sizeof(SkPoint));
+    }
+    static bool Same(const DrawRRect& a, const DrawRRect& b) {
+        return a.paint == b.paint && a.rrect == b.rrect;
+    }
+    static bool Same(const DrawRect& a, const DrawRect& b) {
+        return a.paint == b.paint && a.rect == b.rect;
+    }
+    static bool Same(const DrawRegion& a, const DrawRegion& b) {
+        return a.paint == b.paint && a.region == b.region;
+    }
+    static bool Same(const DrawTextBlob& a, const DrawTextBlob& b) {
+        return a.paint == b.paint && a.blob == b.blob && a.x == b.x && a.y == b.y;
+    }
+    static bool Same(const DrawEdgeAAQuad& a, const DrawEdgeAAQuad& b) {
+        return a.rect == b.rect && a.aa == b.aa && a.color == b.color && a.mode == b.mode &&
+               (a.clip ? (b.clip && 0 == memcmp(a.clip, b.clip, 4 * sizeof(SkPoint)))
+                       : !b.clip);
+    }
+};
+
+}  // namespace SkRecords
+
+// Unions rects[0..count), pairwise so each SkRegion op stays small.
+static void union_rects(const SkIRect rects[], int count, SkRegion* region) {
+    if (count <= 8) {
+        region->setRects(rects, count);
+        return;
+    }
+    SkRegion right;
+    union_rects(rects, count / 2, region);
+    union_rects(rects + count / 2, count - count / 2, &right);
+    region->op(right, SkRegion::kUnion_Op);
+}
+
+void SkRecordComputeDamage(const SkRecord& before, const SkRect beforeBounds[],
+                           const SkRecord& after, const SkRect afterBounds[],
+                           SkRegion* damage) {
+    std::vector<SkIRect> rects;
+    auto addDamage = [&](const SkRect& bounds) {
+        if (!bounds.isEmpty()) {
+            rects.push_back(bounds.roundOut());
+        }
+    };
+
+    const int common = std::min(before.count(), after.count());
+    for (int i = 0; i < common; i++) {
+        // The bounds of a control op cover every draw it affects, so this is enough to catch
+        // changes to matrices, clips and layers too.
+        const bool same = beforeBounds[i] == afterBounds[i] &&
+                          before.visit(i, [&](const auto& a) {
+                              return after.visit(i, [&](const auto& b) {
+                                  return SkRecords::SameOp()(a, b);
+                              });
+                          });
+        if (!same) {
+            addDamage(beforeBounds[i]);
+            addDamage(afterBounds[i]);
+        }
+    }
+    for (int i = common; i < before.count(); i++) {
+        addDamage(beforeBounds[i]);
+    }
+    for (int i = common; i < after.count(); i++) {
+        addDamage(afterBounds[i]);
+    }
+
+    union_rects(rects.data(), SkToInt(rects.size()), damage);
+}
+
+void SkRecordDrawDamage(const SkRecord& record, SkCanvas* canvas, const SkRegion& damage,
+                        SkPicture const* const drawablePicts[], SkDrawable* const drawables[],
+                        int drawableCount, const SkBBoxHierarchy* bbh) {
+    if (damage.isEmpty()) {
+        return;
+    }
+    SkAutoCanvasRestore saveRestore(canvas, true /*save now, restore at exit*/);
+
+    // The damage is in identity space, which is only device space for an identity matrix.
+    if (canvas->getTotalMatrix().isIdentity()) {
+        canvas->clipRegion(damage);
+    } else {
+        SkPath path;
+        damage.getBoundaryPath(&path);
+        canvas->clipPath(path);
+    }
+    canvas->clear(SK_ColorTRANSPARENT);
+
+    // With the clip set, SkRecordDraw() only replays ops that intersect the damage.
+    SkRecordDraw(record, canvas, drawablePicts, drawables, drawableCount, bbh, nullptr);
+}
@@ -16,6 +16,7 @@
 
 class SkDrawable;
 class SkLayerInfo;
+class SkRegion;
 
 // Calculate conservative identity space bounds for each op in the record.
 void SkRecordFillBounds(const SkRect& cullRect, const SkRecord&,
@@ -27,6 +28,20 @@ void SkRecordFillBounds(const SkRect& cullRect, const SkRecord&,
 void SkRecordComputeLayers(const SkRect& cullRect, const SkRecord&, SkRect bounds[],
                            const SkBigPicture::SnapshotArray*, SkLayerInfo* data);
 
+// Compare two records op-by-op, given the bounds SkRecordFillBounds() calculated for each, and
+// set damage to the identity space area where drawing after may produce different pixels than
+// drawing before.  This is conservative: ops that can't be compared cheaply count as changed.
+void SkRecordComputeDamage(const SkRecord& before, const SkRect beforeBounds[],
+                           const SkRecord& after, const SkRect afterBounds[],
+                           SkRegion* damage);
+
+// Update a canvas that still holds the pixels of an earlier record, drawn onto transparent black,
+// to show this record instead.  The damage from SkRecordComputeDamage() is cleared, and only the
+// ops that intersect it (found with the bbh, if there is one) are replayed, clipped to it.
+void SkRecordDrawDamage(const SkRecord&, SkCanvas*, const SkRegion& damage,
+                        SkPicture const* const drawablePicts[], SkDrawable* const drawables[],
+                        int drawableCount, const SkBBoxHierarchy*);
+
 // Draw an SkRecord into an SkCanvas.  A convenience wrapper around SkRecords::Draw.
 void SkRecordDraw(const SkRecord&, SkCanvas*, SkPicture const* const drawablePicts[],
                   SkDrawable* const drawables[], int drawableCount,
@@ -9,6 +9,7 @@
 
 #include "include/core/SkCapabilities.h"
 #include "include/core/SkColorFilter.h"
+#include "include/core/SkMilestone.h"
 #include "include/core/SkData.h"
 #include "include/core/SkSurface.h"
 #include "include/private/SkMutex.h"
@@ -26,12 +27,16 @@
 #include "src/core/SkRasterPipeline.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkRuntimeEffectPriv.h"
+#include "src/core/SkTraceEvent.h"
 #include "src/core/SkUtils.h"
 #include "src/core/SkVM.h"
 #include "src/core/SkWriteBuffer.h"
 #include "src/sksl/SkSLAnalysis.h"
 #include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/SkSLDehydrator.h"
+#include "src/sksl/SkSLRehydrator.h"
 #include "src/sksl/SkSLSharedCompiler.h"
+#include "src/sksl/SkSLStringStream.h"
 #include "src/sksl/SkSLUtil.h"
 #include "src/sksl/codegen/SkSLVMCodeGenerator.h"
 #include "src/sksl/ir/SkSLFunctionDefinition.h"
@@ -323,8 +328,7 @@ SkRuntimeEffect::Result SkRuntimeEffect::MakeFromSource(SkString sksl,
     std::unique_ptr<SkSL::Program> program;
     {
         // We keep this SharedCompiler in a separate scope to make sure it's destroyed before
-        // calling the Make overload at the end, which creates its own (non-reentrant)
-        // SharedCompiler instance
+        // calling the Make overload at the end, which borrows its own SharedCompiler instance
         SkSL::SharedCompiler compiler;
         SkSL::Program::Settings settings = MakeSettings(options);
         program = compiler->convertProgram(kind, std::string(sksl.c_str(), sksl.size()), settings);
@@ -476,8 +480,7 @@ sk_sp<SkRuntimeEffect> SkRuntimeEffect::makeUnoptimizedClone() {
     std::unique_ptr<SkSL::Program> program;
     {
         // We keep this SharedCompiler in a separate scope to make sure it's destroyed before
-        // calling MakeInternal at the end, which creates its own (non-reentrant) SharedCompiler
-        // instance.
+        // calling MakeInternal at the end, which borrows its own SharedCompiler instance.
         SkSL::SharedCompiler compiler;
         SkSL::Program::Settings settings = MakeSettings(options);
         program = compiler->convertProgram(kind, *fBaseProgram->fSource, settings);
@@ -522,6 +525,124 @@ SkRuntimeEffect::Result SkRuntimeEffect::MakeForBlender(SkString sksl, const Opt
     return result;
 }
 
+// The blobs made by compiledProgram() are this header, followed by the dehydrated program.
+struct CompiledProgramHeader {
+    uint32_t fMagic;
+    uint32_t fVersion;
+    uint32_t fModuleHash;  // SkSL::Compiler::RuntimeEffectModuleHash()
+    uint32_t fHash;        // SkRuntimeEffect::hash(), which covers the SkSL and the Options
+    uint32_t fKind;        // SkSL::ProgramKind, since the same SkSL can make several kinds
+    uint32_t fChecksum;    // of the dehydrated program, to reject damaged blobs
+};
+
+static constexpr uint32_t kCompiledProgramMagic = SkSetFourByteTag('s', 'k', 'r', 'p');
+
+// Rehydrated programs refer to the built-in modules by name, so blobs are only valid for the
+// binary format and modules they were made with. The modules can change without a new milestone
+// (or binary format), so we check a hash of their data too.
+static constexpr uint32_t kCompiledProgramVersion = (SK_MILESTONE << 16) |
+                                                    SkSL::Rehydrator::kVersion;
+
+sk_sp<SkData> SkRuntimeEffect::compiledProgram() const {
+    SkSL::Dehydrator dehydrator;
+    dehydrator.write(*fBaseProgram);
+    SkSL::StringStream stream;
+    dehydrator.finish(stream);
+    if (!dehydrator.isValid()) {
+        return nullptr;
+    }
+    const std::string& program = stream.str();
+
+    CompiledProgramHeader header;
+    header.fMagic      = kCompiledProgramMagic;
+    header.fVersion    = kCompiledProgramVersion;
+    header.fModuleHash = SkSL::Compiler::RuntimeEffectModuleHash();
+    header.fHash       = fHash;
+    header.fKind       = (uint32_t)fBaseProgram->fConfig->fKind;
+    header.fChecksum   = SkOpts::hash_fn(program.data(), program.size(), 0);
+
+    sk_sp<SkData> data = SkData::MakeUninitialized(sizeof(header) + program.size());
+    auto* bytes = static_cast<uint8_t*>(data->writable_data());
+    memcpy(bytes, &header, sizeof(header));
+    memcpy(bytes + sizeof(header), program.data(), program.size());
+    return data;
+}
+
+SkRuntimeEffect::Result SkRuntimeEffect::MakeFromCompiledProgram(SkString sksl,
+                                                                 const SkData& compiled,
+                                                                 const Options& options,
+                                                                 SkSL::ProgramKind kind) {
+    TRACE_EVENT0("skia.shaders", "SkRuntimeEffect::MakeFromCompiledProgram");
+
+    CompiledProgramHeader header;
+    if (compiled.size() <= sizeof(header)) {
+        return Result{nullptr, SkString("compiled program is truncated")};
+    }
+    memcpy(&header, compiled.data(), sizeof(header));
+    if (header.fMagic      != kCompiledProgramMagic   ||
+        header.fVersion    != kCompiledProgramVersion ||
+        header.fModuleHash != SkSL::Compiler::RuntimeEffectModuleHash()) {
+        return Result{nullptr, SkString("compiled program is from a different version of Skia")};
+    }
+    if (header.fHash != HashSourceAndOptions(std::string_view(sksl.c_str(), sksl.size()),
+                                             options)) {
+        return Result{nullptr, SkString("compiled program is for different SkSL or options")};
+    }
+    if (header.fKind != (uint32_t)kind) {
+        return Result{nullptr, SkString("compiled program is for a different kind of effect")};
+    }
+    const uint8_t* program = compiled.bytes() + sizeof(header);
+    size_t programSize = compiled.size() - sizeof(header);
+    if (header.fChecksum != SkOpts::hash_fn(program, programSize, 0)) {
+        return Result{nullptr, SkString("compiled program is damaged")};
+    }
+
+    std::unique_ptr<SkSL::Program> baseProgram;
+    {
+        // As in MakeFromSource, this SharedCompiler must be released before MakeInternal.
+        SkSL::SharedCompiler compiler;
+        SkSL::Rehydrator rehydrator(*compiler, program, programSize);
+        baseProgram = rehydrator.program();
+    }
+    if (!baseProgram) {
+        return Result{nullptr, SkString("compiled program could not be rehydrated")};
+    }
+    if (baseProgram->fConfig->fKind != kind) {
+        return Result{nullptr, SkString("compiled program is for a different kind of effect")};
+    }
+
+    // The rehydrated program doesn't carry its source or settings; restore them so the effect is
+    // indistinguishable from one compiled from source.
+    baseProgram->fSource = std::make_unique<std::string>(sksl.c_str(), sksl.size());
+    baseProgram->fConfig->fSettings = MakeSettings(options);
+    return MakeInternal(std::move(baseProgram), options, kind);
+}
+
+SkRuntimeEffect::Result SkRuntimeEffect::MakeForColorFilterFromCompiledProgram(
+        SkString sksl, const SkData& compiled, const Options& options) {
+    auto result = MakeFromCompiledProgram(std::move(sksl), compiled, options,
+                                          SkSL::ProgramKind::kRuntimeColorFilter);
+    SkASSERT(!result.effect || result.effect->allowColorFilter());
+    return result;
+}
+
+SkRuntimeEffect::Result SkRuntimeEffect::MakeForShaderFromCompiledProgram(
+        SkString sksl, const SkData& compiled, const Options& options) {
+    auto programKind = options.usePrivateRTShaderModule ? SkSL::ProgramKind::kPrivateRuntimeShader
+                                                        : SkSL::ProgramKind::kRuntimeShader;
+    auto result = MakeFromCompiledProgram(std::move(sksl), compiled, options, programKind);
+    SkASSERT(!result.effect || result.effect->allowShader());
+    return result;
+}
+
+SkRuntimeEffect::Result SkRuntimeEffect::MakeForBlenderFromCompiledProgram(
+        SkString sksl, const SkData& compiled, const Options& options) {
+    auto result = MakeFromCompiledProgram(std::move(sksl), compiled, options,
+                                          SkSL::ProgramKind::kRuntimeBlender);
+    SkASSERT(!result.effect || result.effect->allowBlender());
+    return result;
+}
+
 sk_sp<SkRuntimeEffect> SkMakeCachedRuntimeEffect(SkRuntimeEffect::Result (*make)(SkString sksl),
                                                  SkString sksl) {
     SK_BEGIN_REQUIRE_DENSE
@@ -595,7 +716,7 @@ SkRuntimeEffect::SkRuntimeEffect(std::unique_ptr<SkSL::Program> baseProgram,
                                  std::vector<Child>&& children,
                                  std::vector<SkSL::SampleUsage>&& sampleUsages,
                                  uint32_t flags)
-        : fHash(SkOpts::hash_fn(baseProgram->fSource->c_str(), baseProgram->fSource->size(), 0))
+        : fHash(HashSourceAndOptions(*baseProgram->fSource, options))
         , fBaseProgram(std::move(baseProgram))
         , fMain(main)
         , fUniforms(std::move(uniforms))
@@ -605,27 +726,32 @@ SkRuntimeEffect::SkRuntimeEffect(std::unique_ptr<SkSL::Program> baseProgram,
     SkASSERT(fBaseProgram);
     SkASSERT(fChildren.size() == fSampleUsages.size());
 
+    fFilterColorProgram = SkFilterColorProgram::Make(this);
+}
+
+SkRuntimeEffect::~SkRuntimeEffect() = default;
+
+uint32_t SkRuntimeEffect::HashSourceAndOptions(std::string_view sksl, const Options& options) {
+    uint32_t hash = SkOpts::hash_fn(sksl.data(), sksl.size(), 0);
+
     // Everything from SkRuntimeEffect::Options which could influence the compiled result needs to
-    // be accounted for in `fHash`. If you've added a new field to Options and caused the static-
-    // assert below to trigger, please incorporate your field into `fHash` and update KnownOptions
+    // be accounted for in the hash. If you've added a new field to Options and caused the static-
+    // assert below to trigger, please incorporate your field into the hash and update KnownOptions
     // to match the layout of Options.
     struct KnownOptions {
         bool forceUnoptimized, usePrivateRTShaderModule;
         SkSL::Version maxVersionAllowed;
     };
     static_assert(sizeof(Options) == sizeof(KnownOptions));
-    fHash = SkOpts::hash_fn(&options.forceUnoptimized,
-                      sizeof(options.forceUnoptimized), fHash);
-    fHash = SkOpts::hash_fn(&options.usePrivateRTShaderModule,
-                      sizeof(options.usePrivateRTShaderModule), fHash);
-    fHash = SkOpts::hash_fn(&options.maxVersionAllowed,
-                      sizeof(options.maxVersionAllowed), fHash);
-
-    fFilterColorProgram = SkFilterColorProgram::Make(this);
+    hash = SkOpts::hash_fn(&options.forceUnoptimized,
+                           sizeof(options.forceUnoptimized), hash);
+    hash = SkOpts::hash_fn(&options.usePrivateRTShaderModule,
+                           sizeof(options.usePrivateRTShaderModule), hash);
+    hash = SkOpts::hash_fn(&options.maxVersionAllowed,
+                           sizeof(options.maxVersionAllowed), hash);
+    return hash;
 }
 
-SkRuntimeEffect::~SkRuntimeEffect() = default;
-
 const std::string& SkRuntimeEffect::source() const {
     return *fBaseProgram->fSource;
 }
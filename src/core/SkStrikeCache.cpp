@@ -7,6 +7,7 @@
 
 #include "src/core/SkStrikeCache.h"
 
+#include <algorithm>
 #include <cctype>
 
 #include "include/core/SkGraphics.h"
@@ -23,6 +24,26 @@
 
 bool gSkUseThreadLocalStrikeCaches_IAcknowledgeThisIsIncrediblyExperimental = false;
 
+namespace {
+// The last few strikes this thread found, most recent first. They are only trusted while fEpoch
+// matches the epoch of the cache being searched: a cache changes its epoch whenever it removes a
+// strike, so until then each of these is still owned, and kept alive, by that cache.
+struct HotStrikes {
+    static constexpr int kCount = 4;
+    uint32_t  fEpoch = 0;
+    SkStrike* fStrikes[kCount] = {};
+};
+
+thread_local HotStrikes gHotStrikes;
+}  // namespace
+
+uint32_t SkStrikeCache::NewEpoch() {
+    // Epochs are unique across caches, so a thread switching between caches never mixes them up.
+    // Zero is never handed out, so an empty HotStrikes matches no cache.
+    static std::atomic<uint32_t> nextEpoch{1};
+    return nextEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
 SkStrikeCache* SkStrikeCache::GlobalStrikeCache() {
     if (gSkUseThreadLocalStrikeCaches_IAcknowledgeThisIsIncrediblyExperimental) {
         static thread_local auto* cache = new SkStrikeCache;
@@ -33,7 +54,12 @@ SkStrikeCache* SkStrikeCache::GlobalStrikeCache() {
 }
 
 auto SkStrikeCache::findOrCreateStrike(const SkStrikeSpec& strikeSpec) -> sk_sp<SkStrike> {
-    SkAutoMutexExclusive ac(fLock);
+    if (sk_sp<SkStrike> strike = this->findStrike(strikeSpec.descriptor())) {
+        return strike;
+    }
+
+    SkAutoSharedMutexExclusive ac(fLock);
+    // Another thread may have created the strike since we looked.
     sk_sp<SkStrike> strike = this->internalFindStrikeOrNull(strikeSpec.descriptor());
     if (strike == nullptr) {
         strike = this->internalCreateStrike(strikeSpec);
@@ -120,12 +146,54 @@ void SkStrikeCache::DumpMemoryStatistics(SkTraceMemoryDump* dump) {
 }
 
 sk_sp<SkStrike> SkStrikeCache::findStrike(const SkDescriptor& desc) {
-    SkAutoMutexExclusive ac(fLock);
-    sk_sp<SkStrike> result = this->internalFindStrikeOrNull(desc);
+    sk_sp<SkStrike> result;
+    {
+        SkAutoSharedMutexShared ac(fLock);
+        result = this->internalFindStrikeShared(desc);
+        // Strikes grow as glyphs are added, so purge here too, but only when needed.
+        if (!this->internalIsOverBudget()) {
+            return result;
+        }
+    }
+
+    SkAutoSharedMutexExclusive ac(fLock);
     this->internalPurge();
     return result;
 }
 
+auto SkStrikeCache::internalFindStrikeShared(const SkDescriptor& desc) -> sk_sp<SkStrike> {
+    HotStrikes& hot = gHotStrikes;
+    if (hot.fEpoch != fEpoch) {
+        hot = HotStrikes{};
+        hot.fEpoch = fEpoch;
+    }
+
+    SkStrike** const strikes = hot.fStrikes;
+    int found = 0;
+    while (found < HotStrikes::kCount &&
+           strikes[found] != nullptr &&
+           strikes[found]->getDescriptor() != desc) {
+        found++;
+    }
+
+    SkStrike* strikePtr;
+    if (found < HotStrikes::kCount && strikes[found] != nullptr) {
+        strikePtr = strikes[found];
+    } else {
+        sk_sp<SkStrike>* strikeHandle = fStrikeLookup.find(desc);
+        if (strikeHandle == nullptr) { return nullptr; }
+        strikePtr = strikeHandle->get();
+        SkASSERT(strikePtr != nullptr);
+        found = HotStrikes::kCount - 1;
+    }
+
+    // Make most recently used, for this thread. The LRU list is fixed up by the next purge.
+    std::move_backward(strikes, strikes + found, strikes + found + 1);
+    strikes[0] = strikePtr;
+    strikePtr->fRecentlyUsed.store(true, std::memory_order_relaxed);
+    return sk_ref_sp(strikePtr);
+}
+
 auto SkStrikeCache::internalFindStrikeOrNull(const SkDescriptor& desc) -> sk_sp<SkStrike> {
 
     // Check head because it is likely the strike we are looking for.
@@ -156,7 +224,7 @@ sk_sp<SkStrike> SkStrikeCache::createStrike(
         const SkStrikeSpec& strikeSpec,
         SkFontMetrics* maybeMetrics,
         std::unique_ptr<SkStrikePinner> pinner) {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexExclusive ac(fLock);
     return this->internalCreateStrike(strikeSpec, maybeMetrics, std::move(pinner));
 }
 
@@ -172,27 +240,27 @@ auto SkStrikeCache::internalCreateStrike(
 }
 
 void SkStrikeCache::purgeAll() {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexExclusive ac(fLock);
     this->internalPurge(fTotalMemoryUsed);
 }
 
 size_t SkStrikeCache::getTotalMemoryUsed() const {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexShared ac(fLock);
     return fTotalMemoryUsed;
 }
 
 int SkStrikeCache::getCacheCountUsed() const {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexShared ac(fLock);
     return fCacheCount;
 }
 
 int SkStrikeCache::getCacheCountLimit() const {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexShared ac(fLock);
     return fCacheCountLimit;
 }
 
 size_t SkStrikeCache::setCacheSizeLimit(size_t newLimit) {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexExclusive ac(fLock);
 
     size_t prevLimit = fCacheSizeLimit;
     fCacheSizeLimit = newLimit;
@@ -201,7 +269,7 @@ size_t SkStrikeCache::setCacheSizeLimit(size_t newLimit) {
 }
 
 size_t  SkStrikeCache::getCacheSizeLimit() const {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexShared ac(fLock);
     return fCacheSizeLimit;
 }
 
@@ -210,7 +278,7 @@ int SkStrikeCache::setCacheCountLimit(int newCount) {
         newCount = 0;
     }
 
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexExclusive ac(fLock);
 
     int prevCount = fCacheCountLimit;
     fCacheCountLimit = newCount;
@@ -219,7 +287,7 @@ int SkStrikeCache::setCacheCountLimit(int newCount) {
 }
 
 void SkStrikeCache::forEachStrike(std::function<void(const SkStrike&)> visitor) const {
-    SkAutoMutexExclusive ac(fLock);
+    SkAutoSharedMutexShared ac(fLock);
 
     this->validate();
 
@@ -228,6 +296,10 @@ void SkStrikeCache::forEachStrike(std::function<void(const SkStrike&)> visitor)
     }
 }
 
+bool SkStrikeCache::internalIsOverBudget() const {
+    return fTotalMemoryUsed > fCacheSizeLimit || fCacheCount > fCacheCountLimit;
+}
+
 size_t SkStrikeCache::internalPurge(size_t minBytesNeeded) {
     size_t bytesNeeded = 0;
     if (fTotalMemoryUsed > fCacheSizeLimit) {
@@ -251,6 +323,8 @@ size_t SkStrikeCache::internalPurge(size_t minBytesNeeded) {
         return 0;
     }
 
+    this->internalPromoteRecentlyUsed();
+
     size_t  bytesFreed = 0;
     int     countFreed = 0;
 
@@ -281,6 +355,48 @@ size_t SkStrikeCache::internalPurge(size_t minBytesNeeded) {
     return bytesFreed;
 }
 
+void SkStrikeCache::internalPromoteRecentlyUsed() {
+    // Move the strikes found under the shared lock to the head, keeping their relative order.
+    SkStrike* usedHead = nullptr;
+    SkStrike* usedTail = nullptr;
+    SkStrike* strike = fHead;
+    while (strike != nullptr) {
+        SkStrike* next = strike->fNext;
+        if (strike->fRecentlyUsed.exchange(false, std::memory_order_relaxed)) {
+            if (strike->fPrev) {
+                strike->fPrev->fNext = next;
+            } else {
+                fHead = next;
+            }
+            if (next) {
+                next->fPrev = strike->fPrev;
+            } else {
+                fTail = strike->fPrev;
+            }
+
+            strike->fPrev = usedTail;
+            strike->fNext = nullptr;
+            if (usedTail) {
+                usedTail->fNext = strike;
+            } else {
+                usedHead = strike;
+            }
+            usedTail = strike;
+        }
+        strike = next;
+    }
+
+    if (usedHead != nullptr) {
+        usedTail->fNext = fHead;
+        if (fHead != nullptr) {
+            fHead->fPrev = usedTail;
+        } else {
+            fTail = usedTail;
+        }
+        fHead = usedHead;
+    }
+}
+
 void SkStrikeCache::internalAttachToHead(sk_sp<SkStrike> strike) {
     SkASSERT(fStrikeLookup.find(strike->getDescriptor()) == nullptr);
     SkStrike* strikePtr = strike.get();
@@ -321,6 +437,8 @@ void SkStrikeCache::internalRemoveStrike(SkStrike* strike) {
     strike->fPrev = strike->fNext = nullptr;
     strike->fRemoved = true;
     fStrikeLookup.remove(strike->getDescriptor());
+    // Other threads may remember this strike; make them look it up again.
+    fEpoch = NewEpoch();
 }
 
 void SkStrikeCache::validate() const {
@@ -356,7 +474,7 @@ void SkStrikeCache::validate() const {
 
 void SkStrike::updateDelta(size_t increase) {
     if (increase != 0) {
-        SkAutoMutexExclusive lock{fStrikeCache->fLock};
+        SkAutoSharedMutexExclusive lock{fStrikeCache->fLock};
         fMemoryUsed += increase;
         if (!fRemoved) {
             fStrikeCache->fTotalMemoryUsed += increase;
@@ -8,6 +8,7 @@
 #ifndef SkStrikeCache_DEFINED
 #define SkStrikeCache_DEFINED
 
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -16,6 +17,7 @@
 #include "include/private/SkTemplates.h"
 #include "src/core/SkDescriptor.h"
 #include "src/core/SkScalerCache.h"
+#include "src/core/SkSharedMutex.h"
 #include "src/core/SkStrikeSpec.h"
 #include "src/text/StrikeForGPU.h"
 
@@ -192,6 +194,9 @@ public:
     std::unique_ptr<SkStrikePinner> fPinner;
     size_t                          fMemoryUsed{sizeof(SkScalerCache)};
     bool                            fRemoved{false};
+    // Set when the strike is found under the cache's shared lock, which can't reorder the LRU
+    // list. The cache moves these strikes to the head before it purges.
+    std::atomic<bool>               fRecentlyUsed{false};
 };  // SkStrike
 
 class SkStrikeCache final : public sktext::StrikeForGPUCacheInterface {
@@ -234,7 +239,12 @@ public:
 
 private:
     friend class SkStrike;  // for SkStrike::updateDelta
+    static uint32_t NewEpoch();
+
     sk_sp<SkStrike> internalFindStrikeOrNull(const SkDescriptor& desc) SK_REQUIRES(fLock);
+    // Looks in this thread's recently found strikes, then in fStrikeLookup. Leaves the LRU list
+    // alone, so only the shared lock is needed.
+    sk_sp<SkStrike> internalFindStrikeShared(const SkDescriptor& desc) SK_REQUIRES_SHARED(fLock);
     sk_sp<SkStrike> internalCreateStrike(
             const SkStrikeSpec& strikeSpec,
             SkFontMetrics* maybeMetrics = nullptr,
@@ -243,6 +253,8 @@ private:
     // The following methods can only be called when mutex is already held.
     void internalRemoveStrike(SkStrike* strike) SK_REQUIRES(fLock);
     void internalAttachToHead(sk_sp<SkStrike> strike) SK_REQUIRES(fLock);
+    void internalPromoteRecentlyUsed() SK_REQUIRES(fLock);
+    bool internalIsOverBudget() const SK_REQUIRES_SHARED(fLock);
 
     // Checkout budgets, modulated by the specified min-bytes-needed-to-purge,
     // and attempt to purge caches to match.
@@ -250,11 +262,13 @@ private:
     size_t internalPurge(size_t minBytesNeeded = 0) SK_REQUIRES(fLock);
 
     // A simple accounting of what each glyph cache reports and the strike cache total.
-    void validate() const SK_REQUIRES(fLock);
+    void validate() const SK_REQUIRES_SHARED(fLock);
 
     void forEachStrike(std::function<void(const SkStrike&)> visitor) const SK_EXCLUDES(fLock);
 
-    mutable SkMutex fLock;
+    // Lookups of existing strikes take fLock shared. Creating, purging and resizing take it
+    // exclusive.
+    mutable SkSharedMutex fLock;
     SkStrike* fHead SK_GUARDED_BY(fLock) {nullptr};
     SkStrike* fTail SK_GUARDED_BY(fLock) {nullptr};
     struct StrikeTraits {
@@ -271,6 +285,9 @@ private:
     size_t  fTotalMemoryUsed SK_GUARDED_BY(fLock) {0};
     int32_t fCacheCountLimit{SK_DEFAULT_FONT_CACHE_COUNT_LIMIT};
     int32_t fCacheCount SK_GUARDED_BY(fLock) {0};
+    // Changes whenever a strike is removed. Each thread's recently found strikes are only used
+    // while the epoch they were found in is current.
+    uint32_t fEpoch SK_GUARDED_BY(fLock) {NewEpoch()};
 };
 
 #endif  // SkStrikeCache_DEFINED
@@ -168,6 +168,10 @@ namespace skvm {
         std::vector<TraceHook*> traceHooks;
         std::unique_ptr<viz::Visualizer> visualizer;
 
+        // See Builder::precompute().  The prologue stores precomputed value k to its args[k+1].
+        std::unique_ptr<Program> prologue;
+        int precompute_offset = 0;
+
         std::atomic<void*> jit_entry{nullptr};   // TODO: minimal std::memory_orders
         size_t jit_size = 0;
         void*  dylib    = nullptr;
@@ -485,6 +489,10 @@ namespace skvm {
             }
             write(o, "\n");
         }
+        if (fImpl->prologue) {
+            o->writeText("precompute: ");
+            fImpl->prologue->dump(o);
+        }
     }
     std::vector<Instruction> eliminate_dead_code(std::vector<Instruction> program,
                                                  viz::Visualizer* visualizer) {
@@ -532,6 +540,71 @@ namespace skvm {
         return program;
     }
 
+    std::vector<Instruction> split_precompute(std::vector<Instruction>* program,
+                                              int ptr, int begin, int end) {
+        // Find the values that only depend on immediates and uniforms in [begin,end) of ptr.
+        // Gathers and array32 are left alone; they could read anything.
+        std::vector<bool> pre(program->size(), false);
+        for (Val id = 0; id < (Val)program->size(); id++) {
+            const Instruction& inst = (*program)[id];
+            if (inst.op == Op::splat) {
+                pre[id] = true;
+            } else if (inst.op == Op::uniform32) {
+                pre[id] = inst.immA == ptr && begin <= inst.immB && inst.immB < end;
+            } else if (Op::add_f32 <= inst.op && inst.op <= Op::select) {
+                pre[id] = true;
+                for (Val arg : {inst.x, inst.y, inst.z, inst.w}) {
+                    if (arg != NA) { pre[id] = pre[id] && pre[arg]; }
+                }
+            }
+        }
+
+        // Every such value that the rest of the program uses gets a slot, unless it's cheaper
+        // to just recreate (splat) or reload (uniform32) it.
+        std::vector<int> slot(program->size(), -1);
+        int slots = 0;
+        for (Val id = 0; id < (Val)program->size(); id++) {
+            const Instruction& inst = (*program)[id];
+            if (!pre[id]) {
+                for (Val arg : {inst.x, inst.y, inst.z, inst.w}) {
+                    if (arg != NA && pre[arg] && slot[arg] < 0 &&
+                            (*program)[arg].op != Op::splat &&
+                            (*program)[arg].op != Op::uniform32) {
+                        slot[arg] = slots++;
+                    }
+                }
+            }
+        }
+        if (slots == 0) {
+            return {};
+        }
+
+        // The prologue computes the slotted values from args[0] (the uniforms), then stores
+        // slot k to args[k+1].  The program loads it back from the uniforms at end + 4k instead.
+        std::vector<Instruction> prologue;
+        std::vector<Val> new_id(program->size(), NA);
+        for (Val id = 0; id < (Val)program->size(); id++) {
+            if (pre[id]) {
+                Instruction inst = (*program)[id];
+                for (Val* arg : {&inst.x, &inst.y, &inst.z, &inst.w}) {
+                    if (*arg != NA) { *arg = new_id[*arg]; }
+                }
+                if (inst.op == Op::uniform32) {
+                    inst.immA = 0;
+                }
+                new_id[id] = (Val)prologue.size();
+                prologue.push_back(inst);
+            }
+        }
+        for (Val id = 0; id < (Val)program->size(); id++) {
+            if (int k = slot[id]; k >= 0) {
+                prologue.push_back({Op::store32, new_id[id],NA,NA,NA, k+1, 0, 0});
+                (*program)[id] = {Op::uniform32, NA,NA,NA,NA, ptr, end + 4*k, 0};
+            }
+        }
+        return prologue;
+    }
+
     std::vector<OptimizedInstruction> finalize(const std::vector<Instruction> program,
                                                viz::Visualizer* visualizer) {
         std::vector<OptimizedInstruction> optimized(program.size());
@@ -604,11 +677,34 @@ namespace skvm {
             debug_name = buf;
         }
 
-        auto optimized = this->optimize(visualizer ? visualizer.get() : nullptr);
-        return {optimized,
-                std::move(visualizer),
-                fStrides,
-                fTraceHooks, debug_name, allow_jit};
+        std::vector<Instruction> program = this->program();
+        std::vector<Instruction> prologue;
+        if (fPrecompute.ptr != NA) {
+            program  = eliminate_dead_code(std::move(program));
+            prologue = split_precompute(&program,
+                                        fPrecompute.ptr, fPrecompute.begin, fPrecompute.end);
+        }
+        program = eliminate_dead_code(std::move(program), visualizer.get());
+        Program p = {finalize(std::move(program), visualizer.get()),
+                     std::move(visualizer),
+                     fStrides,
+                     fTraceHooks, debug_name, allow_jit};
+
+        if (!prologue.empty()) {
+            // The prologue runs once per precompute() call, so it's not worth JITting.
+            std::vector<int> strides(1, 0);
+            for (const Instruction& inst : prologue) {
+                if (inst.op == Op::store32) { strides.push_back(4); }
+            }
+            prologue = eliminate_dead_code(std::move(prologue));
+            p.fImpl->prologue = std::make_unique<Program>(finalize(std::move(prologue)),
+                                                          /*visualizer=*/nullptr,
+                                                          strides,
+                                                          std::vector<TraceHook*>{},
+                                                          debug_name, /*allow_jit=*/false);
+            p.fImpl->precompute_offset = fPrecompute.end;
+        }
+        return p;
     }
 
     uint64_t Builder::hash() const {
@@ -617,6 +713,16 @@ namespace skvm {
         return (uint64_t)lo | (uint64_t)hi << 32;
     }
 
+    uint64_t Builder::programHash() const {
+        const uint32_t features = (fFeatures.fma  ? 1 : 0)
+                                | (fFeatures.fp16 ? 2 : 0);
+        uint32_t lo = SkOpts::hash(fStrides.data(), fStrides.size() * sizeof(int), features),
+                 hi = SkOpts::hash(fStrides.data(), fStrides.size() * sizeof(int), ~features);
+        lo = SkOpts::hash(&fPrecompute, sizeof(fPrecompute), lo);
+        hi = SkOpts::hash(&fPrecompute, sizeof(fPrecompute), hi);
+        return this->hash() ^ ((uint64_t)lo | (uint64_t)hi << 32);
+    }
+
     bool operator!=(Ptr a, Ptr b) { return a.ix != b.ix; }
 
     bool operator==(const Instruction& a, const Instruction& b) {
@@ -681,6 +787,11 @@ namespace skvm {
         return traceHookID;
     }
 
+    void Builder::precompute(UPtr ptr, int begin, int end) {
+        SkASSERT(0 <= begin && begin <= end && SkIsAlign4(end));
+        fPrecompute = {ptr.ix, begin, end};
+    }
+
     bool Builder::mergeMasks(I32& mask, I32& traceMask) {
         if (this->isImm(mask.id,      0)) { return false; }
         if (this->isImm(traceMask.id, 0)) { return false; }
@@ -3103,6 +3214,21 @@ namespace skvm {
     #endif
     }
 
+    int Program::precomputedBytes() const {
+        return fImpl->prologue ? 4 * (fImpl->prologue->nargs() - 1) : 0;
+    }
+
+    void Program::precompute(void* uniforms) const {
+        if (const Program* prologue = fImpl->prologue.get()) {
+            std::vector<void*> args(prologue->nargs());
+            args[0] = uniforms;
+            for (int k = 1; k < (int)args.size(); k++) {
+                args[k] = SkTAddOffset<void>(uniforms, fImpl->precompute_offset + 4*(k-1));
+            }
+            prologue->eval(1, args.data());
+        }
+    }
+
     bool Program::hasTraceHooks() const {
         // Identifies a program which has been instrumented for debugging.
         return !fImpl->traceHooks.empty();
@@ -3178,6 +3304,290 @@ namespace skvm {
     int  Program::loop () const { return fImpl->loop; }
     bool Program::empty() const { return fImpl->instructions.empty(); }
 
+    // -- Serialization ----------------------------------------------------------------------------
+    //
+    // A serialized Program is a small header followed by a checksummed body holding everything
+    // eval() needs: strides, interpreter instructions, the precompute() prologue (itself a nested
+    // serialized Program) and (when we JITted) the machine code.
+    // JIT code addresses its constants relative to itself, so it can be mapped anywhere.
+
+    static constexpr uint32_t kSerializedMagic   = SkSetFourByteTag('s','k','v','m'),
+                              kSerializedVersion = 2;
+
+    // Identifies which JIT backend (and calling convention) produced serialized machine code.
+    static constexpr uint32_t kJitArch =
+    #if defined(SKVM_LLVM) || !defined(SKVM_JIT)
+        0;  // We never serialize LLVM code.
+    #elif defined(_M_X64)
+        1;
+    #elif defined(__x86_64__)
+        2;
+    #elif defined(__aarch64__)
+        3;
+    #else
+        0;
+    #endif
+
+    // CPU features needed to run the code our JIT generates.
+    static uint32_t jit_cpu_features() {
+    #if defined(__x86_64__) || defined(_M_X64)
+        return SkCpu::HSW;
+    #else
+        return 0;
+    #endif
+    }
+
+    bool Program::serialize(SkWStream* out) const {
+        if (this->hasTraceHooks()) {
+            return false;
+        }
+
+        SkDynamicMemoryWStream body;
+        body.write32(SkToU32(fImpl->regs));
+        body.write32(SkToU32(fImpl->loop));
+
+        body.write32(SkToU32(fImpl->strides.size()));
+        for (int stride : fImpl->strides) {
+            body.write32(SkToU32(stride));
+        }
+
+        body.write32(SkToU32(fImpl->instructions.size()));
+        for (const InterpreterInstruction& inst : fImpl->instructions) {
+            for (int field : {(int)inst.op, inst.d, inst.x, inst.y, inst.z, inst.w,
+                              inst.immA, inst.immB, inst.immC}) {
+                body.write32((uint32_t)field);  // Immediates and NA are often negative.
+            }
+        }
+
+        body.write32(fImpl->prologue ? 1 : 0);
+        body.write32(SkToU32(fImpl->precompute_offset));
+        if (fImpl->prologue && !fImpl->prologue->serialize(&body)) {
+            return false;
+        }
+
+        const void* jit_entry = nullptr;
+        uint32_t jit_size = 0;
+    #if defined(SKVM_JIT) && !defined(SKVM_LLVM)
+        // Code loaded through a dylib is only there for profiling; leave it behind.
+        if (!fImpl->dylib) {
+            jit_entry = fImpl->jit_entry.load();
+            jit_size  = jit_entry ? SkToU32(fImpl->jit_size) : 0;
+        }
+    #endif
+        body.write32(jit_size ? kJitArch : 0);
+        body.write32(jit_size ? jit_cpu_features() : 0);
+        body.write32(jit_size);
+        body.write(jit_entry, jit_size);
+
+        sk_sp<SkData> data = body.detachAsData();
+        return out->write32(kSerializedMagic)
+            && out->write32(kSerializedVersion)
+            && out->write32(SkToU32(data->size()))
+            && out->write32(SkOpts::hash(data->data(), data->size()))
+            && out->write(data->data(), data->size());
+    }
+
+    std::optional<Program> Program::Deserialize(SkStream* in, const Builder& builder) {
+        return Deserialize(in, builder, /*prologue=*/false);
+    }
+
+    // Collects the uniform reads builder's program makes, with their registers dropped.
+    static SkTHashSet<Instruction, InstructionHash> uniform_reads(
+            const std::vector<Instruction>& program) {
+        SkTHashSet<Instruction, InstructionHash> reads;
+        for (Instruction inst : program) {
+            if (Op::gather8 <= inst.op && inst.op <= Op::array32) {
+                inst.x = inst.y = inst.z = inst.w = NA;
+                reads.add(inst);
+            }
+        }
+        return reads;
+    }
+
+    // Uniforms are read at a byte offset (immB) from a uniform argument (immA), directly by
+    // uniform32 or to find the base pointer of a gather or array32 (which indexes it by immC).
+    // A Program made by builder steps through its arguments by builder's strides, and each of its
+    // uniform reads is one builder makes.  The only other reads allowed are of the values a
+    // precompute() prologue stored in the slots after fPrecompute.end.
+    bool Program::usesMemoryOf(const Builder& builder) const {
+        if (fImpl->strides != builder.fStrides) {
+            return false;
+        }
+        const SkTHashSet<Instruction, InstructionHash> reads = uniform_reads(builder.fProgram);
+        const int slot_bytes = this->precomputedBytes();
+        for (const InterpreterInstruction& inst : fImpl->instructions) {
+            if (inst.op < Op::gather8 || Op::array32 < inst.op) {
+                continue;
+            }
+            const int64_t slot = (int64_t)inst.immB - fImpl->precompute_offset;
+            const bool reads_slot = inst.op == Op::uniform32 &&
+                                    inst.immA == builder.fPrecompute.ptr && inst.immC == 0 &&
+                                    0 <= slot && slot < slot_bytes && slot % 4 == 0;
+            if (!reads_slot &&
+                !reads.contains({inst.op, NA,NA,NA,NA, inst.immA, inst.immB, inst.immC})) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // A precompute() prologue gets the uniforms builder reads from fPrecompute.ptr as its args[0],
+    // followed by one 4-byte slot per value it stores.  It only reads those uniforms, and only
+    // stores to its slots.
+    bool Program::isPrologueOf(const Builder& builder) const {
+        const std::vector<int>& strides = fImpl->strides;
+        if (builder.fPrecompute.ptr == NA || this->hasJIT() || fImpl->prologue ||
+            strides.size() < 2 || strides[0] != 0 ||
+            std::any_of(strides.begin() + 1, strides.end(), [](int s) { return s != 4; })) {
+            return false;
+        }
+        const SkTHashSet<Instruction, InstructionHash> reads = uniform_reads(builder.fProgram);
+        for (const InterpreterInstruction& inst : fImpl->instructions) {
+            if (touches_varying_memory(inst.op) && (inst.op != Op::store32 || inst.immA < 1)) {
+                return false;
+            }
+            if (Op::gather8 <= inst.op && inst.op <= Op::array32 &&
+                (inst.op != Op::uniform32 || inst.immA != 0 ||
+                 !reads.contains({inst.op, NA,NA,NA,NA,
+                                  builder.fPrecompute.ptr, inst.immB, inst.immC}))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Reads a Program serialized from builder, or (when prologue is true) the precompute()
+    // prologue nested inside one.  We first check that the data is well formed, i.e. that every
+    // op, register, and argument the interpreter would use exists.  Then usesMemoryOf() and
+    // isPrologueOf() check it against builder, so that eval() and precompute() touch exactly
+    // the memory builder's own program would.
+    std::optional<Program> Program::Deserialize(SkStream* in, const Builder& builder,
+                                                bool prologue) {
+        uint32_t magic, version, size, checksum;
+        if (!in->readU32(&magic)   || magic   != kSerializedMagic   ||
+            !in->readU32(&version) || version != kSerializedVersion ||
+            !in->readU32(&size)    ||
+            !in->readU32(&checksum)) {
+            return std::nullopt;
+        }
+        sk_sp<SkData> data = SkData::MakeUninitialized(size);
+        if (in->read(data->writable_data(), size) != size ||
+            SkOpts::hash(data->data(), data->size()) != checksum) {
+            return std::nullopt;
+        }
+
+        SkMemoryStream body(std::move(data));
+        auto read_int = [&](int* v) { return body.readS32(v); };
+        auto read_count = [&](size_t* n) {
+            // Each element takes at least 4 bytes, which bounds what a valid count can be.
+            uint32_t v;
+            if (!body.readU32(&v) || v > body.getLength() / 4) {
+                return false;
+            }
+            *n = v;
+            return true;
+        };
+
+        Program program;
+        Impl* impl = program.fImpl.get();
+        size_t nstrides, ninstructions;
+        if (!read_int(&impl->regs) || impl->regs < 0 ||
+            !read_int(&impl->loop) || impl->loop < 0 ||
+            !read_count(&nstrides)) {
+            return std::nullopt;
+        }
+        impl->strides.resize(nstrides);
+        for (int& stride : impl->strides) {
+            if (!read_int(&stride)) {
+                return std::nullopt;
+            }
+        }
+
+        if (!read_count(&ninstructions) ||
+            impl->loop > (int)ninstructions || impl->regs > (int)ninstructions) {
+            return std::nullopt;
+        }
+        // The interpreter always has at least one register (NA arguments are read from r[0]).
+        const int nregs = std::max(impl->regs, 1);
+        impl->instructions.resize(ninstructions);
+        for (InterpreterInstruction& inst : impl->instructions) {
+            int op;
+            if (!read_int(&op) ||
+                !read_int(&inst.d) || !read_int(&inst.x) || !read_int(&inst.y) ||
+                !read_int(&inst.z) || !read_int(&inst.w) ||
+                !read_int(&inst.immA) || !read_int(&inst.immB) || !read_int(&inst.immC)) {
+                return std::nullopt;
+            }
+            inst.op = (Op)op;
+            switch (inst.op) {
+            #define M(op) case Op::op:
+                SKVM_OPS(M)
+            #undef M
+                    break;
+                default: return std::nullopt;
+            }
+            // We never serialize trace hooks, so no trace ops either.
+            if (is_trace(inst.op)) {
+                return std::nullopt;
+            }
+            for (Reg r : {inst.d, inst.x, inst.y, inst.z, inst.w}) {
+                if (r < 0 || r >= nregs) {
+                    return std::nullopt;
+                }
+            }
+            // Varying loads and stores name their argument in immA, and load64 and load128
+            // pick which 32 bits of each element to load with immB.
+            if (touches_varying_memory(inst.op)) {
+                if (inst.immA < 0 || inst.immA >= (int)nstrides ||
+                    (inst.op == Op::load64  && (inst.immB < 0 || inst.immB > 1)) ||
+                    (inst.op == Op::load128 && (inst.immB < 0 || inst.immB > 3))) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        uint32_t has_prologue;
+        if (!body.readU32(&has_prologue) || (prologue && has_prologue) ||
+            !read_int(&impl->precompute_offset)) {
+            return std::nullopt;
+        }
+        if (has_prologue) {
+            if (impl->precompute_offset != builder.fPrecompute.end) {
+                return std::nullopt;
+            }
+            std::optional<Program> p = Deserialize(&body, builder, /*prologue=*/true);
+            if (!p || !p->isPrologueOf(builder)) {
+                return std::nullopt;
+            }
+            impl->prologue = std::make_unique<Program>(std::move(*p));
+        } else if (impl->precompute_offset != 0) {
+            return std::nullopt;
+        }
+        if (!prologue && !program.usesMemoryOf(builder)) {
+            return std::nullopt;
+        }
+
+        uint32_t arch, features, jit_size;
+        if (!body.readU32(&arch) || !body.readU32(&features) || !body.readU32(&jit_size) ||
+            body.getLength() - body.getPosition() != jit_size) {
+            return std::nullopt;
+        }
+    #if defined(SKVM_JIT) && !defined(SKVM_LLVM)
+        // We can't check machine code, so this is only as safe as the source of the data.
+        if (jit_size && arch == kJitArch && SkCpu::Supports(features) && gSkVMAllowJIT) {
+            size_t len = jit_size;
+            void* jit_entry = alloc_jit_buffer(&len);
+            SkAssertResult(body.read(jit_entry, jit_size) == jit_size);
+            remap_as_executable(jit_entry, len);
+            notify_vtune("skvm-jit-deserialized", jit_entry, len);
+
+            impl->jit_size = len;
+            impl->jit_entry.store(jit_entry);
+        }
+    #endif
+        return std::move(program);
+    }
+
     // Translate OptimizedInstructions to InterpreterInstructions.
     void Program::setupInterpreter(const std::vector<OptimizedInstruction>& instructions) {
         // Register each instruction is assigned to.
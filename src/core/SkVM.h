@@ -16,8 +16,10 @@
 #include "include/private/SkTArray.h"
 #include "include/private/SkTHash.h"
 #include "src/core/SkVM_fwd.h"
+#include <optional>    // std::optional
 #include <vector>      // std::vector
 
+class SkStream;
 class SkWStream;
 
 #if defined(SKVM_JIT_WHEN_POSSIBLE) && !defined(SK_BUILD_FOR_IOS)
@@ -632,6 +634,11 @@ namespace skvm {
         // Returns a trace-hook ID which must be passed to the trace opcodes.
         int attachTraceHook(TraceHook*);
 
+        // Promises that the uniforms at byte offsets [begin,end) of ptr stay the same across many
+        // calls to Program::eval().  done() then moves values computed only from those uniforms
+        // and immediates out of the program, into Program::precompute().
+        void precompute(UPtr ptr, int begin, int end);
+
         // Convenience arg() wrappers for most common strides, sizeof(T) and 0.
         template <typename T>
         Ptr varying() { return this->arg(sizeof(T)); }
@@ -967,6 +974,10 @@ namespace skvm {
 
         uint64_t hash() const;
 
+        // Like hash(), but also folds in the argument strides and Features, so equal values
+        // imply done() would produce equivalent Programs.
+        uint64_t programHash() const;
+
         Val push(Instruction);
 
         bool allImm() const { return true; }
@@ -1019,12 +1030,15 @@ namespace skvm {
         // If the passed in ID is a bit-not, return the value being bit-notted. Otherwise, NA.
         Val holdsBitNot(Val id);
 
+        friend class Program;  // Program::Deserialize() checks programs against their Builder.
+
         SkTHashMap<Instruction, Val, InstructionHash> fIndex;
         std::vector<Instruction>                      fProgram;
         std::vector<TraceHook*>                       fTraceHooks;
         std::vector<int>                              fStrides;
         const Features                                fFeatures;
         bool                                          fCreateDuplicates;
+        struct { int ptr = NA, begin = 0, end = 0; }  fPrecompute;
     };
 
     // Optimization passes and data structures normally used by Builder::optimize(),
@@ -1034,6 +1048,11 @@ namespace skvm {
     std::vector<OptimizedInstruction> finalize(std::vector<Instruction>,
                                                viz::Visualizer* visualizer = nullptr);
 
+    // Used by Builder::done() to implement Builder::precompute(): rewrites program to load its
+    // precomputed values from ptr at end, end+4, ..., and returns the prologue that stores them.
+    std::vector<Instruction> split_precompute(std::vector<Instruction>* program,
+                                              int ptr, int begin, int end);
+
     using Reg = int;
 
     // d = op(x,y,z,w, immA,immB)
@@ -1079,11 +1098,30 @@ namespace skvm {
         bool hasJIT() const;         // Has this Program been JITted?
         bool hasTraceHooks() const;  // Is this program instrumented for debugging?
 
+        // If the Builder called precompute(ptr, begin, end), eval() loads the values it moved out
+        // from precomputedBytes() bytes of uniforms starting at end.  precompute() fills them in,
+        // so call it on the uniforms before the first eval() and after changing [begin,end).
+        int  precomputedBytes() const;
+        void precompute(void* uniforms) const;
+
         void visualize(SkWStream* output, const char* code) const;
         void dump(SkWStream* = nullptr) const;
         void disassemble(SkWStream* = nullptr) const;
         viz::Visualizer* visualizer();
 
+        // Programs can be written out and read back later, possibly by another process.
+        // serialize() fails for Programs with trace hooks.  Deserialize() takes the Builder the
+        // Program was made from, and returns nullopt for data that is malformed, was written by
+        // an incompatible build, or reads memory (arguments, uniform offsets, registers) that the
+        // Builder's own program wouldn't.  It only keeps JIT code if this CPU supports the
+        // features it was generated for (otherwise we interpret).
+        //
+        // The data must come from a trusted source, e.g. storage only this application can write:
+        // its checksum only catches accidental corruption, and JIT code is mapped executable
+        // as-is, since there's no way to check what it does.
+        bool serialize(SkWStream*) const;
+        static std::optional<Program> Deserialize(SkStream*, const Builder&);
+
     private:
         void setupInterpreter(const std::vector<OptimizedInstruction>&);
         void setupJIT        (const std::vector<OptimizedInstruction>&, const char* debug_name);
@@ -1096,6 +1134,12 @@ namespace skvm {
         void waitForLLVM() const;
         void dropJIT();
 
+        static std::optional<Program> Deserialize(SkStream*, const Builder&, bool prologue);
+        bool usesMemoryOf(const Builder&) const;
+        bool isPrologueOf(const Builder&) const;
+
+        friend class Builder;
+
         struct Impl;
         std::unique_ptr<Impl> fImpl;
     };
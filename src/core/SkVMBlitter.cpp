@@ -20,6 +20,7 @@
 #include "src/core/SkPaintPriv.h"
 #include "src/core/SkVM.h"
 #include "src/core/SkVMBlitter.h"
+#include "src/core/SkVMProgramCache.h"
 #include "src/shaders/SkColorFilterShader.h"
 
 #include <cinttypes>
@@ -592,7 +593,7 @@ skvm::Program* SkVMBlitter::buildProgram(Coverage coverage) {
         if (p) {
             SkASSERT(!p->empty());
             fProgramPtrs[coverage] = p;
-            return p;
+            return this->usePrecomputedUniforms(coverage, p);
         }
     }
 
@@ -609,8 +610,17 @@ skvm::Program* SkVMBlitter::buildProgram(Coverage coverage) {
     BuildProgram(&builder, fParams.withCoverage(coverage), &fUniforms, &fAlloc);
     SkASSERTF(fUniforms.buf.size() == prev,
               "%zu, prev was %zu", fUniforms.buf.size(), prev);
-
-    skvm::Program program = builder.done(DebugName(key).c_str());
+    // Everything but the BlitterUniforms stays put for the life of the blitter, so work that only
+    // depends on it can be done once in usePrecomputedUniforms() rather than once per span.
+    builder.precompute(fUniforms.base, sizeof(BlitterUniforms),
+                       SkToInt(fUniforms.buf.size() * sizeof(int)));
+
+    skvm::Program program;
+    if (SkVMProgramCache* persistent = SkVMProgramCache::Get()) {
+        program = persistent->findOrBuild(builder, DebugName(key).c_str());
+    } else {
+        program = builder.done(DebugName(key).c_str());
+    }
     if ((false)) {
         static std::atomic<int> missed{0},
                                 total{0};
@@ -627,12 +637,27 @@ skvm::Program* SkVMBlitter::buildProgram(Coverage coverage) {
         }
     }
     fProgramPtrs[coverage] = fPrograms[coverage].set(std::move(program));
-    return fProgramPtrs[coverage];
+    return this->usePrecomputedUniforms(coverage, fProgramPtrs[coverage]);
+}
+
+skvm::Program* SkVMBlitter::usePrecomputedUniforms(Coverage coverage, skvm::Program* program) {
+    // Each program precomputes its own values, so it gets its own copy of fUniforms to put them in.
+    if (int bytes = program->precomputedBytes()) {
+        std::vector<int>& buf = fPrecomputedUniforms[coverage];
+        buf = fUniforms.buf;
+        buf.resize(fUniforms.buf.size() + bytes / sizeof(int));
+        program->precompute(buf.data());
+    }
+    return program;
 }
 
-void SkVMBlitter::updateUniforms(int right, int y) {
+void* SkVMBlitter::updateUniforms(Coverage coverage, int right, int y) {
+    std::vector<int>& buf = fPrecomputedUniforms[coverage].empty()
+                                  ? fUniforms.buf
+                                  : fPrecomputedUniforms[coverage];
     BlitterUniforms uniforms{right, y};
-    memcpy(fUniforms.buf.data(), &uniforms, sizeof(BlitterUniforms));
+    memcpy(buf.data(), &uniforms, sizeof(BlitterUniforms));
+    return buf.data();
 }
 
 const void* SkVMBlitter::isSprite(int x, int y) const {
@@ -645,13 +670,13 @@ const void* SkVMBlitter::isSprite(int x, int y) const {
 
 void SkVMBlitter::blitH(int x, int y, int w) {
     skvm::Program* blit_h = this->buildProgram(Coverage::Full);
-    this->updateUniforms(x+w, y);
+    void* uniforms = this->updateUniforms(Coverage::Full, x+w, y);
     if (const void* sprite = this->isSprite(x,y)) {
         SK_BLITTER_TRACE_STEP(blitH1, true, /*scanlines=*/1, /*pixels=*/w);
-        blit_h->eval(w, fUniforms.buf.data(), fDevice.addr(x,y), sprite);
+        blit_h->eval(w, uniforms, fDevice.addr(x,y), sprite);
     } else {
         SK_BLITTER_TRACE_STEP(blitH2, true, /*scanlines=*/1, /*pixels=*/w);
-        blit_h->eval(w, fUniforms.buf.data(), fDevice.addr(x,y));
+        blit_h->eval(w, uniforms, fDevice.addr(x,y));
     }
 }
 
@@ -664,20 +689,21 @@ void SkVMBlitter::blitAntiH(int x, int y, const SkAlpha cov[], const int16_t run
         SK_BLITTER_TRACE_STEP_ACCUMULATE(blitAntiH, /*pixels=*/run);
         const SkAlpha coverage = *cov;
         if (coverage != 0x00) {
-            this->updateUniforms(x+run, y);
             const void* sprite = this->isSprite(x,y);
             if (coverage == 0xFF) {
+                void* uniforms = this->updateUniforms(Coverage::Full, x+run, y);
                 if (sprite) {
-                    blit_h->eval(run, fUniforms.buf.data(), fDevice.addr(x,y), sprite);
+                    blit_h->eval(run, uniforms, fDevice.addr(x,y), sprite);
                 } else {
-                    blit_h->eval(run, fUniforms.buf.data(), fDevice.addr(x,y));
+                    blit_h->eval(run, uniforms, fDevice.addr(x,y));
                 }
             } else {
+                void* uniforms = this->updateUniforms(Coverage::UniformF, x+run, y);
                 const float covF = *cov * (1/255.0f);
                 if (sprite) {
-                    blit_anti_h->eval(run, fUniforms.buf.data(), fDevice.addr(x,y), sprite, &covF);
+                    blit_anti_h->eval(run, uniforms, fDevice.addr(x,y), sprite, &covF);
                 } else {
-                    blit_anti_h->eval(run, fUniforms.buf.data(), fDevice.addr(x,y), &covF);
+                    blit_anti_h->eval(run, uniforms, fDevice.addr(x,y), &covF);
                 }
             }
         }
@@ -692,22 +718,15 @@ void SkVMBlitter::blitMask(const SkMask& mask, const SkIRect& clip) {
         return SkBlitter::blitMask(mask, clip);
     }
 
-    const skvm::Program* program = nullptr;
+    Coverage coverage;
     switch (mask.fFormat) {
         default: SkUNREACHABLE;     // ARGB and SDF masks shouldn't make it here.
 
-        case SkMask::k3D_Format:
-            program = this->buildProgram(Coverage::Mask3D);
-            break;
-
-        case SkMask::kA8_Format:
-            program = this->buildProgram(Coverage::MaskA8);
-            break;
-
-        case SkMask::kLCD16_Format:
-            program = this->buildProgram(Coverage::MaskLCD16);
-            break;
+        case SkMask::k3D_Format:    coverage = Coverage::Mask3D;    break;
+        case SkMask::kA8_Format:    coverage = Coverage::MaskA8;    break;
+        case SkMask::kLCD16_Format: coverage = Coverage::MaskLCD16; break;
     }
+    const skvm::Program* program = this->buildProgram(coverage);
 
     SkASSERT(program);
     if (program) {
@@ -721,24 +740,24 @@ void SkVMBlitter::blitMask(const SkMask& mask, const SkIRect& clip) {
                  w = clip.width();
             void* dptr =        fDevice.writable_addr(x,y);
             auto  mptr = (const uint8_t*)mask.getAddr(x,y);
-            this->updateUniforms(x+w,y);
+            void* uniforms = this->updateUniforms(coverage, x+w, y);
 
             if (mask.fFormat == SkMask::k3D_Format) {
                 size_t plane = mask.computeImageSize();
                 if (const void* sprite = this->isSprite(x,y)) {
-                    program->eval(w, fUniforms.buf.data(), dptr, sprite, mptr + 1*plane
-                                                                       , mptr + 2*plane
-                                                                       , mptr + 0*plane);
+                    program->eval(w, uniforms, dptr, sprite, mptr + 1*plane
+                                                           , mptr + 2*plane
+                                                           , mptr + 0*plane);
                 } else {
-                    program->eval(w, fUniforms.buf.data(), dptr, mptr + 1*plane
-                                                               , mptr + 2*plane
-                                                               , mptr + 0*plane);
+                    program->eval(w, uniforms, dptr, mptr + 1*plane
+                                                   , mptr + 2*plane
+                                                   , mptr + 0*plane);
                 }
             } else {
                 if (const void* sprite = this->isSprite(x,y)) {
-                    program->eval(w, fUniforms.buf.data(), dptr, sprite, mptr);
+                    program->eval(w, uniforms, dptr, sprite, mptr);
                 } else {
-                    program->eval(w, fUniforms.buf.data(), dptr, mptr);
+                    program->eval(w, uniforms, dptr, mptr);
                 }
             }
         }
@@ -86,7 +86,8 @@ private:
     static void ReleaseProgramCache();
 
     skvm::Program* buildProgram(Coverage coverage);
-    void updateUniforms(int right, int y);
+    skvm::Program* usePrecomputedUniforms(Coverage coverage, skvm::Program* program);
+    void* updateUniforms(Coverage coverage, int right, int y);
     const void* isSprite(int x, int y) const;
 
     void blitH(int x, int y, int w) override;
@@ -105,6 +106,7 @@ private:
     bool            fStoreToCache = false;
     skvm::Program*         fProgramPtrs[Coverage::kCount] = {nullptr};
     SkTLazy<skvm::Program> fPrograms[Coverage::kCount];
+    std::vector<int>       fPrecomputedUniforms[Coverage::kCount];  // See updateUniforms().
 
     friend class Viewer;
 };
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkVMProgramCache.h"
+
+#include "include/core/SkStream.h"
+
+#include <atomic>
+#include <vector>
+
+static constexpr uint32_t kFileMagic   = SkSetFourByteTag('s','k','v','c'),
+                          kFileVersion = 1;
+
+static std::atomic<SkVMProgramCache*> gCache{nullptr};
+
+SkVMProgramCache* SkVMProgramCache::Get() { return gCache.load(std::memory_order_acquire); }
+
+void SkVMProgramCache::Set(SkVMProgramCache* cache) {
+    gCache.store(cache, std::memory_order_release);
+}
+
+std::optional<skvm::Program> SkVMProgramCache::find(const skvm::Builder& builder) const {
+    sk_sp<SkData> data;
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        if (const sk_sp<SkData>* found = fPrograms.find(builder.programHash())) {
+            data = *found;
+        }
+    }
+    if (!data) {
+        return std::nullopt;
+    }
+    SkMemoryStream stream(std::move(data));
+    return skvm::Program::Deserialize(&stream, builder);
+}
+
+bool SkVMProgramCache::insert(uint64_t key, const skvm::Program& program) {
+    SkDynamicMemoryWStream stream;
+    if (!program.serialize(&stream)) {
+        return false;
+    }
+    sk_sp<SkData> data = stream.detachAsData();
+
+    SkAutoMutexExclusive lock(fMutex);
+    fPrograms.insert_or_update(key, std::move(data));
+    return true;
+}
+
+skvm::Program SkVMProgramCache::findOrBuild(const skvm::Builder& builder,
+                                            const char* debug_name) {
+    if (std::optional<skvm::Program> program = this->find(builder)) {
+        return std::move(*program);
+    }
+    skvm::Program program = builder.done(debug_name);
+    this->insert(builder.programHash(), program);
+    return program;
+}
+
+int SkVMProgramCache::count() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return fPrograms.count();
+}
+
+bool SkVMProgramCache::writeTo(SkWStream* out) const {
+    SkAutoMutexExclusive lock(fMutex);
+    bool ok = out->write32(kFileMagic)
+           && out->write32(kFileVersion)
+           && out->write32(SkToU32(fPrograms.count()));
+    // foreach() visits the most recently used entry first.
+    std::vector<std::pair<uint64_t, const SkData*>> entries;
+    entries.reserve(fPrograms.count());
+    fPrograms.foreach([&](const uint64_t* key, const sk_sp<SkData>* data) {
+        entries.push_back({*key, data->get()});
+    });
+    for (auto it = entries.rbegin(); ok && it != entries.rend(); ++it) {
+        const auto& [key, data] = *it;
+        ok = out->write(&key, sizeof(key))
+          && out->write32(SkToU32(data->size()))
+          && out->write(data->data(), data->size());
+    }
+    return ok;
+}
+
+bool SkVMProgramCache::readFrom(SkStream* in) {
+    uint32_t magic, version, count;
+    if (!in->readU32(&magic)   || magic   != kFileMagic   ||
+        !in->readU32(&version) || version != kFileVersion ||
+        !in->readU32(&count)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t key;
+        uint32_t size;
+        if (in->read(&key, sizeof(key)) != sizeof(key) || !in->readU32(&size)) {
+            return false;
+        }
+        // Programs are checked against their Builder when they're deserialized in find().
+        sk_sp<SkData> data = SkData::MakeFromStream(in, size);
+        if (!data) {
+            return false;
+        }
+        SkAutoMutexExclusive lock(fMutex);
+        fPrograms.insert_or_update(key, std::move(data));
+    }
+    return true;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkVMProgramCache_DEFINED
+#define SkVMProgramCache_DEFINED
+
+#include "include/core/SkData.h"
+#include "include/private/SkMutex.h"
+#include "src/core/SkLRUCache.h"
+#include "src/core/SkVM.h"
+
+#include <optional>
+
+class SkStream;
+class SkWStream;
+
+/**
+ * A cache of finished skvm::Programs, keyed by skvm::Builder::programHash(), that can be written
+ * to a stream and read back by a later process. A hit skips optimizing and JIT-compiling the
+ * program entirely.
+ *
+ * Entries are stored in serialized form, so finding a program maps a fresh copy of its code.
+ * Once there are more than maxCount of them, the least recently found or inserted are dropped.
+ * Only read back streams from a trusted source (e.g. files only this application can write):
+ * JIT code in them is run as-is.
+ * All methods are thread safe.
+ */
+class SkVMProgramCache {
+public:
+    explicit SkVMProgramCache(int maxCount = 256) : fPrograms(maxCount) {}
+
+    // The cache consulted by SkVMBlitter, or nullptr (the default) for none.
+    // The caller keeps ownership, and must keep it alive until it's uninstalled.
+    static SkVMProgramCache* Get();
+    static void Set(SkVMProgramCache*);
+
+    // Returns the Program stored under builder.programHash(), or nullopt if there isn't one or it
+    // doesn't check out against builder (see skvm::Program::Deserialize()).
+    std::optional<skvm::Program> find(const skvm::Builder& builder) const;
+
+    // Stores program under key, replacing any previous entry.
+    // Returns false if the program can't be serialized (e.g. it has trace hooks).
+    bool insert(uint64_t key, const skvm::Program& program);
+
+    // Looks up the program builder would produce, building (and storing) it on a miss.
+    skvm::Program findOrBuild(const skvm::Builder& builder, const char* debug_name = nullptr);
+
+    int count() const;
+
+    // Writes all entries to the stream, or reads entries written by writeTo(), adding them to
+    // this cache. Entries are written least recently used first, so reading them back keeps
+    // their order. readFrom() stops and returns false at the first malformed entry.
+    bool writeTo(SkWStream*) const;
+    bool readFrom(SkStream*);
+
+private:
+    mutable SkMutex fMutex;
+    // Finding a program counts as using it, even from const methods.
+    mutable SkLRUCache<uint64_t, sk_sp<SkData>> fPrograms SK_GUARDED_BY(fMutex);
+};
+
+#endif  // SkVMProgramCache_DEFINED
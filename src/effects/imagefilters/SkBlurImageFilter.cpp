@@ -8,6 +8,7 @@
 #include <algorithm>
 
 #include "include/core/SkBitmap.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkTileMode.h"
 #include "include/effects/SkImageFilters.h"
 #include "include/private/SkColorData.h"
@@ -16,11 +17,13 @@
 #include "include/private/SkVx.h"
 #include "src/core/SkArenaAlloc.h"
 #include "src/core/SkAutoPixmapStorage.h"
+#include "src/core/SkBlurPriv.h"
 #include "src/core/SkGpuBlurUtils.h"
 #include "src/core/SkImageFilter_Base.h"
 #include "src/core/SkOpts.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkSpecialImage.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkWriteBuffer.h"
 
 #if SK_SUPPORT_GPU
@@ -872,8 +875,25 @@ sk_sp<SkSpecialImage> cpu_blur(
         dst.eraseColor(0);
     }
 
+    // Large blurs run bands of rows (horizontal pass) or columns (vertical pass) on the executor.
+    SkExecutor* executor = SkBlurExecutorFor((int64_t)dstW * dstH);
+    auto blurInBands = [&](const PassMaker* maker, int lines, auto&& blurLines) {
+        if (!executor) {
+            blurLines(maker->makePass(buffer, &alloc), 0, lines);
+            return;
+        }
+        SkTaskGroup bands(*executor);
+        bands.batch((lines + kLinesPerBlurBand - 1) / kLinesPerBlurBand, [&](int i) {
+            SkSTArenaAlloc<256> bandAlloc;
+            void* bandBuffer = bandAlloc.makeBytesAlignedTo(maker->bufferSizeBytes(),
+                                                            alignof(skvx::Vec<4, uint32_t>));
+            blurLines(maker->makePass(bandBuffer, &bandAlloc),
+                      i * kLinesPerBlurBand, std::min(lines, (i + 1) * kLinesPerBlurBand));
+        });
+        bands.wait();
+    };
+
     if (makerX->window() > 1) {
-        Pass* pass = makerX->makePass(buffer, &alloc);
         // Make int64 to avoid overflow in multiplication below.
         int64_t shift = srcBounds.top() - dstBounds.top();
 
@@ -886,27 +906,32 @@ sk_sp<SkSpecialImage> cpu_blur(
         intermediateWidth = dstW;
         intermediateDst = static_cast<uint32_t *>(dst.getPixels());
 
-        const uint32_t* srcCursor = static_cast<uint32_t*>(src.getPixels());
-        uint32_t* dstCursor = intermediateSrc;
-        for (auto y = 0; y < srcH; y++) {
-            pass->blur(srcBounds.left(), srcBounds.right(), dstBounds.right(),
-                      srcCursor, 1, dstCursor, 1);
-            srcCursor += src.rowBytesAsPixels();
-            dstCursor += intermediateRowBytesAsPixels;
-        }
+        blurInBands(makerX, srcH, [&](Pass* pass, int yStart, int yEnd) {
+            const uint32_t* srcCursor = static_cast<uint32_t*>(src.getPixels())
+                                        + (int64_t)yStart * src.rowBytesAsPixels();
+            uint32_t* dstCursor = intermediateSrc
+                                  + (int64_t)yStart * intermediateRowBytesAsPixels;
+            for (auto y = yStart; y < yEnd; y++) {
+                pass->blur(srcBounds.left(), srcBounds.right(), dstBounds.right(),
+                          srcCursor, 1, dstCursor, 1);
+                srcCursor += src.rowBytesAsPixels();
+                dstCursor += intermediateRowBytesAsPixels;
+            }
+        });
     }
 
     if (makerY->window() > 1) {
-        Pass* pass = makerY->makePass(buffer, &alloc);
-        const uint32_t* srcCursor = intermediateSrc;
-        uint32_t* dstCursor = intermediateDst;
-        for (auto x = 0; x < intermediateWidth; x++) {
-            pass->blur(srcBounds.top(), srcBounds.bottom(), dstBounds.bottom(),
-                       srcCursor, intermediateRowBytesAsPixels,
-                       dstCursor, dst.rowBytesAsPixels());
-            srcCursor += 1;
-            dstCursor += 1;
-        }
+        blurInBands(makerY, intermediateWidth, [&](Pass* pass, int xStart, int xEnd) {
+            const uint32_t* srcCursor = intermediateSrc + xStart;
+            uint32_t* dstCursor = intermediateDst + xStart;
+            for (auto x = xStart; x < xEnd; x++) {
+                pass->blur(srcBounds.top(), srcBounds.bottom(), dstBounds.bottom(),
+                           srcCursor, intermediateRowBytesAsPixels,
+                           dstCursor, dst.rowBytesAsPixels());
+                srcCursor += 1;
+                dstCursor += 1;
+            }
+        });
     }
 
     return SkSpecialImage::MakeFromRaster(SkIRect::MakeWH(dstBounds.width(),
@@ -25,6 +25,7 @@
 #include "src/gpu/ganesh/GrThreadSafePipelineBuilder.h"
 #include "src/gpu/ganesh/SurfaceContext.h"
 #include "src/gpu/ganesh/effects/GrSkSLFP.h"
+#include "src/gpu/ganesh/geometry/GrTriangulator.h"
 #include "src/gpu/ganesh/mock/GrMockGpu.h"
 #include "src/gpu/ganesh/text/GrAtlasManager.h"
 #include "src/image/SkImage_GpuBase.h"
@@ -205,6 +206,11 @@ void GrDirectContext::freeGpuResources() {
     }
     fAtlasManager->freeAll();
 
+    // Not GPU memory, but clients call this to trim what they can.
+    if (fTriangulatorArenas) {
+        fTriangulatorArenas = std::make_unique<GrTriangulatorArenas>();
+    }
+
     // TODO: the glyph cache doesn't hold any GpuResources so this call should not be needed here.
     // Some slack in the GrTextBlob's implementation requires it though. That could be fixed.
     fStrikeCache->freeAll();
@@ -249,6 +255,7 @@ bool GrDirectContext::init() {
     // get passed on to/shared between all the DDLRecorders created with this context.
     if (this->options().fExecutor) {
         fTaskGroup = std::make_unique<SkTaskGroup>(*this->options().fExecutor);
+        fTriangulatorArenas = std::make_unique<GrTriangulatorArenas>();
     }
 
     fPersistentCache = this->options().fPersistentCache;
@@ -24,6 +24,7 @@ class GrOnFlushCallbackObject;
 class GrRenderTargetProxy;
 class GrSemaphore;
 class GrSurfaceProxy;
+class GrTriangulatorArenas;
 
 class SkDeferredDisplayList;
 class SkTaskGroup;
@@ -78,6 +79,11 @@ public:
 
     SkTaskGroup* getTaskGroup() { return this->context()->fTaskGroup.get(); }
 
+    // Only present with an executor. Not thread safe; only for use while preparing ops.
+    GrTriangulatorArenas* getTriangulatorArenas() {
+        return this->context()->fTriangulatorArenas.get();
+    }
+
     GrResourceProvider* resourceProvider() { return this->context()->fResourceProvider.get(); }
     const GrResourceProvider* resourceProvider() const {
         return this->context()->fResourceProvider.get();
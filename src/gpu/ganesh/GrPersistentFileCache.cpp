@@ -0,0 +1,396 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/gpu/GrPersistentFileCache.h"
+
+#include "include/core/SkData.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkString.h"
+#include "include/private/SkMutex.h"
+#include "include/private/SkSemaphore.h"
+#include "src/core/SkOSFile.h"
+#include "src/core/SkOpts.h"
+#include "src/core/SkReadBuffer.h"
+#include "src/core/SkTInternalLList.h"
+#include "src/gpu/ganesh/GrPersistentCacheUtils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// The pack is a header followed by the entries, least recently used first:
+//
+//     uint32_t magic, version, entryCount
+//     entryCount x { uint32_t keySize, dataSize, descriptionSize,
+//                    key, data, description (each padded to 4 bytes) }
+//
+// so loading the entries in order leaves them in the same LRU order they were written in.
+static constexpr uint32_t kPackMagic   = SkSetFourByteTag('S', 'K', 'P', 'C');
+static constexpr uint32_t kPackVersion = 1;
+
+static size_t pad4(size_t size) { return SkAlign4(size); }
+
+// GrPersistentCacheUtils::PackCachedShaders() starts its data with the cache version and one of
+// the backends' shader type tags. Other data, like Vulkan's VkPipelineCache blob, has no header.
+static bool packed_by_older_version(const SkData& data) {
+    static constexpr SkFourByteTag kShaderTypeTags[] = {
+        SkSetFourByteTag('S', 'K', 'S', 'L'),
+        SkSetFourByteTag('G', 'L', 'S', 'L'),
+        SkSetFourByteTag('G', 'L', 'P', 'B'),
+        SkSetFourByteTag('S', 'P', 'R', 'V'),
+        SkSetFourByteTag('M', 'S', 'L', ' '),
+        SkSetFourByteTag('H', 'L', 'S', 'L'),
+    };
+
+    SkReadBuffer reader(data.data(), data.size());
+    const int version = reader.readInt();
+    const SkFourByteTag type = reader.readUInt();
+    return reader.isValid() &&
+           version > 0 && version < GrPersistentCacheUtils::GetCurrentVersion() &&
+           std::find(std::begin(kShaderTypeTags), std::end(kShaderTypeTags), type) !=
+                   std::end(kShaderTypeTags);
+}
+
+namespace {
+
+class PersistentFileCache final : public GrPersistentFileCache {
+public:
+    PersistentFileCache(const char* path, size_t byteBudget);
+    ~PersistentFileCache() override;
+
+    sk_sp<SkData> load(const SkData& key) override;
+    void store(const SkData& key, const SkData& data, const SkString& description) override;
+
+    bool sync() override;
+    Stats stats() const override;
+    void resetStats() override;
+
+private:
+    struct Entry {
+        sk_sp<const SkData> fKey;
+        sk_sp<SkData>       fData;
+        SkString            fDescription;
+
+        size_t bytes() const { return fKey->size() + fData->size() + fDescription.size(); }
+
+        SK_DECLARE_INTERNAL_LLIST_INTERFACE(Entry);
+    };
+
+    struct Key {
+        bool operator==(const Key& that) const {
+            return fKey->size() == that.fKey->size() &&
+                   !memcmp(fKey->data(), that.fKey->data(), fKey->size());
+        }
+        sk_sp<const SkData> fKey;
+    };
+
+    struct Hash {
+        uint32_t operator()(const Key& key) const;
+    };
+
+    void readPack() SK_REQUIRES(fMutex);
+    void insert(std::unique_ptr<Entry>) SK_REQUIRES(fMutex);
+    void purgeAsNeeded(const Entry* keep) SK_REQUIRES(fMutex);
+    void releasePack() SK_REQUIRES(fMutex);
+    void syncLoop();
+
+    const SkString fPath;
+    const size_t   fByteBudget;
+
+    mutable SkMutex fMutex;
+    std::unordered_map<Key, std::unique_ptr<Entry>, Hash> fMap SK_GUARDED_BY(fMutex);
+    SkTInternalLList<Entry> fLRU                               SK_GUARDED_BY(fMutex);
+    Stats  fStats                                              SK_GUARDED_BY(fMutex);
+    size_t fBytesUsed = 0                                      SK_GUARDED_BY(fMutex);
+    bool   fDirty = false                                      SK_GUARDED_BY(fMutex);
+    bool   fExiting = false                                    SK_GUARDED_BY(fMutex);
+    // The mapping of the pack that was read when the cache was created, if entries still use it.
+    sk_sp<SkData> fPack                                        SK_GUARDED_BY(fMutex);
+
+    // Held while writing the pack, so the background thread and sync() don't both write it.
+    SkMutex     fSyncMutex;
+    SkSemaphore fSyncRequests;
+    std::thread fSyncThread;
+};
+
+uint32_t PersistentFileCache::Hash::operator()(const Key& key) const {
+    return SkOpts::hash_fn(key.fKey->data(), key.fKey->size(), 0);
+}
+
+PersistentFileCache::PersistentFileCache(const char* path, size_t byteBudget)
+        : fPath(path)
+        , fByteBudget(byteBudget) {
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        this->readPack();
+    }
+    fSyncThread = std::thread([this] { this->syncLoop(); });
+}
+
+PersistentFileCache::~PersistentFileCache() {
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        fExiting = true;
+    }
+    fSyncRequests.signal();
+    fSyncThread.join();
+    this->sync();
+}
+
+void PersistentFileCache::readPack() {
+    if (!sk_exists(fPath.c_str(), kRead_SkFILE_Flag)) {
+        return;
+    }
+    // Entries share the mapping until they're evicted, or until the pack is rewritten.
+    sk_sp<SkData> pack = SkData::MakeFromFileName(fPath.c_str());
+    if (!pack) {
+        return;
+    }
+
+    SkReadBuffer reader(pack->data(), pack->size());
+    if (reader.readUInt() != kPackMagic || reader.readUInt() != kPackVersion) {
+        return;
+    }
+    const uint32_t count = reader.readUInt();
+    for (uint32_t i = 0; i < count && reader.isValid(); ++i) {
+        const size_t keySize  = reader.readUInt(),
+                     dataSize = reader.readUInt(),
+                     descSize = reader.readUInt();
+        const size_t offset = reader.offset();
+        const char* bytes = static_cast<const char*>(
+                reader.skip(pad4(keySize) + pad4(dataSize) + pad4(descSize)));
+        if (!bytes) {
+            break;
+        }
+
+        auto entry = std::make_unique<Entry>();
+        entry->fKey  = SkData::MakeSubset(pack.get(), offset, keySize);
+        entry->fData = SkData::MakeSubset(pack.get(), offset + pad4(keySize), dataSize);
+        entry->fDescription.set(bytes + pad4(keySize) + pad4(dataSize), descSize);
+
+        // Shaders packed by an older version of Skia would be rejected by the backend anyway.
+        // Anything else is up to the backend to validate.
+        if (packed_by_older_version(*entry->fData)) {
+            fStats.fDroppedEntries++;
+            fDirty = true;
+            continue;
+        }
+        this->insert(std::move(entry));
+    }
+    if (!reader.isValid()) {
+        SkDebugf("PersistentFileCache: %s is truncated, ignoring the rest of it.\n",
+                 fPath.c_str());
+        fDirty = true;
+    }
+    this->purgeAsNeeded(nullptr);
+    if (!fMap.empty()) {
+        fPack = std::move(pack);
+    }
+}
+
+void PersistentFileCache::releasePack() {
+    if (!fPack) {
+        return;
+    }
+    // Copy the entries that still point into the mapping, so that it is unmapped before the pack
+    // is replaced. Windows won't delete or replace a file that is mapped.
+    const char* packStart = static_cast<const char*>(fPack->data());
+    const char* packEnd   = packStart + fPack->size();
+    auto inPack = [&](const SkData& data) {
+        const char* bytes = static_cast<const char*>(data.data());
+        return bytes >= packStart && bytes < packEnd;
+    };
+    for (Entry* e = fLRU.head(); e; e = e->fNext) {
+        if (inPack(*e->fData)) {
+            e->fData = SkData::MakeWithCopy(e->fData->data(), e->fData->size());
+        }
+    }
+    // fMap's keys share the entries' keys, so the map is rebuilt around the copied keys.
+    std::unordered_map<Key, std::unique_ptr<Entry>, Hash> map;
+    map.reserve(fMap.size());
+    for (auto& it : fMap) {
+        std::unique_ptr<Entry>& entry = it.second;
+        if (inPack(*entry->fKey)) {
+            entry->fKey = SkData::MakeWithCopy(entry->fKey->data(), entry->fKey->size());
+        }
+        map.emplace(Key{entry->fKey}, std::move(entry));
+    }
+    fMap = std::move(map);
+    fPack.reset();
+}
+
+void PersistentFileCache::insert(std::unique_ptr<Entry> entry) {
+    Key key{entry->fKey};
+    auto found = fMap.find(key);
+    if (found != fMap.end()) {
+        fBytesUsed -= found->second->bytes();
+        fLRU.remove(found->second.get());
+        fMap.erase(found);
+    }
+    fBytesUsed += entry->bytes();
+    fLRU.addToHead(entry.get());
+    fMap.emplace(key, std::move(entry));
+}
+
+void PersistentFileCache::purgeAsNeeded(const Entry* keep) {
+    while (fBytesUsed > fByteBudget) {
+        Entry* victim = fLRU.tail();
+        if (!victim || victim == keep) {
+            break;
+        }
+        fBytesUsed -= victim->bytes();
+        fLRU.remove(victim);
+        fMap.erase(Key{victim->fKey});
+        fStats.fEvictions++;
+        fDirty = true;
+    }
+}
+
+sk_sp<SkData> PersistentFileCache::load(const SkData& key) {
+    // Wrap the caller's key without copying it, just to look it up.
+    Key lookup{SkData::MakeWithoutCopy(key.data(), key.size())};
+
+    SkAutoMutexExclusive lock(fMutex);
+    auto found = fMap.find(lookup);
+    if (found == fMap.end()) {
+        fStats.fMisses++;
+        return nullptr;
+    }
+    Entry* entry = found->second.get();
+    if (entry != fLRU.head()) {
+        fLRU.remove(entry);
+        fLRU.addToHead(entry);
+    }
+    fStats.fHits++;
+    fStats.fBytesLoaded += entry->fData->size();
+    return entry->fData;
+}
+
+void PersistentFileCache::store(const SkData& key, const SkData& data,
+                                const SkString& description) {
+    auto entry = std::make_unique<Entry>();
+    entry->fKey         = SkData::MakeWithCopy(key.data(), key.size());
+    entry->fData        = SkData::MakeWithCopy(data.data(), data.size());
+    entry->fDescription = description;
+    if (entry->bytes() > fByteBudget) {
+        return;
+    }
+
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        fStats.fStores++;
+        fStats.fBytesStored += data.size();
+        const Entry* stored = entry.get();
+        this->insert(std::move(entry));
+        this->purgeAsNeeded(stored);
+        fDirty = true;
+    }
+    fSyncRequests.signal();
+}
+
+bool PersistentFileCache::sync() {
+    SkAutoMutexExclusive syncLock(fSyncMutex);
+
+    // Snapshot the entries, oldest first, so the pack can be written without blocking load() and
+    // store(). The entries' data is immutable, so sharing it with the cache is safe.
+    struct Packed {
+        sk_sp<const SkData> fKey;
+        sk_sp<SkData>       fData;
+        SkString            fDescription;
+    };
+    std::vector<Packed> entries;
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        if (!fDirty) {
+            return true;
+        }
+        fDirty = false;
+        this->releasePack();
+        entries.reserve(fMap.size());
+        for (Entry* e = fLRU.tail(); e; e = e->fPrev) {
+            entries.push_back({e->fKey, e->fData, e->fDescription});
+        }
+    }
+
+    // Write to a temporary file and move it into place, so a crash mid-write can't leave a
+    // truncated pack behind. Data returned by load() from the old mapping must have been released
+    // by now for this to succeed on Windows; the backends don't hold on to it.
+    SkString tmpPath = SkStringPrintf("%s.tmp", fPath.c_str());
+    bool ok;
+    {
+        SkFILEWStream out(tmpPath.c_str());
+        ok = out.isValid() &&
+             out.write32(kPackMagic) &&
+             out.write32(kPackVersion) &&
+             out.write32(SkToU32(entries.size()));
+        static constexpr char kZeros[4] = {0, 0, 0, 0};
+        for (size_t i = 0; ok && i < entries.size(); ++i) {
+            const Packed& e = entries[i];
+            ok = out.write32(SkToU32(e.fKey->size())) &&
+                 out.write32(SkToU32(e.fData->size())) &&
+                 out.write32(SkToU32(e.fDescription.size())) &&
+                 out.write(e.fKey->data(), e.fKey->size()) &&
+                 out.write(kZeros, pad4(e.fKey->size()) - e.fKey->size()) &&
+                 out.write(e.fData->data(), e.fData->size()) &&
+                 out.write(kZeros, pad4(e.fData->size()) - e.fData->size()) &&
+                 out.write(e.fDescription.c_str(), e.fDescription.size()) &&
+                 out.write(kZeros, pad4(e.fDescription.size()) - e.fDescription.size());
+        }
+        if (ok) {
+            out.fsync();
+        }
+    }
+    if (ok) {
+        // rename() won't replace an existing file on Windows.
+        remove(fPath.c_str());
+        ok = rename(tmpPath.c_str(), fPath.c_str()) == 0;
+    }
+    if (!ok) {
+        SkDebugf("PersistentFileCache: failed to write %s\n", fPath.c_str());
+        remove(tmpPath.c_str());
+        SkAutoMutexExclusive lock(fMutex);
+        fDirty = true;
+    }
+    return ok;
+}
+
+void PersistentFileCache::syncLoop() {
+    for (;;) {
+        fSyncRequests.wait();
+        // Fold any stores that arrived while we were waiting or writing into one write.
+        while (fSyncRequests.try_wait()) {}
+        {
+            SkAutoMutexExclusive lock(fMutex);
+            if (fExiting) {
+                return;
+            }
+        }
+        this->sync();
+    }
+}
+
+GrPersistentFileCache::Stats PersistentFileCache::stats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    Stats stats = fStats;
+    stats.fEntries   = SkToInt(fMap.size());
+    stats.fBytesUsed = fBytesUsed;
+    return stats;
+}
+
+void PersistentFileCache::resetStats() {
+    SkAutoMutexExclusive lock(fMutex);
+    fStats = Stats();
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<GrPersistentFileCache> GrPersistentFileCache::Make(const char* path,
+                                                                   size_t byteBudget) {
+    return std::make_unique<PersistentFileCache>(path, byteBudget);
+}
@@ -145,6 +145,12 @@ public:
 
     bool isFinalized() const { return SkToBool(kFinalized_Flag & fFlags); }
 
+    /**
+     * Like GrPaint::isTrivial(), true if the set uses src-over and has no fragment processors.
+     * Only legal on processor sets that are not yet finalized.
+     */
+    bool isTrivial() const { return !this->numFragmentProcessors() && !this->xpFactory(); }
+
     /** These are valid only for non-LCD coverage. */
     static const GrProcessorSet& EmptySet();
     static GrProcessorSet MakeEmptySet();
@@ -7,6 +7,7 @@
 
 #include "src/gpu/ganesh/geometry/GrAATriangulator.h"
 
+#include "src/core/SkTaskGroup.h"
 #include "src/gpu/BufferWriter.h"
 #include "src/gpu/ganesh/GrEagerVertexAllocator.h"
 #include <queue>
@@ -669,8 +670,7 @@ std::tuple<Poly*, bool> GrAATriangulator::tessellate(const VertexList& mesh, con
     }
 }
 
-int GrAATriangulator::polysToAATriangles(Poly* polys,
-                                         GrEagerVertexAllocator* vertexAllocator) const {
+int64_t GrAATriangulator::countAAPoints(Poly* polys) const {
     int64_t count64 = CountPoints(polys, SkPathFillType::kWinding);
     // Count the points from the outer mesh.
     for (Vertex* v = fOuterMesh.fHead; v; v = v->fNext) {
@@ -678,6 +678,29 @@ int GrAATriangulator::polysToAATriangles(Poly* polys,
             count64 += TRIANGULATOR_WIREFRAME ? 12 : 6;
         }
     }
+    return count64;
+}
+
+skgpu::VertexWriter GrAATriangulator::polysToAATriangles(Poly* polys,
+                                                         skgpu::VertexWriter verts) const {
+    verts = this->polysToTriangles(polys, SkPathFillType::kWinding, std::move(verts));
+    // Emit the triangles from the outer mesh.
+    for (Vertex* v = fOuterMesh.fHead; v; v = v->fNext) {
+        for (Edge* e = v->fFirstEdgeBelow; e; e = e->fNextEdgeBelow) {
+            Vertex* v0 = e->fTop;
+            Vertex* v1 = e->fBottom;
+            Vertex* v2 = e->fBottom->fPartner;
+            Vertex* v3 = e->fTop->fPartner;
+            verts = this->emitTriangle(v0, v1, v2, 0/*winding*/, std::move(verts));
+            verts = this->emitTriangle(v0, v2, v3, 0/*winding*/, std::move(verts));
+        }
+    }
+    return verts;
+}
+
+int GrAATriangulator::polysToAATriangles(Poly* polys,
+                                         GrEagerVertexAllocator* vertexAllocator) const {
+    int64_t count64 = this->countAAPoints(polys);
     if (0 == count64 || count64 > SK_MaxS32) {
         return 0;
     }
@@ -692,21 +715,85 @@ int GrAATriangulator::polysToAATriangles(Poly* polys,
 
     TESS_LOG("emitting %d verts\n", count);
     skgpu::BufferWriter::Mark start = verts.mark();
-    verts = this->polysToTriangles(polys, SkPathFillType::kWinding, std::move(verts));
-    // Emit the triangles from the outer mesh.
-    for (Vertex* v = fOuterMesh.fHead; v; v = v->fNext) {
-        for (Edge* e = v->fFirstEdgeBelow; e; e = e->fNextEdgeBelow) {
-            Vertex* v0 = e->fTop;
-            Vertex* v1 = e->fBottom;
-            Vertex* v2 = e->fBottom->fPartner;
-            Vertex* v3 = e->fTop->fPartner;
-            verts = this->emitTriangle(v0, v1, v2, 0/*winding*/, std::move(verts));
-            verts = this->emitTriangle(v0, v2, v3, 0/*winding*/, std::move(verts));
-        }
-    }
+    verts = this->polysToAATriangles(polys, std::move(verts));
 
     int actualCount = static_cast<int>((verts.mark() - start) / vertexStride);
     SkASSERT(actualCount <= count);
     vertexAllocator->unlock(actualCount);
     return actualCount;
 }
+
+int GrAATriangulator::PathToAATrianglesParallel(const SkPath& path, SkScalar tolerance,
+                                                const SkRect& clipBounds,
+                                                GrEagerVertexAllocator* vertexAllocator,
+                                                SkExecutor* executor,
+                                                GrTriangulatorArenas* arenas) {
+    // Vertices move by up to an eighth of a pixel when they're rounded, and the outer ramp reaches
+    // half a pixel past the boundary, or 0.5 / sin(7 degrees) ~= 4.1 pixels at the sharpest corner
+    // that gets mitered. Groups further apart than twice that can't touch.
+    constexpr SkScalar kMinGap = 9;
+    std::vector<SkPath> paths;
+    if (executor && arenas) {
+        paths = SplitForParallel(path, kMinGap);
+    }
+    const int taskCount = SkToInt(paths.size());
+    if (taskCount < 2) {
+        return PathToAATriangles(path, tolerance, clipBounds, vertexAllocator);
+    }
+
+    struct Task {
+        std::unique_ptr<GrAATriangulator> fTriangulator;
+        Poly* fPolys = nullptr;
+        bool  fSuccess = false;
+    };
+    std::vector<Task> tasks(taskCount);
+    for (int i = 0; i < taskCount; ++i) {
+        tasks[i].fTriangulator.reset(
+                new GrAATriangulator(paths[i], arenas->arena(i, ArenaBlockSize(paths[i]))));
+        tasks[i].fTriangulator->fRoundVerticesToQuarterPixel = true;
+        tasks[i].fTriangulator->fEmitCoverage = true;
+    }
+
+    SkTaskGroup taskGroup(*executor);
+    taskGroup.batch(taskCount, [&](int i) {
+        Task& task = tasks[i];
+        bool isLinear;
+        std::tie(task.fPolys, task.fSuccess) =
+                task.fTriangulator->pathToPolys(tolerance, clipBounds, &isLinear);
+    });
+    taskGroup.wait();
+
+    int count = 0;
+    auto done = [&] {
+        tasks.clear();
+        arenas->reset();
+        return count;
+    };
+
+    int64_t count64 = 0;
+    for (const Task& task : tasks) {
+        if (!task.fSuccess) {
+            done();
+            return PathToAATriangles(path, tolerance, clipBounds, vertexAllocator);
+        }
+        count64 += task.fTriangulator->countAAPoints(task.fPolys);
+    }
+    if (0 == count64 || count64 > SK_MaxS32) {
+        return done();
+    }
+
+    size_t vertexStride = sizeof(SkPoint) + sizeof(float);
+    skgpu::VertexWriter verts = vertexAllocator->lockWriter(vertexStride, count64);
+    if (!verts) {
+        SkDebugf("Could not allocate vertices\n");
+        return done();
+    }
+    skgpu::BufferWriter::Mark start = verts.mark();
+    for (const Task& task : tasks) {
+        verts = task.fTriangulator->polysToAATriangles(task.fPolys, std::move(verts));
+    }
+    count = static_cast<int>((verts.mark() - start) / vertexStride);
+    SkASSERT(count <= count64);
+    vertexAllocator->unlock(count);
+    return done();
+}
@@ -27,6 +27,14 @@ public:
         return aaTriangulator.polysToAATriangles(polys, vertexAllocator);
     }
 
+    // Like PathToAATriangles(), but triangulates groups of contours in parallel on the executor,
+    // the way GrTriangulator::PathToTrianglesParallel() does. The groups are kept far enough
+    // apart that their alpha ramps can't overlap.
+    static int PathToAATrianglesParallel(const SkPath& path, SkScalar tolerance,
+                                         const SkRect& clipBounds,
+                                         GrEagerVertexAllocator* vertexAllocator,
+                                         SkExecutor* executor, GrTriangulatorArenas* arenas);
+
     // Structs used by GrAATriangulator internals.
     struct SSEdge;
     struct EventList;
@@ -70,6 +78,8 @@ private:
     // Run steps 3-6 above on the new mesh, and produce antialiased triangles.
     std::tuple<Poly*, bool> tessellate(const VertexList& mesh, const Comparator&) override;
     int polysToAATriangles(Poly*, GrEagerVertexAllocator*) const;
+    int64_t countAAPoints(Poly*) const;
+    skgpu::VertexWriter polysToAATriangles(Poly*, skgpu::VertexWriter data) const;
 
     // Additional helpers and driver functions.
     void makeEvent(SSEdge*, EventList* events) const;
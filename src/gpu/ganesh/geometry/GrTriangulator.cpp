@@ -12,9 +12,12 @@
 #include "src/gpu/ganesh/geometry/GrPathUtils.h"
 
 #include "src/core/SkGeometry.h"
+#include "src/core/SkPathPriv.h"
 #include "src/core/SkPointPriv.h"
+#include "src/core/SkTaskGroup.h"
 
 #include <algorithm>
+#include <numeric>
 
 
 #if TRIANGULATOR_LOGGING
@@ -1663,3 +1666,196 @@ int GrTriangulator::polysToTriangles(Poly* polys, GrEagerVertexAllocator* vertex
     vertexAllocator->unlock(actualCount);
     return actualCount;
 }
+
+SkArenaAlloc* GrTriangulatorArenas::arena(int i, size_t blockSize) {
+    while ((int)fArenas.size() <= i) {
+        fArenas.push_back(std::make_unique<Arena>());
+    }
+    Arena* arena = fArenas[i].get();
+    if (!arena->fAlloc || arena->fBlockSize < blockSize) {
+        arena->fAlloc.reset();
+        arena->fBlock.reset(new char[blockSize]);
+        arena->fBlockSize = blockSize;
+        arena->fAlloc.emplace(arena->fBlock.get(), blockSize,
+                              GrTriangulator::kArenaDefaultChunkSize);
+    }
+    return &*arena->fAlloc;
+}
+
+void GrTriangulatorArenas::reset() {
+    for (const std::unique_ptr<Arena>& arena : fArenas) {
+        if (arena->fAlloc) {
+            arena->fAlloc->reset();
+        }
+    }
+}
+
+// Splits the contours of a path into at most maxPaths paths, such that the bounds of contours in
+// different paths are more than minGap apart. Each path gets about the same number of verbs.
+static std::vector<SkPath> split_disjoint_contours(const SkPath& path, int maxPaths,
+                                                   SkScalar minGap) {
+    std::vector<SkPath> contours;
+    for (auto [verb, pts, weights] : SkPathPriv::Iterate(path)) {
+        switch (verb) {
+            case SkPathVerb::kMove:  contours.emplace_back().moveTo(pts[0]);                 break;
+            case SkPathVerb::kLine:  contours.back().lineTo(pts[1]);                         break;
+            case SkPathVerb::kQuad:  contours.back().quadTo(pts[1], pts[2]);                 break;
+            case SkPathVerb::kConic: contours.back().conicTo(pts[1], pts[2], *weights);      break;
+            case SkPathVerb::kCubic: contours.back().cubicTo(pts[1], pts[2], pts[3]);        break;
+            case SkPathVerb::kClose: contours.back().close();                                break;
+        }
+    }
+    const int n = SkToInt(contours.size());
+
+    // Union contours whose bounds are within minGap, sweeping left to right so that each contour
+    // is only compared with those that come that close in x.
+    std::vector<int> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](int i) {
+        while (parent[i] != i) {
+            i = parent[i] = parent[parent[i]];
+        }
+        return i;
+    };
+    std::vector<int> order(parent);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return contours[a].getBounds().fLeft < contours[b].getBounds().fLeft;
+    });
+    std::vector<int> active;
+    for (int i : order) {
+        const SkRect& bounds = contours[i].getBounds();
+        active.erase(std::remove_if(active.begin(), active.end(), [&](int j) {
+                         return contours[j].getBounds().fRight + minGap < bounds.fLeft;
+                     }), active.end());
+        for (int j : active) {
+            const SkRect& other = contours[j].getBounds();
+            if (other.fTop <= bounds.fBottom + minGap && bounds.fTop <= other.fBottom + minGap) {
+                parent[find(i)] = find(j);
+            }
+        }
+        active.push_back(i);
+    }
+
+    // Deal out whole groups of contours, in the order they first appear, so that each path gets
+    // its share of the verbs.
+    std::vector<int> groupVerbs(n, 0);
+    for (int i = 0; i < n; ++i) {
+        groupVerbs[find(i)] += contours[i].countVerbs();
+    }
+    std::vector<int> pathOf(n, -1);
+    const int totalVerbs = path.countVerbs();
+    int verbs = 0, current = 0;
+    for (int i = 0; i < n; ++i) {
+        int root = find(i);
+        if (pathOf[root] < 0) {
+            if (current + 1 < maxPaths && verbs >= (int64_t)(current + 1) * totalVerbs / maxPaths) {
+                current++;
+            }
+            pathOf[root] = current;
+            verbs += groupVerbs[root];
+        }
+    }
+
+    std::vector<SkPath> paths(current + 1);
+    for (SkPath& p : paths) {
+        p.setFillType(path.getFillType());
+    }
+    for (int i = 0; i < n; ++i) {
+        paths[pathOf[find(i)]].addPath(contours[i]);
+    }
+    return paths;
+}
+
+std::vector<SkPath> GrTriangulator::SplitForParallel(const SkPath& path, SkScalar minGap) {
+    // Small paths aren't worth the tasks. Inverse fills cover the clip bounds outside of every
+    // contour, so they can't be split.
+    constexpr int kMaxTasks = 16;
+    constexpr int kMinVerbsPerTask = 64;
+    const int maxTasks = std::min(kMaxTasks, path.countVerbs() / kMinVerbsPerTask);
+    if (maxTasks < 2 || path.isInverseFillType() || !path.isFinite()) {
+        return {};
+    }
+    return split_disjoint_contours(path, maxTasks, minGap);
+}
+
+size_t GrTriangulator::ArenaBlockSize(const SkPath& path) {
+    return std::max<size_t>(kArenaDefaultChunkSize,
+                            path.countPoints() * (sizeof(Vertex) + sizeof(Edge) * 2));
+}
+
+int GrTriangulator::PathToTrianglesParallel(const SkPath& path, SkScalar tolerance,
+                                            const SkRect& clipBounds,
+                                            GrEagerVertexAllocator* vertexAllocator,
+                                            bool* isLinear, SkExecutor* executor,
+                                            GrTriangulatorArenas* arenas) {
+    std::vector<SkPath> paths;
+    if (executor && arenas) {
+        paths = SplitForParallel(path, 0);
+    }
+    const int taskCount = SkToInt(paths.size());
+    if (taskCount < 2) {
+        return PathToTriangles(path, tolerance, clipBounds, vertexAllocator, isLinear);
+    }
+
+    // Our destructor is protected, so the tasks own their triangulators through this.
+    struct TaskTriangulator : public GrTriangulator {
+        TaskTriangulator(const SkPath& path, SkArenaAlloc* alloc) : GrTriangulator(path, alloc) {}
+    };
+    struct Task {
+        std::unique_ptr<TaskTriangulator> fTriangulator;
+        Poly* fPolys = nullptr;
+        bool  fSuccess = false;
+        bool  fIsLinear = true;
+    };
+    std::vector<Task> tasks(taskCount);
+    for (int i = 0; i < taskCount; ++i) {
+        tasks[i].fTriangulator = std::make_unique<TaskTriangulator>(
+                paths[i], arenas->arena(i, ArenaBlockSize(paths[i])));
+    }
+
+    SkTaskGroup taskGroup(*executor);
+    taskGroup.batch(taskCount, [&](int i) {
+        Task& task = tasks[i];
+        GrTriangulator* triangulator = task.fTriangulator.get();
+        std::tie(task.fPolys, task.fSuccess) =
+                triangulator->pathToPolys(tolerance, clipBounds, &task.fIsLinear);
+    });
+    taskGroup.wait();
+
+    int count = 0;
+    auto done = [&] {
+        tasks.clear();
+        arenas->reset();
+        return count;
+    };
+
+    int64_t count64 = 0;
+    *isLinear = true;
+    for (const Task& task : tasks) {
+        if (!task.fSuccess) {
+            done();
+            return PathToTriangles(path, tolerance, clipBounds, vertexAllocator, isLinear);
+        }
+        count64 += CountPoints(task.fPolys, path.getFillType());
+        *isLinear = *isLinear && task.fIsLinear;
+    }
+    if (0 == count64 || count64 > SK_MaxS32) {
+        return done();
+    }
+
+    // Emitting is cheap next to tessellating, so all the tasks write into one buffer in order.
+    skgpu::VertexWriter verts = vertexAllocator->lockWriter(sizeof(SkPoint), count64);
+    if (!verts) {
+        SkDebugf("Could not allocate vertices\n");
+        return done();
+    }
+    skgpu::BufferWriter::Mark start = verts.mark();
+    for (const Task& task : tasks) {
+        const GrTriangulator* triangulator = task.fTriangulator.get();
+        verts = triangulator->polysToTriangles(task.fPolys, path.getFillType(), std::move(verts));
+    }
+    count = static_cast<int>((verts.mark() - start) / sizeof(SkPoint));
+    SkASSERT(count <= count64);
+    vertexAllocator->unlock(count);
+    return done();
+}
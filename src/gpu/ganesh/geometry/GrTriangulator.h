@@ -14,12 +14,39 @@
 #include "src/core/SkArenaAlloc.h"
 #include "src/gpu/ganesh/GrColor.h"
 
+#include <memory>
+#include <optional>
+#include <vector>
+
 class GrEagerVertexAllocator;
+class SkExecutor;
 struct SkRect;
 
 #define TRIANGULATOR_LOGGING 0
 #define TRIANGULATOR_WIREFRAME 0
 
+/**
+ * Arenas for GrTriangulator::PathToTrianglesParallel() and
+ * GrAATriangulator::PathToAATrianglesParallel(), one per task. Keeping one of these around lets
+ * later paths reuse the blocks the earlier ones allocated. Not thread safe.
+ */
+class GrTriangulatorArenas {
+public:
+    // Returns the i'th arena, with at least blockSize bytes that won't go back to the heap.
+    SkArenaAlloc* arena(int i, size_t blockSize);
+
+    // Destroys everything allocated from the arenas, but keeps their blocks for the next path.
+    void reset();
+
+private:
+    struct Arena {
+        std::unique_ptr<char[]>              fBlock;
+        size_t                               fBlockSize = 0;
+        std::optional<SkArenaAllocWithReset> fAlloc;
+    };
+    std::vector<std::unique_ptr<Arena>> fArenas;
+};
+
 /**
  * Provides utility functions for converting paths to a collection of triangles.
  */
@@ -42,6 +69,15 @@ public:
         return count;
     }
 
+    // Like PathToTriangles(), but first splits the path into groups of contours with disjoint
+    // bounds. A contour has no winding outside its bounds, so each group fills exactly as it
+    // would as part of the whole path, and the groups are triangulated in parallel on the
+    // executor. Falls back to PathToTriangles() when there is nothing to split.
+    static int PathToTrianglesParallel(const SkPath& path, SkScalar tolerance,
+                                       const SkRect& clipBounds,
+                                       GrEagerVertexAllocator* vertexAllocator, bool* isLinear,
+                                       SkExecutor* executor, GrTriangulatorArenas* arenas);
+
     // Enums used by GrTriangulator internals.
     typedef enum { kLeft_Side, kRight_Side } Side;
     enum class EdgeType { kInner, kOuter, kConnector };
@@ -184,6 +220,13 @@ protected:
     static int64_t CountPoints(Poly* polys, SkPathFillType overrideFillType);
     int polysToTriangles(Poly*, GrEagerVertexAllocator*) const;
 
+    // Helpers for the parallel triangulators. SplitForParallel() groups the contours into paths to
+    // triangulate on separate tasks, with the bounds of different groups more than minGap apart.
+    // It returns fewer than two paths when the path can't be split or isn't worth splitting.
+    static std::vector<SkPath> SplitForParallel(const SkPath&, SkScalar minGap);
+    // Most paths fit in an arena block of this size, even after linearizing curves.
+    static size_t ArenaBlockSize(const SkPath&);
+
     // FIXME: fPath should be plumbed through function parameters instead.
     const SkPath fPath;
     SkArenaAlloc* const fAlloc;
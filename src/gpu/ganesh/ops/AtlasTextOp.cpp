@@ -76,6 +76,8 @@ AtlasTextOp::AtlasTextOp(MaskType maskType,
         , fNeedsGlyphTransform(needsTransform)
         , fHasPerspective(needsTransform && geo->fDrawMatrix.hasPerspective())
         , fUseGammaCorrectDistanceTable(false)
+        , fAcceptsAppends(false)
+        , fHasOpaqueColor(false)
         , fHead{geo}
         , fTail{&fHead->fNext} {
     // We don't have tight bounds on the glyph paths in device space. For the purposes of bounds
@@ -101,6 +103,8 @@ AtlasTextOp::AtlasTextOp(MaskType maskType,
         , fNeedsGlyphTransform(needsTransform)
         , fHasPerspective(needsTransform && geo->fDrawMatrix.hasPerspective())
         , fUseGammaCorrectDistanceTable(useGammaCorrectDistanceTable)
+        , fAcceptsAppends(false)
+        , fHasOpaqueColor(false)
         , fLuminanceColor(luminanceColor)
         , fHead{geo}
         , fTail{&fHead->fNext} {
@@ -186,6 +190,14 @@ GrProcessorSet::Analysis AtlasTextOp::finalize(const GrCaps& caps,
             break;
     }
 
+    // With no fragment processors, no clip and automatic clamping, the analysis and xfer processor
+    // only depend on the caps, the mask type and whether the color is opaque. The color isn't
+    // overridden either. So finalizing a later op that matches in those would change nothing, and
+    // it can skip straight to merging. See appendToLastOp().
+    fAcceptsAppends = fProcessors.isTrivial() && !(clip && clip->doesClip()) &&
+                      clampType == GrClampType::kAuto;
+    fHasOpaqueColor = fHead->fColor.isOpaque();
+
     auto analysis = fProcessors.finalize(color, coverage, clip, &GrUserStencilSettings::kUnused,
                                          caps, clampType, &fHead->fColor);
     // TODO(michaelludwig): Once processor analysis can be done external to op creation/finalization
@@ -195,6 +207,55 @@ GrProcessorSet::Analysis AtlasTextOp::finalize(const GrCaps& caps,
     return analysis;
 }
 
+bool AtlasTextOp::appendToLastOp(SurfaceDrawContext* sdc) {
+    SkASSERT(!fProcessors.isFinalized());
+    // LCD text's xfer processor may depend on the color itself, and distance field ops carry more
+    // state than is worth checking here. Manual clamping can change the xfer processor.
+    if (!fProcessors.isTrivial() || this->isLCD() || this->usesDistanceFields() ||
+        GrColorTypeClampType(sdc->colorInfo().colorType()) != GrClampType::kAuto) {
+        return false;
+    }
+    GrOp* lastOp = sdc->lastOpForAppend(ClassID());
+    if (lastOp == nullptr) {
+        return false;
+    }
+
+    // The last op was finalized by the same context, unclipped and with automatic clamping, so
+    // finalize() would give this op the same analysis if it has the same mask type and opacity
+    // (or, for color bitmaps, ignores the color). Past that, these are the checks
+    // onCombineIfPossible() makes, given that both ops have trivial paints.
+    auto that = lastOp->cast<AtlasTextOp>();
+    if (!that->fAcceptsAppends ||
+        fMaskType != that->fMaskType ||
+        fNeedsGlyphTransform != that->fNeedsGlyphTransform ||
+        fHasPerspective != that->fHasPerspective) {
+        return false;
+    }
+    SkASSERT(!that->fUsesLocalCoords && that->fDFGPFlags == 0);
+    if (this->maskType() == MaskType::kColorBitmap) {
+        if (fHead->fColor != that->fHead->fColor) {
+            return false;
+        }
+    } else if (fHead->fColor.isOpaque() != that->fHasOpaqueColor) {
+        return false;
+    }
+
+    // Like addDrawOp(), drop the draw if it's entirely outside the surface.
+    SkRect bounds = this->bounds();
+    if (bounds.intersect(sdc->asSurfaceProxy()->getBoundsRect())) {
+        SkRect joined = that->bounds();
+        joined.join(bounds);
+        that->setClippedBounds(joined);
+        sdc->didGrowLastOp(bounds);
+
+        that->fNumGlyphs += fNumGlyphs;
+        // As in onCombineIfPossible(), this op's geometry now belongs to that op.
+        that->addGeometry(fHead);
+        fHead = nullptr;
+    }
+    return true;
+}
+
 void AtlasTextOp::onPrepareDraws(GrMeshDrawTarget* target) {
     auto resourceProvider = target->resourceProvider();
 
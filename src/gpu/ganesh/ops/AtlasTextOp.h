@@ -86,6 +86,14 @@ public:
 
     GrProcessorSet::Analysis finalize(const GrCaps&, const GrAppliedClip*, GrClampType) override;
 
+    // Called on a new, unclipped op instead of adding it with SurfaceDrawContext::addDrawOp().
+    // When this op has a trivial paint, finalize() would give it the same analysis as the last op
+    // recorded by the SDC, and that op is one it would merge with anyway, moves this op's geometry
+    // directly into that op and returns true; the caller then drops this op. This skips processor
+    // analysis and the OpsTask's search for an op to merge with, which dominate the cost of
+    // drawing many small text blobs.
+    bool appendToLastOp(SurfaceDrawContext*);
+
     enum class MaskType : uint32_t {
         kGrayscaleCoverage,
         kLCDCoverage,
@@ -234,6 +242,8 @@ private:
     uint32_t fNeedsGlyphTransform          : 1;
     uint32_t fHasPerspective               : 1; // True if perspective affects draw
     uint32_t fUseGammaCorrectDistanceTable : 1;
+    uint32_t fAcceptsAppends               : 1; // Filled in post processor analysis
+    uint32_t fHasOpaqueColor               : 1; // Filled in post processor analysis
     static_assert(kMaskTypeCount <= 8, "MaskType does not fit in 3 bits");
     static_assert(kInvalid_DistanceFieldEffectFlag <= (1 << 8),  "DFGP Flags do not fit in 9 bits");
 
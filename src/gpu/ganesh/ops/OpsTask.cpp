@@ -1010,6 +1010,24 @@ void OpsTask::recordOp(
     fOpChains.emplace_back(std::move(op), processorAnalysis, clip, dstProxyView);
 }
 
+GrOp* OpsTask::lastOpForAppend(uint32_t opClassID) const {
+    if (this->isClosed() || fOpChains.empty()) {
+        return nullptr;
+    }
+    const OpChain& chain = fOpChains.back();
+    GrOp* op = chain.tail();
+    if (!op || op->classID() != opClassID || chain.appliedClip() || chain.dstProxyView().proxy()) {
+        return nullptr;
+    }
+    return op;
+}
+
+void OpsTask::didGrowLastOp(const SkRect& bounds) {
+    SkASSERT(!this->isClosed() && !fOpChains.empty());
+    fTotalBounds.join(bounds);
+    fOpChains.back().joinBounds(bounds);
+}
+
 void OpsTask::forwardCombine(const GrCaps& caps) {
     SkASSERT(!this->isClosed());
     GrOP_INFO("opsTask: %d ForwardCombine %d ops:\n", this->uniqueID(), fOpChains.count());
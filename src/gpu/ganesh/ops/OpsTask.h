@@ -175,11 +175,15 @@ private:
         void visitProxies(const GrVisitProxyFunc&) const;
 
         GrOp* head() const { return fList.head(); }
+        GrOp* tail() const { return fList.tail(); }
 
         GrAppliedClip* appliedClip() const { return fAppliedClip; }
         const GrDstProxyView& dstProxyView() const { return fDstProxyView; }
         const SkRect& bounds() const { return fBounds; }
 
+        // Accounts for draws folded directly into the tail op by its owner.
+        void joinBounds(const SkRect& bounds) { fBounds.joinPossiblyEmptyRect(bounds); }
+
         // Deletes all the ops in the chain.
         void deleteOps();
 
@@ -245,6 +249,13 @@ private:
 
     void forwardCombine(const GrCaps&);
 
+    // Returns the last op recorded if it's of class 'opClassID' and was recorded without a clip or
+    // dst proxy. An unclipped draw that would merge with it anyway may be folded into it in place,
+    // since nothing recorded after it can be out of order with the draw. The caller must then
+    // report the draw's bounds with didGrowLastOp().
+    GrOp* lastOpForAppend(uint32_t opClassID) const;
+    void didGrowLastOp(const SkRect& bounds);
+
     // Remove all ops, proxies, etc. Used in the merging algorithm when tasks can be skipped.
     void reset();
 
@@ -12,6 +12,7 @@
 #include "src/gpu/ganesh/GrAuditTrail.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrDefaultGeoProcFactory.h"
+#include "src/gpu/ganesh/GrDirectContextPriv.h"
 #include "src/gpu/ganesh/GrDrawOpTest.h"
 #include "src/gpu/ganesh/GrEagerVertexAllocator.h"
 #include "src/gpu/ganesh/GrOpFlushState.h"
@@ -177,9 +178,16 @@ public:
                             SkIRect devClipBounds,
                             GrAAType aaType,
                             const GrUserStencilSettings* stencilSettings) {
+        // A direct context prepares its ops on its own thread, so they can share its arenas.
+        SkExecutor* executor = nullptr;
+        GrTriangulatorArenas* arenas = nullptr;
+        if (auto direct = context->asDirectContext()) {
+            executor = direct->priv().options().fExecutor;
+            arenas = direct->priv().getTriangulatorArenas();
+        }
         return Helper::FactoryHelper<TriangulatingPathOp>(context, std::move(paint), shape,
                                                           viewMatrix, devClipBounds, aaType,
-                                                          stencilSettings);
+                                                          stencilSettings, executor, arenas);
     }
 
     const char* name() const override { return "TriangulatingPathOp"; }
@@ -198,14 +206,18 @@ public:
                         const SkMatrix& viewMatrix,
                         const SkIRect& devClipBounds,
                         GrAAType aaType,
-                        const GrUserStencilSettings* stencilSettings)
+                        const GrUserStencilSettings* stencilSettings,
+                        SkExecutor* executor,
+                        GrTriangulatorArenas* arenas)
             : INHERITED(ClassID())
             , fHelper(processorSet, aaType, stencilSettings)
             , fColor(color)
             , fShape(shape)
             , fViewMatrix(viewMatrix)
             , fDevClipBounds(devClipBounds)
-            , fAntiAlias(GrAAType::kCoverage == aaType) {
+            , fAntiAlias(GrAAType::kCoverage == aaType)
+            , fExecutor(executor)
+            , fArenas(arenas) {
         SkRect devBounds;
         viewMatrix.mapRect(&devBounds, shape.bounds());
         if (shape.inverseFilled()) {
@@ -258,13 +270,16 @@ private:
     }
 
     // Triangulate the provided 'shape' in the shape's coordinate space. 'tol' should already
-    // have been mapped back from device space.
+    // have been mapped back from device space. With an executor, disjoint parts of the path are
+    // triangulated in parallel.
     static int Triangulate(GrEagerVertexAllocator* allocator,
                            const SkMatrix& viewMatrix,
                            const GrStyledShape& shape,
                            const SkIRect& devClipBounds,
                            SkScalar tol,
-                           bool* isLinear) {
+                           bool* isLinear,
+                           SkExecutor* executor,
+                           GrTriangulatorArenas* arenas) {
         SkRect clipBounds = SkRect::Make(devClipBounds);
 
         SkMatrix vmi;
@@ -277,7 +292,8 @@ private:
         SkPath path;
         shape.asPath(&path);
 
-        return GrTriangulator::PathToTriangles(path, tol, clipBounds, allocator, isLinear);
+        return GrTriangulator::PathToTrianglesParallel(path, tol, clipBounds, allocator, isLinear,
+                                                       executor, arenas);
     }
 
     void createNonAAMesh(GrMeshDrawTarget* target) {
@@ -322,7 +338,7 @@ private:
 
         bool isLinear;
         int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds, tol,
-                                      &isLinear);
+                                      &isLinear, fExecutor, fArenas);
         if (vertexCount == 0) {
             return;
         }
@@ -360,7 +376,9 @@ private:
         sk_sp<const GrBuffer> vertexBuffer;
         int firstVertex;
         GrEagerDynamicVertexAllocator allocator(target, &vertexBuffer, &firstVertex);
-        int vertexCount = GrAATriangulator::PathToAATriangles(path, tol, clipBounds, &allocator);
+        int vertexCount = GrAATriangulator::PathToAATrianglesParallel(path, tol, clipBounds,
+                                                                      &allocator, fExecutor,
+                                                                      fArenas);
         if (vertexCount == 0) {
             return;
         }
@@ -460,7 +478,7 @@ private:
 
         bool isLinear;
         int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds, tol,
-                                      &isLinear);
+                                      &isLinear, fExecutor, fArenas);
         if (vertexCount == 0) {
             return;
         }
@@ -533,6 +551,8 @@ private:
     SkMatrix       fViewMatrix;
     SkIRect        fDevClipBounds;
     bool           fAntiAlias;
+    SkExecutor*    fExecutor;
+    GrTriangulatorArenas* fArenas;  // Shared with the context's other ops, if we have an executor.
 
     GrSimpleMesh*  fMesh = nullptr;
     GrProgramInfo* fProgramInfo = nullptr;
@@ -1324,7 +1324,9 @@ bool Device::android_utils_clipWithStencil() {
 }
 
 SkStrikeDeviceInfo Device::strikeDeviceInfo() const {
-    return {this->surfaceProps(), this->scalerContextFlags(), &fSDFTControl};
+    // DDL recorders are the recording contexts that aren't direct contexts.
+    const bool prepareGlyphImages = fContext->asDirectContext() == nullptr;
+    return {this->surfaceProps(), this->scalerContextFlags(), &fSDFTControl, prepareGlyphImages};
 }
 
 } // namespace skgpu::v1
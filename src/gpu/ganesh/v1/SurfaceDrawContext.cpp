@@ -1996,6 +1996,19 @@ void SurfaceDrawContext::addDrawOp(const GrClip* clip,
 #endif
 }
 
+GrOp* SurfaceDrawContext::lastOpForAppend(uint32_t opClassID) {
+    ASSERT_SINGLE_OWNER
+    if (fContext->abandoned()) {
+        return nullptr;
+    }
+    return this->getOpsTask()->lastOpForAppend(opClassID);
+}
+
+void SurfaceDrawContext::didGrowLastOp(const SkRect& bounds) {
+    ASSERT_SINGLE_OWNER
+    this->getOpsTask()->didGrowLastOp(bounds);
+}
+
 bool SurfaceDrawContext::setupDstProxyView(const SkRect& opBounds,
                                            bool opRequiresMSAA,
                                            GrDstProxyView* dstProxyView) {
@@ -576,6 +576,12 @@ public:
                    const std::function<WillAddOpFn>& = std::function<WillAddOpFn>());
     void addDrawOp(GrOp::Owner op) { this->addDrawOp(nullptr, std::move(op)); }
 
+    // Lets ops that are often drawn in long runs of mergeable draws (e.g. AtlasTextOp for many
+    // small text blobs) fold an unclipped draw directly into the last op recorded, rather than
+    // going through addDrawOp. See OpsTask::lastOpForAppend().
+    GrOp* lastOpForAppend(uint32_t opClassID);
+    void didGrowLastOp(const SkRect& bounds);
+
     bool refsWrappedObjects() const { return this->asRenderTargetProxy()->refsWrappedObjects(); }
 
     /**
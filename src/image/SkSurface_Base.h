@@ -68,6 +68,13 @@ public:
 
     virtual void onWritePixels(const SkPixmap&, int x, int y) = 0;
 
+    /**
+     *  Returns a canvas that can read (and peek) the surface's current pixels. By default this
+     *  is the cached drawing canvas. Surfaces whose drawing canvas defers rasterization should
+     *  complete any pending work and return a canvas backed by their pixels.
+     */
+    virtual SkCanvas* onGetPixelsCanvas() { return this->getCachedCanvas(); }
+
     /**
      * Default implementation does a rescale/read and then calls the callback.
      */
@@ -0,0 +1,408 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkCapabilities.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkMallocPixelRef.h"
+#include "include/private/SkTemplates.h"
+#include "src/core/SkBigPicture.h"
+#include "src/core/SkImagePriv.h"
+#include "src/core/SkRTree.h"
+#include "src/core/SkRecord.h"
+#include "src/core/SkRecordDraw.h"
+#include "src/core/SkRecorder.h"
+#include "src/core/SkTaskGroup.h"
+#include "src/image/SkSurface_Base.h"
+
+class SkSurface_TiledRaster;
+
+namespace {
+
+// Records draws like any SkRecorder, but rasterizes them into the owning surface on flush().
+class TiledRasterRecorder final : public SkRecorder {
+public:
+    TiledRasterRecorder(SkSurface_TiledRaster* surface, SkRecord* record, const SkImageInfo& info)
+            : SkRecorder(record, SkRect::Make(info.dimensions()))
+            , fSurface(surface)
+            , fInfo(info) {}
+
+    void onFlush() override;
+    SkImageInfo onImageInfo() const override { return fInfo; }
+
+    // SkRecorder doesn't go through SkCanvas' draw path, which would let the surface know its
+    // contents are about to change (dropping its cached snapshot), so we do that ourselves.
+    void onDrawPaint(const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawPaint(paint);
+    }
+    void onDrawBehind(const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawBehind(paint);
+    }
+    void onDrawPoints(PointMode mode, size_t count, const SkPoint pts[],
+                      const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawPoints(mode, count, pts, paint);
+    }
+    void onDrawRect(const SkRect& rect, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawRect(rect, paint);
+    }
+    void onDrawRegion(const SkRegion& region, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawRegion(region, paint);
+    }
+    void onDrawOval(const SkRect& oval, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawOval(oval, paint);
+    }
+    void onDrawArc(const SkRect& oval, SkScalar startAngle, SkScalar sweepAngle, bool useCenter,
+                   const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawArc(oval, startAngle, sweepAngle, useCenter, paint);
+    }
+    void onDrawRRect(const SkRRect& rrect, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawRRect(rrect, paint);
+    }
+    void onDrawDRRect(const SkRRect& outer, const SkRRect& inner, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawDRRect(outer, inner, paint);
+    }
+    void onDrawPath(const SkPath& path, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawPath(path, paint);
+    }
+    void onDrawDrawable(SkDrawable* drawable, const SkMatrix* matrix) override {
+        this->willDraw();
+        SkRecorder::onDrawDrawable(drawable, matrix);
+    }
+    void onDrawTextBlob(const SkTextBlob* blob, SkScalar x, SkScalar y,
+                        const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawTextBlob(blob, x, y, paint);
+    }
+#if SK_SUPPORT_GPU
+    void onDrawSlug(const sktext::gpu::Slug* slug) override {
+        this->willDraw();
+        SkRecorder::onDrawSlug(slug);
+    }
+#endif
+    void onDrawGlyphRunList(const sktext::GlyphRunList& glyphRunList,
+                            const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawGlyphRunList(glyphRunList, paint);
+    }
+    void onDrawPatch(const SkPoint cubics[12], const SkColor colors[4],
+                     const SkPoint texCoords[4], SkBlendMode mode, const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawPatch(cubics, colors, texCoords, mode, paint);
+    }
+    void onDrawImage2(const SkImage* image, SkScalar x, SkScalar y,
+                      const SkSamplingOptions& sampling, const SkPaint* paint) override {
+        this->willDraw();
+        SkRecorder::onDrawImage2(image, x, y, sampling, paint);
+    }
+    void onDrawImageRect2(const SkImage* image, const SkRect& src, const SkRect& dst,
+                          const SkSamplingOptions& sampling, const SkPaint* paint,
+                          SrcRectConstraint constraint) override {
+        this->willDraw();
+        SkRecorder::onDrawImageRect2(image, src, dst, sampling, paint, constraint);
+    }
+    void onDrawImageLattice2(const SkImage* image, const Lattice& lattice, const SkRect& dst,
+                             SkFilterMode filter, const SkPaint* paint) override {
+        this->willDraw();
+        SkRecorder::onDrawImageLattice2(image, lattice, dst, filter, paint);
+    }
+    void onDrawAtlas2(const SkImage* atlas, const SkRSXform xform[], const SkRect tex[],
+                      const SkColor colors[], int count, SkBlendMode mode,
+                      const SkSamplingOptions& sampling, const SkRect* cull,
+                      const SkPaint* paint) override {
+        this->willDraw();
+        SkRecorder::onDrawAtlas2(atlas, xform, tex, colors, count, mode, sampling, cull, paint);
+    }
+    void onDrawVerticesObject(const SkVertices* vertices, SkBlendMode mode,
+                              const SkPaint& paint) override {
+        this->willDraw();
+        SkRecorder::onDrawVerticesObject(vertices, mode, paint);
+    }
+    void onDrawShadowRec(const SkPath& path, const SkDrawShadowRec& rec) override {
+        this->willDraw();
+        SkRecorder::onDrawShadowRec(path, rec);
+    }
+    void onDrawPicture(const SkPicture* picture, const SkMatrix* matrix,
+                       const SkPaint* paint) override {
+        this->willDraw();
+        SkRecorder::onDrawPicture(picture, matrix, paint);
+    }
+    void onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4], QuadAAFlags aa,
+                          const SkColor4f& color, SkBlendMode mode) override {
+        this->willDraw();
+        SkRecorder::onDrawEdgeAAQuad(rect, clip, aa, color, mode);
+    }
+    void onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count, const SkPoint dstClips[],
+                               const SkMatrix preViewMatrices[], const SkSamplingOptions& sampling,
+                               const SkPaint* paint, SrcRectConstraint constraint) override {
+        this->willDraw();
+        SkRecorder::onDrawEdgeAAImageSet2(set, count, dstClips, preViewMatrices, sampling, paint,
+                                          constraint);
+    }
+
+private:
+    void willDraw();
+
+    SkSurface_TiledRaster* fSurface;
+    const SkImageInfo      fInfo;
+};
+
+// Replays ops that were already rasterized by an earlier flush. Only their effect on the canvas
+// matrix and clip is needed to draw the ops that follow them.
+class ReplayState {
+public:
+    ReplayState(SkCanvas* canvas, SkRecords::Draw* draw) : fCanvas(canvas), fDraw(draw) {}
+
+    template <typename T>
+    std::enable_if_t<(T::kTags & SkRecords::kDraw_Tag) != 0> operator()(const T&) {}
+
+    template <typename T>
+    std::enable_if_t<(T::kTags & SkRecords::kDraw_Tag) == 0> operator()(const T& op) {
+        (*fDraw)(op);
+    }
+
+    // Their contents have been drawn already; a plain save keeps restores balanced.
+    void operator()(const SkRecords::SaveLayer&)  { fCanvas->save(); }
+    void operator()(const SkRecords::SaveBehind&) { fCanvas->save(); }
+    void operator()(const SkRecords::DrawAnnotation&) {}
+    void operator()(const SkRecords::Flush&) {}
+
+private:
+    SkCanvas*        fCanvas;
+    SkRecords::Draw* fDraw;
+};
+
+}  // namespace
+
+class SkSurface_TiledRaster : public SkSurface_Base {
+public:
+    SkSurface_TiledRaster(const SkImageInfo& info, sk_sp<SkPixelRef>, SkExecutor*,
+                          SkISize tileSize, const SkSurfaceProps*);
+
+    SkCanvas* onNewCanvas() override;
+    sk_sp<SkSurface> onNewSurface(const SkImageInfo&) override;
+    sk_sp<SkImage> onNewImageSnapshot(const SkIRect* subset) override;
+    void onWritePixels(const SkPixmap&, int x, int y) override;
+    SkCanvas* onGetPixelsCanvas() override;
+    void onDraw(SkCanvas*, SkScalar, SkScalar, const SkSamplingOptions&, const SkPaint*) override;
+    bool onCopyOnWrite(ContentChangeMode) override;
+    void onRestoreBackingMutability() override;
+    sk_sp<const SkCapabilities> onCapabilities() override;
+
+    // Rasterizes every op recorded since the last call.
+    void resolve();
+
+private:
+    void drawTile(const SkIRect& tile, const SkBBoxHierarchy& bbh,
+                  const SkBigPicture::SnapshotArray* drawables) const;
+
+    SkBitmap                   fBitmap;
+    SkExecutor*                fExecutor;
+    const SkISize              fTileSize;
+    std::unique_ptr<SkRecord>  fRecord;
+    TiledRasterRecorder*       fRecorder = nullptr;  // Owned by SkSurface_Base's cached canvas.
+    int                        fResolvedOps = 0;
+    std::unique_ptr<SkCanvas>  fPixelsCanvas;
+
+    using INHERITED = SkSurface_Base;
+};
+
+void TiledRasterRecorder::onFlush() { fSurface->resolve(); }
+
+void TiledRasterRecorder::willDraw() {
+    fSurface->notifyContentWillChange(SkSurface::kRetain_ContentChangeMode);
+}
+
+SkSurface_TiledRaster::SkSurface_TiledRaster(const SkImageInfo& info, sk_sp<SkPixelRef> pr,
+                                             SkExecutor* executor, SkISize tileSize,
+                                             const SkSurfaceProps* props)
+        : INHERITED(pr->width(), pr->height(), props)
+        , fExecutor(executor)
+        , fTileSize(tileSize)
+        , fRecord(new SkRecord) {
+    fBitmap.setInfo(info, pr->rowBytes());
+    fBitmap.setPixelRef(std::move(pr), 0, 0);
+}
+
+SkCanvas* SkSurface_TiledRaster::onNewCanvas() {
+    SkASSERT(!fRecorder);
+    fRecorder = new TiledRasterRecorder(this, fRecord.get(), fBitmap.info());
+    return fRecorder;
+}
+
+sk_sp<SkSurface> SkSurface_TiledRaster::onNewSurface(const SkImageInfo& info) {
+    return SkSurface::MakeRasterTiled(info, fExecutor, fTileSize, &this->props());
+}
+
+void SkSurface_TiledRaster::resolve() {
+    if (!fRecorder || fRecord->count() == fResolvedOps) {
+        return;
+    }
+    const SkRect cull = SkRect::Make(fBitmap.dimensions());
+    const int count = fRecord->count();
+
+    SkAutoTMalloc<SkRect> bounds(count);
+    SkAutoTMalloc<SkBBoxHierarchy::Metadata> meta(count);
+    SkRecordFillBounds(cull, *fRecord, bounds.get(), meta.get());
+    SkRTree rtree;
+    rtree.insert(bounds.get(), count);
+
+    // Drawables may not be thread safe, so each tile plays back the same snapshot of them.
+    std::unique_ptr<SkBigPicture::SnapshotArray> drawables;
+    if (SkDrawableList* list = fRecorder->getDrawableList()) {
+        drawables.reset(list->newDrawableSnapshot());
+    }
+
+    const int tilesX = (fBitmap.width()  + fTileSize.width()  - 1) / fTileSize.width(),
+              tilesY = (fBitmap.height() + fTileSize.height() - 1) / fTileSize.height();
+
+    SkTaskGroup tasks(fExecutor ? *fExecutor : SkExecutor::GetDefault());
+    tasks.batch(tilesX * tilesY, [&](int i) {
+        const SkIRect tile = SkIRect::MakeXYWH((i % tilesX) * fTileSize.width(),
+                                               (i / tilesX) * fTileSize.height(),
+                                               fTileSize.width(),
+                                               fTileSize.height());
+        this->drawTile(tile, rtree, drawables.get());
+    });
+    tasks.wait();
+    fResolvedOps = count;
+
+    // Once the recorder is back to its initial state, nothing recorded so far can affect later
+    // draws, so we can start over with an empty record.
+    if (fRecorder->getSaveCount() == 1 &&
+        fRecorder->getLocalToDevice() == SkM44() &&
+        fRecorder->isClipRect() &&
+        fRecorder->getDeviceClipBounds() == fBitmap.bounds()) {
+        fRecord.reset(new SkRecord);
+        fRecorder->reset(fRecord.get(), cull);
+        fResolvedOps = 0;
+    }
+}
+
+void SkSurface_TiledRaster::drawTile(const SkIRect& tile, const SkBBoxHierarchy& bbh,
+                                     const SkBigPicture::SnapshotArray* drawables) const {
+    SkIRect clipped = tile;
+    if (!clipped.intersect(fBitmap.bounds())) {
+        return;
+    }
+
+    std::vector<int> ops;
+    bbh.search(SkRect::Make(clipped), &ops);
+    // Skip tiles where nothing new was recorded.
+    if (std::none_of(ops.begin(), ops.end(), [&](int op) { return op >= fResolvedOps; })) {
+        return;
+    }
+
+    SkBitmap pixels;
+    SkAssertResult(fBitmap.extractSubset(&pixels, clipped));
+    SkCanvas canvas(pixels, this->props());
+    canvas.translate(-clipped.x(), -clipped.y());
+
+    SkRecords::Draw draw(&canvas,
+                         drawables ? drawables->begin() : nullptr,
+                         nullptr,
+                         drawables ? drawables->count() : 0);
+    ReplayState replayState(&canvas, &draw);
+    for (int op : ops) {
+        if (op < fResolvedOps) {
+            fRecord->visit(op, replayState);
+        } else {
+            fRecord->visit(op, draw);
+        }
+    }
+}
+
+SkCanvas* SkSurface_TiledRaster::onGetPixelsCanvas() {
+    this->resolve();
+    if (!fPixelsCanvas) {
+        fPixelsCanvas = std::make_unique<SkCanvas>(fBitmap, this->props());
+    }
+    return fPixelsCanvas.get();
+}
+
+void SkSurface_TiledRaster::onDraw(SkCanvas* canvas, SkScalar x, SkScalar y,
+                                   const SkSamplingOptions& sampling, const SkPaint* paint) {
+    this->resolve();
+    canvas->drawImage(fBitmap.asImage().get(), x, y, sampling, paint);
+}
+
+sk_sp<SkImage> SkSurface_TiledRaster::onNewImageSnapshot(const SkIRect* subset) {
+    this->resolve();
+    if (subset) {
+        SkASSERT(SkIRect::MakeWH(fBitmap.width(), fBitmap.height()).contains(*subset));
+        SkBitmap dst;
+        dst.allocPixels(fBitmap.info().makeDimensions(subset->size()));
+        SkAssertResult(fBitmap.readPixels(dst.pixmap(), subset->left(), subset->top()));
+        dst.setImmutable();
+        return dst.asImage();
+    }
+
+    // As with SkSurface_Raster, the snapshot shares our pixels until the next draw.
+    if (SkPixelRef* pr = fBitmap.pixelRef()) {
+        pr->setTemporarilyImmutable();
+    }
+    return SkMakeImageFromRasterBitmap(fBitmap, kIfMutable_SkCopyPixelsMode);
+}
+
+void SkSurface_TiledRaster::onWritePixels(const SkPixmap& src, int x, int y) {
+    this->resolve();
+    fBitmap.writePixels(src, x, y);
+}
+
+void SkSurface_TiledRaster::onRestoreBackingMutability() {
+    SkASSERT(!this->hasCachedImage());
+    if (SkPixelRef* pr = fBitmap.pixelRef()) {
+        pr->restoreMutability();
+    }
+}
+
+bool SkSurface_TiledRaster::onCopyOnWrite(ContentChangeMode mode) {
+    sk_sp<SkImage> cached(this->refCachedImage());
+    SkASSERT(cached);
+    if (SkBitmapImageGetPixelRef(cached.get()) == fBitmap.pixelRef()) {
+        SkBitmap prev(fBitmap);
+        if (!fBitmap.tryAllocPixels()) {
+            return false;
+        }
+        if (kRetain_ContentChangeMode == mode) {
+            SkASSERT(prev.info() == fBitmap.info());
+            SkASSERT(prev.rowBytes() == fBitmap.rowBytes());
+            memcpy(fBitmap.getPixels(), prev.getPixels(), fBitmap.computeByteSize());
+        }
+        // Our recorder never touches fBitmap, only the pixels canvas needs to follow it.
+        fPixelsCanvas.reset();
+    }
+    return true;
+}
+
+sk_sp<const SkCapabilities> SkSurface_TiledRaster::onCapabilities() {
+    return SkCapabilities::RasterBackend();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+sk_sp<SkSurface> SkSurface::MakeRasterTiled(const SkImageInfo& info, SkExecutor* executor,
+                                            SkISize tileSize, const SkSurfaceProps* props) {
+    if (!SkSurfaceValidateRasterInfo(info) || tileSize.isEmpty()) {
+        return nullptr;
+    }
+
+    sk_sp<SkPixelRef> pr = SkMallocPixelRef::MakeAllocate(info, 0);
+    if (!pr) {
+        return nullptr;
+    }
+    return sk_make_sp<SkSurface_TiledRaster>(info, std::move(pr), executor, tileSize, props);
+}
@@ -31,6 +31,7 @@ namespace SkOpts {
         gray_to_RGB1          = SK_OPTS_NS::gray_to_RGB1;
         grayA_to_RGBA         = SK_OPTS_NS::grayA_to_RGBA;
         grayA_to_rgbA         = SK_OPTS_NS::grayA_to_rgbA;
+        RGBA16_to_RGBA        = SK_OPTS_NS::RGBA16_to_RGBA;
         inverted_CMYK_to_RGB1 = SK_OPTS_NS::inverted_CMYK_to_RGB1;
         inverted_CMYK_to_BGR1 = SK_OPTS_NS::inverted_CMYK_to_BGR1;
 
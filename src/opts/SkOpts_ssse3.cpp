@@ -25,6 +25,7 @@ namespace SkOpts {
         gray_to_RGB1          = ssse3::gray_to_RGB1;
         grayA_to_RGBA         = ssse3::grayA_to_RGBA;
         grayA_to_rgbA         = ssse3::grayA_to_rgbA;
+        RGBA16_to_RGBA        = ssse3::RGBA16_to_RGBA;
         inverted_CMYK_to_RGB1 = ssse3::inverted_CMYK_to_RGB1;
         inverted_CMYK_to_BGR1 = ssse3::inverted_CMYK_to_BGR1;
 
@@ -1384,6 +1384,88 @@ static void RGB_to_BGR1_portable(uint32_t dst[], const uint8_t* src, int count)
     }
 #endif
 
+// PNG stores 16-bit components big-endian, so the first byte of each holds its top 8 bits.
+static void RGBA16_to_RGBA_portable(uint32_t dst[], const uint8_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = (uint32_t)src[6] << 24
+               | (uint32_t)src[4] << 16
+               | (uint32_t)src[2] <<  8
+               | (uint32_t)src[0] <<  0;
+        src += 8;
+    }
+}
+#if defined(SK_ARM_HAS_NEON)
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        while (count >= 4) {
+            // Load 4 pixels, splitting the high and low bytes of each component.
+            uint8x16x2_t hilo = vld2q_u8(src);
+
+            // Store 4 pixels.
+            vst1q_u8((uint8_t*) dst, hilo.val[0]);
+            src += 32;
+            dst += 4;
+            count -= 4;
+        }
+        RGBA16_to_RGBA_portable(dst, src, count);
+    }
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SKX
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        while (count >= 8) {
+            // Read as little-endian 16-bit lanes, the byte we want is the low one,
+            // which is exactly what truncating each lane to 8 bits keeps.
+            __m512i rgba = _mm512_loadu_si512((const __m512i*) src);
+            _mm256_storeu_si256((__m256i*) dst, _mm512_cvtepi16_epi8(rgba));
+            src += 64;
+            dst += 8;
+            count -= 8;
+        }
+        RGBA16_to_RGBA_portable(dst, src, count);
+    }
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        const __m256i lowBytes = _mm256_set1_epi16(0x00FF);
+        while (count >= 8) {
+            __m256i lo = _mm256_loadu_si256((const __m256i*) (src +  0)),
+                    hi = _mm256_loadu_si256((const __m256i*) (src + 32));
+
+            // Keep the most significant byte of each big-endian component, then pack them down.
+            // _mm256_packus_epi16() works within 128-bit lanes, leaving the pixels in the order
+            // 0 1 4 5 | 2 3 6 7, so swap the middle two pairs back.
+            __m256i rgba = _mm256_packus_epi16(_mm256_and_si256(lo, lowBytes),
+                                               _mm256_and_si256(hi, lowBytes));
+            rgba = _mm256_permute4x64_epi64(rgba, 0xD8);
+
+            _mm256_storeu_si256((__m256i*) dst, rgba);
+            src += 64;
+            dst += 8;
+            count -= 8;
+        }
+        RGBA16_to_RGBA_portable(dst, src, count);
+    }
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSSE3
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+        while (count >= 4) {
+            __m128i lo = _mm_loadu_si128((const __m128i*) (src +  0)),
+                    hi = _mm_loadu_si128((const __m128i*) (src + 16));
+
+            // Keep the most significant byte of each big-endian component, then pack them down.
+            __m128i rgba = _mm_packus_epi16(_mm_and_si128(lo, lowBytes),
+                                            _mm_and_si128(hi, lowBytes));
+
+            _mm_storeu_si128((__m128i*) dst, rgba);
+            src += 32;
+            dst += 4;
+            count -= 4;
+        }
+        RGBA16_to_RGBA_portable(dst, src, count);
+    }
+#else
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        RGBA16_to_RGBA_portable(dst, src, count);
+    }
+#endif
+
 }  // namespace SK_OPTS_NS
 
 #endif // SkSwizzler_opts_DEFINED
@@ -608,7 +608,15 @@ void SkPDFDocument::onClose(SkWStream* stream) {
     }
 }
 
-void SkPDFDocument::incrementJobCount() { fJobCount++; }
+void SkPDFDocument::incrementJobCount() {
+    // Every queued job holds on to its content until it runs. Once enough are queued, wait for
+    // some to finish, so memory stays bounded however long the document is.
+    while (fJobCount >= kMaxJobsInFlight) {
+        fSemaphore.wait();
+        --fJobCount;
+    }
+    fJobCount++;
+}
 
 void SkPDFDocument::signalJobComplete() { fSemaphore.signal(); }
 
@@ -133,6 +133,8 @@ public:
     SkString nextFontSubsetTag();
 
     SkExecutor* executor() const { return fExecutor; }
+    // Call before adding a job to executor(). This may wait for earlier jobs to finish, so it
+    // must not be called from a job.
     void incrementJobCount();
     void signalJobComplete();
     size_t currentPageIndex() { return fPages.size(); }
@@ -166,6 +168,7 @@ private:
 
     sk_sp<SkPDFDevice> fPageDevice;
     std::atomic<int> fNextObjectNumber = {1};
+    static constexpr int kMaxJobsInFlight = 64;
     std::atomic<int> fJobCount = {0};
     uint32_t fNextFontSubsetTag = {0};
     SkUUID fUUID;
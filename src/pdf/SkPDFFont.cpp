@@ -7,6 +7,7 @@
 
 #include "include/core/SkBitmap.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkFontMetrics.h"
 #include "include/core/SkFontTypes.h"
@@ -294,6 +295,52 @@ static sk_sp<SkData> stream_to_data(std::unique_ptr<SkStreamAsset> stream) {
     return SkData::MakeFromStream(stream.get(), size);
 }
 
+static void serialize_subset_font_file(const SkPDFFont& font,
+                                       const SkAdvancedTypefaceMetrics& metrics,
+                                       std::unique_ptr<SkStreamAsset> fontAsset,
+                                       int ttcIndex,
+                                       SkPDFDocument* doc,
+                                       SkPDFIndirectReference ref) {
+    sk_sp<SkData> fontData = stream_to_data(std::move(fontAsset));
+    sk_sp<SkData> subsetFontData = SkPDFSubsetFont(fontData, font.glyphUsage(),
+                                                   doc->metadata().fSubsetter,
+                                                   metrics.fFontName.c_str(), ttcIndex);
+    // If subsetting fails, fall back to original font data.
+    if (!subsetFontData) {
+        subsetFontData = std::move(fontData);
+    }
+    std::unique_ptr<SkPDFDict> tmp = SkPDFMakeDict();
+    tmp->insertInt("Length1", SkToInt(subsetFontData->size()));
+    SkPDFSerializeStream(std::move(tmp), SkMemoryStream::Make(std::move(subsetFontData)),
+                         doc, true, ref);
+}
+
+// Subsetting is the slowest part of emitting a font, so with an executor each font is subset
+// there, while the document goes on to emit the next font.
+static SkPDFIndirectReference emit_subset_font_file(const SkPDFFont& font,
+                                                    const SkAdvancedTypefaceMetrics& metrics,
+                                                    std::unique_ptr<SkStreamAsset> fontAsset,
+                                                    int ttcIndex,
+                                                    SkPDFDocument* doc) {
+    SkPDFIndirectReference ref = doc->reserveRef();
+    if (SkExecutor* executor = doc->executor()) {
+        // The font and its metrics are owned by the document, which waits for this job.
+        const SkPDFFont* fontPtr = &font;
+        const SkAdvancedTypefaceMetrics* metricsPtr = &metrics;
+        SkStreamAsset* fontAssetPtr = fontAsset.release();
+        doc->incrementJobCount();
+        executor->add([fontPtr, metricsPtr, fontAssetPtr, ttcIndex, doc, ref]() {
+            serialize_subset_font_file(*fontPtr, *metricsPtr,
+                                       std::unique_ptr<SkStreamAsset>(fontAssetPtr), ttcIndex,
+                                       doc, ref);
+            doc->signalJobComplete();
+        });
+        return ref;
+    }
+    serialize_subset_font_file(font, metrics, std::move(fontAsset), ttcIndex, doc, ref);
+    return ref;
+}
+
 static void emit_subset_type0(const SkPDFFont& font, SkPDFDocument* doc) {
     const SkAdvancedTypefaceMetrics* metricsPtr =
         SkPDFFont::GetMetrics(font.typeface(), doc);
@@ -322,25 +369,11 @@ static void emit_subset_type0(const SkPDFFont& font, SkPDFDocument* doc) {
                 if (!SkToBool(metrics.fFlags &
                               SkAdvancedTypefaceMetrics::kNotSubsettable_FontFlag)) {
                     SkASSERT(font.firstGlyphID() == 1);
-                    sk_sp<SkData> subsetFontData = SkPDFSubsetFont(
-                            stream_to_data(std::move(fontAsset)), font.glyphUsage(),
-                            doc->metadata().fSubsetter,
-                            metrics.fFontName.c_str(), ttcIndex);
-                    if (subsetFontData) {
-                        std::unique_ptr<SkPDFDict> tmp = SkPDFMakeDict();
-                        tmp->insertInt("Length1", SkToInt(subsetFontData->size()));
-                        descriptor->insertRef(
-                                "FontFile2",
-                                SkPDFStreamOut(std::move(tmp),
-                                               SkMemoryStream::Make(std::move(subsetFontData)),
-                                               doc, true));
-                        break;
-                    }
-                    // If subsetting fails, fall back to original font data.
-                    fontAsset = face->openStream(&ttcIndex);
-                    SkASSERT(fontAsset);
-                    SkASSERT(fontAsset->getLength() == fontSize);
-                    if (!fontAsset || fontAsset->getLength() == 0) { break; }
+                    descriptor->insertRef(
+                            "FontFile2",
+                            emit_subset_font_file(font, metrics, std::move(fontAsset), ttcIndex,
+                                                  doc));
+                    break;
                 }
                 std::unique_ptr<SkPDFDict> tmp = SkPDFMakeDict();
                 tmp->insertInt("Length1", fontSize);
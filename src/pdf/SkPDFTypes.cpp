@@ -597,3 +597,11 @@ SkPDFIndirectReference SkPDFStreamOut(std::unique_ptr<SkPDFDict> dict,
     serialize_stream(dict.get(), content.get(), deflate, doc, ref);
     return ref;
 }
+
+void SkPDFSerializeStream(std::unique_ptr<SkPDFDict> dict,
+                          std::unique_ptr<SkStreamAsset> content,
+                          SkPDFDocument* doc,
+                          bool deflate,
+                          SkPDFIndirectReference ref) {
+    serialize_stream(dict.get(), content.get(), deflate, doc, ref);
+}
@@ -209,4 +209,12 @@ SkPDFIndirectReference SkPDFStreamOut(std::unique_ptr<SkPDFDict> dict,
                                       std::unique_ptr<SkStreamAsset> stream,
                                       SkPDFDocument* doc,
                                       bool deflate = kSkPDFDefaultDoDeflate);
+
+// Like SkPDFStreamOut, but serializes into an already reserved reference on the calling thread.
+// For work that is already running on the document's executor.
+void SkPDFSerializeStream(std::unique_ptr<SkPDFDict> dict,
+                          std::unique_ptr<SkStreamAsset> stream,
+                          SkPDFDocument* doc,
+                          bool deflate,
+                          SkPDFIndirectReference ref);
 #endif
@@ -16,43 +16,31 @@ namespace SkSL {
 
 void BuiltinMap::insertOrDie(std::string key, std::unique_ptr<ProgramElement> element) {
     SkASSERT(!fElements.find(key));
-    fElements.set(std::move(key), BuiltinElement{std::move(element), /*fAlreadyIncluded=*/false});
+    fElements.set(std::move(key), std::move(element));
 }
 
-const ProgramElement* BuiltinMap::find(const std::string& key) {
-    BuiltinElement* elem = fElements.find(key);
+const ProgramElement* BuiltinMap::find(const std::string& key) const {
+    const std::unique_ptr<ProgramElement>* elem = fElements.find(key);
     if (!elem) {
         return fParent ? fParent->find(key) : nullptr;
     }
-    return elem->fElement.get();
+    return elem->get();
 }
 
-// Only returns a builtin element that isn't already marked as included, and then marks it.
-const ProgramElement* BuiltinMap::findAndInclude(const std::string& key) {
-    BuiltinElement* elem = fElements.find(key);
-    if (!elem) {
-        return fParent ? fParent->findAndInclude(key) : nullptr;
-    }
-    if (elem->fAlreadyIncluded) {
+const ProgramElement* BuiltinMap::findAndInclude(const std::string& key,
+                                                 IncludedSet* alreadyIncluded) const {
+    const ProgramElement* elem = this->find(key);
+    if (!elem || alreadyIncluded->contains(elem)) {
         return nullptr;
     }
-    elem->fAlreadyIncluded = true;
-    return elem->fElement.get();
-}
-
-void BuiltinMap::resetAlreadyIncluded() {
-    fElements.foreach([](const std::string&, BuiltinElement* elem) {
-        elem->fAlreadyIncluded = false;
-    });
-    if (fParent) {
-        fParent->resetAlreadyIncluded();
-    }
+    alreadyIncluded->add(elem);
+    return elem;
 }
 
 void BuiltinMap::foreach(
         const std::function<void(const std::string&, const ProgramElement&)>& fn) const {
-    fElements.foreach([&](const std::string& name, const BuiltinElement& elem) {
-        fn(name, *elem.fElement);
+    fElements.foreach([&](const std::string& name, const std::unique_ptr<ProgramElement>& elem) {
+        fn(name, *elem);
     });
     if (fParent) {
         fParent->foreach(fn);
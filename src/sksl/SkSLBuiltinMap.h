@@ -18,30 +18,28 @@
 namespace SkSL {
 
 /**
- * Represents the builtin elements in the Context.
+ * Represents the builtin elements in the Context. Once a module has been loaded, its map is never
+ * modified, so it can be shared by compilations running on different threads.
  */
 class BuiltinMap {
 public:
-    BuiltinMap(BuiltinMap* parent) : fParent(parent) {}
+    using IncludedSet = SkTHashSet<const ProgramElement*>;
 
-    void insertOrDie(std::string key, std::unique_ptr<ProgramElement> element);
+    BuiltinMap(const BuiltinMap* parent) : fParent(parent) {}
 
-    const ProgramElement* find(const std::string& key);
+    void insertOrDie(std::string key, std::unique_ptr<ProgramElement> element);
 
-    const ProgramElement* findAndInclude(const std::string& key);
+    const ProgramElement* find(const std::string& key) const;
 
-    void resetAlreadyIncluded();
+    // Only returns a builtin element that isn't already in `alreadyIncluded`, and then adds it.
+    const ProgramElement* findAndInclude(const std::string& key,
+                                         IncludedSet* alreadyIncluded) const;
 
     void foreach(const std::function<void(const std::string&, const ProgramElement&)>& fn) const;
 
 private:
-    struct BuiltinElement {
-        std::unique_ptr<ProgramElement> fElement;
-        bool fAlreadyIncluded = false;
-    };
-
-    SkTHashMap<std::string, BuiltinElement> fElements;
-    BuiltinMap* fParent = nullptr;
+    SkTHashMap<std::string, std::unique_ptr<ProgramElement>> fElements;
+    const BuiltinMap* fParent = nullptr;
 };
 
 } // namespace SkSL
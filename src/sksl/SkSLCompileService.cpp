@@ -0,0 +1,77 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/sksl/SkSLCompileService.h"
+
+#ifdef SK_ENABLE_SKSL
+
+#include "include/core/SkExecutor.h"
+#include "src/core/SkTaskGroup.h"
+#include "src/core/SkTraceEvent.h"
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/ir/SkSLProgram.h"
+
+#include <utility>
+
+namespace SkSL {
+
+CompileService::CompileService(const ShaderCaps* caps, SkExecutor* executor)
+        : fCaps(caps)
+        , fExecutor(executor) {
+    SkASSERT(caps);
+}
+
+CompileService::~CompileService() = default;
+
+Compiler* CompileService::acquireCompiler() {
+    SkAutoMutexExclusive lock(fMutex);
+    if (fIdleCompilers.empty()) {
+        // Creating a compiler is cheap, since the modules are shared, so there's one per task that
+        // has ever run at the same time as another.
+        fCompilers.push_back(std::make_unique<Compiler>(fCaps));
+        return fCompilers.back().get();
+    }
+    Compiler* compiler = fIdleCompilers.back();
+    fIdleCompilers.pop_back();
+    return compiler;
+}
+
+void CompileService::releaseCompiler(Compiler* compiler) {
+    SkAutoMutexExclusive lock(fMutex);
+    fIdleCompilers.push_back(compiler);
+}
+
+void CompileService::forEach(int count, const std::function<void(Compiler&, int)>& fn) {
+    SkTaskGroup tasks(fExecutor ? *fExecutor : SkExecutor::GetDefault());
+    tasks.batch(count, [&](int i) {
+        Compiler* compiler = this->acquireCompiler();
+        fn(*compiler, i);
+        this->releaseCompiler(compiler);
+    });
+    tasks.wait();
+}
+
+std::vector<CompileService::Result> CompileService::convertPrograms(
+        SkSpan<const Request> requests) {
+    TRACE_EVENT1("skia.shaders", "SkSL::CompileService::convertPrograms",
+                 "count", requests.size());
+
+    std::vector<Result> results(requests.size());
+    this->forEach(SkToInt(requests.size()), [&](Compiler& compiler, int i) {
+        const Request& request = requests[i];
+        results[i].fProgram = compiler.convertProgram(request.fKind, request.fText,
+                                                      request.fSettings);
+        if (!results[i].fProgram) {
+            results[i].fErrors = compiler.errorText();
+        }
+    });
+    return results;
+}
+
+}  // namespace SkSL
+
+#endif  // SK_ENABLE_SKSL
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SKSL_COMPILESERVICE
+#define SKSL_COMPILESERVICE
+
+#include "include/core/SkTypes.h"
+
+#ifdef SK_ENABLE_SKSL
+
+#include "include/core/SkSpan.h"
+#include "include/private/SkMutex.h"
+#include "include/private/SkSLProgramKind.h"
+#include "src/sksl/SkSLProgramSettings.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class SkExecutor;
+
+namespace SkSL {
+
+class Compiler;
+struct Program;
+struct ShaderCaps;
+
+/**
+ * Compiles batches of programs concurrently on an SkExecutor. Each task borrows one of the
+ * service's compilers for as long as it runs, and all of them share the same built-in modules, so
+ * the modules are loaded once no matter how many threads are compiling.
+ *
+ * Programs refer to the compiler that created them, so they must not outlive the service.
+ */
+class CompileService {
+public:
+    /** If executor is null, the tasks run on SkExecutor::GetDefault(). */
+    CompileService(const ShaderCaps* caps, SkExecutor* executor = nullptr);
+    ~CompileService();
+
+    CompileService(const CompileService&) = delete;
+    CompileService& operator=(const CompileService&) = delete;
+
+    struct Request {
+        ProgramKind       fKind;
+        std::string       fText;
+        ProgramSettings   fSettings;
+    };
+
+    struct Result {
+        std::unique_ptr<Program> fProgram;  // Null if the program failed to compile.
+        std::string              fErrors;
+    };
+
+    /** Compiles every request, and returns the results in the same order. */
+    std::vector<Result> convertPrograms(SkSpan<const Request> requests);
+
+    /**
+     * Calls fn(compiler, i) for every i in [0, count), spread across the executor, and waits for
+     * them all to finish. No two calls use the same compiler at the same time, so fn can convert
+     * programs and generate code for them.
+     */
+    void forEach(int count, const std::function<void(Compiler&, int)>& fn);
+
+private:
+    Compiler* acquireCompiler();
+    void releaseCompiler(Compiler*);
+
+    const ShaderCaps* fCaps;
+    SkExecutor*       fExecutor;
+
+    SkMutex fMutex;
+    std::vector<std::unique_ptr<Compiler>> fCompilers SK_GUARDED_BY(fMutex);
+    std::vector<Compiler*>                 fIdleCompilers SK_GUARDED_BY(fMutex);
+};
+
+}  // namespace SkSL
+
+#endif  // SK_ENABLE_SKSL
+
+#endif
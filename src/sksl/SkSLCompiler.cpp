@@ -7,10 +7,13 @@
 
 #include "src/sksl/SkSLCompiler.h"
 
+#include "include/private/SkMutex.h"
+#include "include/private/SkOpts_spi.h"
 #include "include/private/SkSLLayout.h"
 #include "include/private/SkSLModifiers.h"
 #include "include/private/SkSLStatement.h"
 #include "include/private/SkSLSymbol.h"
+#include "include/private/SkTHash.h"
 #include "include/sksl/DSLCore.h"
 #include "include/sksl/DSLModifiers.h"
 #include "include/sksl/DSLType.h"
@@ -40,6 +43,7 @@
 #include "src/sksl/ir/SkSLFunctionDefinition.h"
 #include "src/sksl/ir/SkSLFunctionReference.h"
 #include "src/sksl/ir/SkSLInterfaceBlock.h"
+#include "src/sksl/ir/SkSLSetting.h"
 #include "src/sksl/ir/SkSLSymbolTable.h"
 #include "src/sksl/ir/SkSLType.h"
 #include "src/sksl/ir/SkSLTypeReference.h"
@@ -149,13 +153,63 @@ public:
     Context* fContext;
 };
 
+// Holds the built-in modules for one combination of sk_Caps settings. They are loaded on demand by
+// a Compiler which belongs to the SharedModules, while holding fMutex. Once a module is loaded it
+// is never modified, and neither it nor the SharedModules is ever freed (unless it was made for
+// MakeWithUnsharedModules), so any Compiler can use it on any thread.
+struct Compiler::SharedModules {
+    SharedModules(const ShaderCaps& caps) : fCaps(caps) {
+        fLoader.reset(new Compiler(&fCaps, this));
+        fRootModule.fSymbols = fLoader->makeRootSymbolTable();
+        fPrivateModule.fSymbols = fLoader->makePrivateSymbolTable(fRootModule.fSymbols);
+    }
+
+    static SharedModules* Get(const ShaderCaps* caps) {
+        SkASSERT(caps);
+        static SkMutex& mutex = *(new SkMutex);
+        static auto& modules = *(new SkTHashMap<uint32_t, SharedModules*>);
+
+        SkAutoMutexExclusive lock(mutex);
+        const uint32_t key = Setting::CapsMask(*caps);
+        if (SharedModules** found = modules.find(key)) {
+            return *found;
+        }
+        return *modules.set(key, new SharedModules(*caps));
+    }
+
+    SkMutex fMutex;
+    const ShaderCaps fCaps;
+    std::unique_ptr<Compiler> fLoader;
+
+    ParsedModule fRootModule;                // Core types
+
+    ParsedModule fPrivateModule;             // [Root] + Internal types
+    ParsedModule fGPUModule;                 // [Private] + GPU intrinsics, helper functions
+    ParsedModule fVertexModule;              // [GPU] + Vertex stage decls
+    ParsedModule fFragmentModule;            // [GPU] + Fragment stage decls
+    ParsedModule fComputeModule;             // [GPU] + Compute stage decls
+    ParsedModule fGraphiteVertexModule;      // [Vert] + Graphite vertex helpers
+    ParsedModule fGraphiteFragmentModule;    // [Frag] + Graphite fragment helpers
+
+    ParsedModule fPublicModule;              // [Root] + Public features
+    ParsedModule fRuntimeShaderModule;       // [Public] + Runtime shader decls
+};
+
 Compiler::Compiler(const ShaderCaps* caps)
+        : Compiler(caps, SharedModules::Get(caps)) {}
+
+Compiler::Compiler(const ShaderCaps* caps, SharedModules* modules)
         : fErrorReporter(this)
         , fContext(std::make_shared<Context>(fErrorReporter, *caps, fMangler))
-        , fInliner(fContext.get()) {
+        , fModules(modules)
+        , fInliner(fContext.get()) {}
+
+std::unique_ptr<Compiler> Compiler::MakeWithUnsharedModules(const ShaderCaps* caps) {
     SkASSERT(caps);
-    fRootModule.fSymbols = this->makeRootSymbolTable();
-    fPrivateModule.fSymbols = this->makePrivateSymbolTable(fRootModule.fSymbols);
+    auto modules = std::make_unique<SharedModules>(*caps);
+    std::unique_ptr<Compiler> compiler(new Compiler(caps, modules.get()));
+    compiler->fUnsharedModules = std::move(modules);
+    return compiler;
 }
 
 Compiler::~Compiler() {}
@@ -246,44 +300,49 @@ std::shared_ptr<SymbolTable> Compiler::makePrivateSymbolTable(std::shared_ptr<Sy
 }
 
 const ParsedModule& Compiler::loadGPUModule() {
-    if (!fGPUModule.fSymbols) {
-        fGPUModule = this->parseModule(ProgramKind::kFragment, MODULE_DATA(gpu), fPrivateModule);
+    ParsedModule& module = fModules->fGPUModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kFragment, MODULE_DATA(gpu),
+                                   fModules->fPrivateModule);
     }
-    return fGPUModule;
+    return module;
 }
 
 const ParsedModule& Compiler::loadFragmentModule() {
-    if (!fFragmentModule.fSymbols) {
-        fFragmentModule = this->parseModule(ProgramKind::kFragment, MODULE_DATA(frag),
-                                            this->loadGPUModule());
+    ParsedModule& module = fModules->fFragmentModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kFragment, MODULE_DATA(frag),
+                                   this->loadGPUModule());
     }
-    return fFragmentModule;
+    return module;
 }
 
 const ParsedModule& Compiler::loadVertexModule() {
-    if (!fVertexModule.fSymbols) {
-        fVertexModule = this->parseModule(ProgramKind::kVertex, MODULE_DATA(vert),
-                                          this->loadGPUModule());
+    ParsedModule& module = fModules->fVertexModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kVertex, MODULE_DATA(vert),
+                                   this->loadGPUModule());
     }
-    return fVertexModule;
+    return module;
 }
 
 const ParsedModule& Compiler::loadComputeModule() {
-    if (!fComputeModule.fSymbols) {
-        fComputeModule = this->parseModule(ProgramKind::kCompute, MODULE_DATA(compute),
-                                           this->loadGPUModule());
+    ParsedModule& module = fModules->fComputeModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kCompute, MODULE_DATA(compute),
+                                   this->loadGPUModule());
     }
-    return fComputeModule;
+    return module;
 }
 
 const ParsedModule& Compiler::loadGraphiteFragmentModule() {
 #if defined(SK_GRAPHITE_ENABLED)
-    if (!fGraphiteFragmentModule.fSymbols) {
-        fGraphiteFragmentModule = this->parseModule(ProgramKind::kGraphiteFragment,
-                                                    MODULE_DATA(graphite_frag),
-                                                    this->loadFragmentModule());
+    ParsedModule& module = fModules->fGraphiteFragmentModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kGraphiteFragment, MODULE_DATA(graphite_frag),
+                                   this->loadFragmentModule());
     }
-    return fGraphiteFragmentModule;
+    return module;
 #else
     return this->loadFragmentModule();
 #endif
@@ -291,12 +350,12 @@ const ParsedModule& Compiler::loadGraphiteFragmentModule() {
 
 const ParsedModule& Compiler::loadGraphiteVertexModule() {
 #if defined(SK_GRAPHITE_ENABLED)
-    if (!fGraphiteVertexModule.fSymbols) {
-        fGraphiteVertexModule = this->parseModule(ProgramKind::kGraphiteVertex,
-                                                  MODULE_DATA(graphite_vert),
-                                                  this->loadVertexModule());
+    ParsedModule& module = fModules->fGraphiteVertexModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kGraphiteVertex, MODULE_DATA(graphite_vert),
+                                   this->loadVertexModule());
     }
-    return fGraphiteVertexModule;
+    return module;
 #else
     return this->loadVertexModule();
 #endif
@@ -344,22 +403,45 @@ std::shared_ptr<SymbolTable> Compiler::makeGLSLRootSymbolTable() const {
 }
 
 const ParsedModule& Compiler::loadPublicModule() {
-    if (!fPublicModule.fSymbols) {
-        fPublicModule = this->parseModule(ProgramKind::kGeneric, MODULE_DATA(public), fRootModule);
-        add_glsl_type_aliases(fPublicModule.fSymbols.get(), fContext->fTypes);
+    ParsedModule& module = fModules->fPublicModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kGeneric, MODULE_DATA(public),
+                                   fModules->fRootModule);
+        add_glsl_type_aliases(module.fSymbols.get(), fContext->fTypes);
     }
-    return fPublicModule;
+    return module;
 }
 
 const ParsedModule& Compiler::loadPrivateRTShaderModule() {
-    if (!fRuntimeShaderModule.fSymbols) {
-        fRuntimeShaderModule = this->parseModule(
-                ProgramKind::kRuntimeShader, MODULE_DATA(rt_shader), this->loadPublicModule());
+    ParsedModule& module = fModules->fRuntimeShaderModule;
+    if (!module.fSymbols) {
+        module = this->parseModule(ProgramKind::kRuntimeShader, MODULE_DATA(rt_shader),
+                                   this->loadPublicModule());
     }
-    return fRuntimeShaderModule;
+    return module;
+}
+
+uint32_t Compiler::RuntimeEffectModuleHash() {
+#if REHYDRATE
+    static const uint32_t hash = [] {
+        uint32_t h = SkOpts::hash_fn(SKSL_INCLUDE_sksl_public,
+                                     SKSL_INCLUDE_sksl_public_LENGTH, 0);
+        return SkOpts::hash_fn(SKSL_INCLUDE_sksl_rt_shader,
+                               SKSL_INCLUDE_sksl_rt_shader_LENGTH, h);
+    }();
+    return hash;
+#else
+    // Standalone builds parse the modules from text files instead, and never rehydrate programs.
+    return 0;
+#endif
 }
 
 const ParsedModule& Compiler::moduleForProgramKind(ProgramKind kind) {
+    SkAutoMutexExclusive lock(fModules->fMutex);
+    return fModules->fLoader->loadModuleForProgramKind(kind);
+}
+
+const ParsedModule& Compiler::loadModuleForProgramKind(ProgramKind kind) {
     switch (kind) {
         case ProgramKind::kVertex:               return this->loadVertexModule();           break;
         case ProgramKind::kFragment:             return this->loadFragmentModule();         break;
@@ -388,7 +470,7 @@ LoadedModule Compiler::loadModule(ProgramKind kind,
         // contain the union of all known types, so this is safe. If we ever have types that only
         // exist in 'Public' (for example), this logic needs to be smarter (by choosing the correct
         // base for the module we're compiling).
-        base = fPrivateModule.fSymbols;
+        base = fModules->fPrivateModule.fSymbols;
     }
     SkASSERT(base);
 
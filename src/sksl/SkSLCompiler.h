@@ -127,6 +127,12 @@ public:
 
     Compiler(const ShaderCaps* caps);
 
+    /**
+     * Creates a Compiler that loads its own copy of the built-in modules, instead of sharing them
+     * with the other Compilers. This is only useful for measuring what the modules cost.
+     */
+    static std::unique_ptr<Compiler> MakeWithUnsharedModules(const ShaderCaps* caps);
+
     ~Compiler();
 
     Compiler(const Compiler&) = delete;
@@ -220,9 +226,27 @@ public:
                             bool dehydrate);
     ParsedModule parseModule(ProgramKind kind, ModuleData data, const ParsedModule& base);
 
+    /**
+     * Returns the built-in module that programs of the given kind are compiled against, loading it
+     * if necessary. Modules are shared by every Compiler whose caps fold the same sk_Caps settings
+     * into the module IR (see Setting::CapsMask). Once loaded they are never modified, so this is
+     * safe to call from Compilers on different threads.
+     */
     const ParsedModule& moduleForProgramKind(ProgramKind kind);
 
+    /**
+     * Returns a hash of the built-in module data that runtime effects are compiled against.
+     * Dehydrated runtime effect programs refer to those modules' symbols, so they can only be
+     * rehydrated against the same data.
+     */
+    static uint32_t RuntimeEffectModuleHash();
+
 private:
+    struct SharedModules;
+
+    // Used by SharedModules to create the Compiler which loads its modules.
+    Compiler(const ShaderCaps* caps, SharedModules* modules);
+
     class CompilerErrorReporter : public ErrorReporter {
     public:
         CompilerErrorReporter(Compiler* compiler)
@@ -236,6 +260,7 @@ private:
         Compiler& fCompiler;
     };
 
+    const ParsedModule& loadModuleForProgramKind(ProgramKind kind);
     const ParsedModule& loadComputeModule();
     const ParsedModule& loadGPUModule();
     const ParsedModule& loadFragmentModule();
@@ -266,21 +291,14 @@ private:
                     std::shared_ptr<SymbolTable> symbols,
                     ProgramUsage* usage);
 
+    // Set by MakeWithUnsharedModules. Declared first, so the modules outlive everything else.
+    std::unique_ptr<SharedModules> fUnsharedModules;
+
     CompilerErrorReporter fErrorReporter;
     std::shared_ptr<Context> fContext;
 
-    ParsedModule fRootModule;                // Core types
-
-    ParsedModule fPrivateModule;             // [Root] + Internal types
-    ParsedModule fGPUModule;                 // [Private] + GPU intrinsics, helper functions
-    ParsedModule fVertexModule;              // [GPU] + Vertex stage decls
-    ParsedModule fFragmentModule;            // [GPU] + Fragment stage decls
-    ParsedModule fComputeModule;             // [GPU] + Compute stage decls
-    ParsedModule fGraphiteVertexModule;      // [Vert] + Graphite vertex helpers
-    ParsedModule fGraphiteFragmentModule;    // [Frag] + Graphite fragment helpers
-
-    ParsedModule fPublicModule;              // [Root] + Public features
-    ParsedModule fRuntimeShaderModule;       // [Public] + Runtime shader decls
+    // The built-in modules, shared with every other Compiler that has compatible caps.
+    SharedModules* fModules;
 
     // holds ModifiersPools belonging to the core includes for lifetime purposes
     ModifiersPool fCoreModifiers;
@@ -14,8 +14,14 @@
 
 namespace SkSL {
 
+static const BuiltinTypes& shared_builtin_types() {
+    static const BuiltinTypes* sTypes = new BuiltinTypes;
+    return *sTypes;
+}
+
 Context::Context(ErrorReporter& errors, const ShaderCaps& caps, Mangler& mangler)
-        : fCaps(caps)
+        : fTypes(shared_builtin_types())
+        , fCaps(caps)
         , fErrors(&errors)
         , fMangler(&mangler) {
     SkASSERT(!Pool::IsAttached());
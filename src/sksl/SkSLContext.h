@@ -27,8 +27,9 @@ public:
     Context(ErrorReporter& errors, const ShaderCaps& caps, Mangler& mangler);
     ~Context();
 
-    // The Context holds all of the built-in types.
-    BuiltinTypes fTypes;
+    // The Context holds a reference to the built-in types. These are immutable, and shared by every
+    // Context in the process, so IR built by one compiler can be used by another.
+    const BuiltinTypes& fTypes;
 
     // The Context holds a reference to our shader caps bits.
     const ShaderCaps& fCaps;
@@ -46,7 +47,7 @@ public:
     Mangler* fMangler = nullptr;
 
     // Symbols which have definitions in the include files.
-    BuiltinMap* fBuiltins = nullptr;
+    const BuiltinMap* fBuiltins = nullptr;
 };
 
 }  // namespace SkSL
@@ -21,6 +21,7 @@
 #include "src/sksl/SkSLRehydrator.h"
 #include "src/sksl/ir/SkSLBinaryExpression.h"
 #include "src/sksl/ir/SkSLBlock.h"
+#include "src/sksl/ir/SkSLChildCall.h"
 #include "src/sksl/ir/SkSLConstructorArray.h"
 #include "src/sksl/ir/SkSLConstructorArrayCast.h"
 #include "src/sksl/ir/SkSLConstructorCompound.h"
@@ -142,7 +143,7 @@ void Dehydrator::write(std::string s) {
     if (found == fStrings.end()) {
         offset = fStringBuffer.bytesWritten() + HEADER_SIZE;
         fStrings.insert({ s, offset });
-        SkASSERT(s.length() <= 255);
+        fValid &= s.length() <= 255;
         fStringBreaks.add(fStringBuffer.bytesWritten());
         fStringBuffer.write8(s.length());
         fStringBuffer.writeString(s);
@@ -294,9 +295,14 @@ void Dehydrator::write(const Expression* e) {
                 this->write(b.right().get());
                 break;
             }
-            case Expression::Kind::kChildCall:
-                SkDEBUGFAIL("unimplemented--not expected to be used from within an include file");
+            case Expression::Kind::kChildCall: {
+                const ChildCall& c = e->as<ChildCall>();
+                this->writeCommand(Rehydrator::kChildCall_Command);
+                this->write(c.type());
+                this->writeId(&c.child());
+                this->writeExpressionSpan(SkSpan(c.arguments()));
                 break;
+            }
 
             case Expression::Kind::kConstructorArray:
                 this->writeCommand(Rehydrator::kConstructorArray_Command);
@@ -656,6 +662,7 @@ void Dehydrator::finish(OutputStream& out) {
     out.write16(Rehydrator::kVersion);
     std::string stringBuffer = fStringBuffer.str();
     std::string commandBuffer = fBody.str();
+    fValid &= SkTFitsIn<uint16_t>(stringBuffer.size());
     out.write16(fStringBuffer.str().size());
     fStringBufferStart = 4;
     out.writeString(stringBuffer);
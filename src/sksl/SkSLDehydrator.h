@@ -58,12 +58,16 @@ public:
 
     void finish(OutputStream& out);
 
+    // Returns false if anything written so far didn't fit in the binary format (for instance, a
+    // block with more than 255 statements). The output of finish() is unusable if so.
+    bool isValid() const { return fValid; }
+
     // Inserts line breaks at meaningful offsets.
     const char* prefixAtOffset(size_t byte);
 
 private:
     void writeS8(int32_t i) {
-        SkASSERT(SkTFitsIn<int8_t>(i));
+        fValid &= SkTFitsIn<int8_t>(i);
         fBody.write8(i);
     }
 
@@ -73,33 +77,34 @@ private:
     }
 
     void writeU8(int32_t i) {
-        SkASSERT(SkTFitsIn<uint8_t>(i));
+        fValid &= SkTFitsIn<uint8_t>(i);
         fBody.write8(i);
     }
 
     void writeS16(int32_t i) {
-        SkASSERT(SkTFitsIn<int16_t>(i));
+        fValid &= SkTFitsIn<int16_t>(i);
         fBody.write16(i);
     }
 
     void writeU16(int32_t i) {
-        SkASSERT(SkTFitsIn<uint16_t>(i));
+        fValid &= SkTFitsIn<uint16_t>(i);
         fBody.write16(i);
     }
 
     void writeS32(int64_t i) {
-        SkASSERT(SkTFitsIn<int32_t>(i));
+        fValid &= SkTFitsIn<int32_t>(i);
         fBody.write32(i);
     }
 
     void writeU32(int64_t i) {
-        SkASSERT(SkTFitsIn<uint32_t>(i));
+        fValid &= SkTFitsIn<uint32_t>(i);
         fBody.write32(i);
     }
 
     void allocSymbolId(const Symbol* s) {
         SkASSERT(!symbolId(s));
         fSymbolMap.back()[s] = fNextId++;
+        fValid &= fNextId != 0;
     }
 
     void writeId(const Symbol* s);
@@ -134,6 +139,8 @@ private:
 
     uint16_t fNextId = 1;
 
+    bool fValid = true;
+
     StringStream fStringBuffer;
 
     StringStream fBody;
@@ -27,6 +27,7 @@
 #include "src/sksl/ir/SkSLBinaryExpression.h"
 #include "src/sksl/ir/SkSLBlock.h"
 #include "src/sksl/ir/SkSLBreakStatement.h"
+#include "src/sksl/ir/SkSLChildCall.h"
 #include "src/sksl/ir/SkSLConstructorArray.h"
 #include "src/sksl/ir/SkSLConstructorArrayCast.h"
 #include "src/sksl/ir/SkSLConstructorCompound.h"
@@ -278,14 +279,18 @@ const Type* Rehydrator::type() {
 }
 
 std::unique_ptr<Program> Rehydrator::program() {
-    [[maybe_unused]] uint8_t command = this->readU8();
-    SkASSERT(command == kProgram_Command);
+    if (this->readU8() != kProgram_Command) {
+        return nullptr;
+    }
 
     // Initialize the temporary config used to generate the complete program. We explicitly avoid
     // enforcing ES2 restrictions when rehydrating a program, which we assume to be already
     // well-formed when dehydrated.
     auto config = std::make_unique<ProgramConfig>();
     config->fKind = (ProgramKind)this->readU8();
+    if (config->fKind < ProgramKind::kFragment || config->fKind > ProgramKind::kGeneric) {
+        return nullptr;
+    }
     config->fRequiredSkSLVersion = (SkSL::Version)this->readU8();
     config->fSettings.fMaxVersionAllowed = SkSL::Version::k300;
 
@@ -499,6 +504,12 @@ std::unique_ptr<Expression> Rehydrator::expression() {
             bool value = this->readU8();
             return Literal::MakeBool(this->context(), pos, value);
         }
+        case Rehydrator::kChildCall_Command: {
+            const Type* type = this->type();
+            const Variable* child = this->symbolRef<Variable>();
+            ExpressionArray args = this->expressionArray();
+            return ChildCall::Make(this->context(), pos, type, *child, std::move(args));
+        }
         case Rehydrator::kConstructorArray_Command: {
             const Type* type = this->type();
             return ConstructorArray::Make(this->context(), pos, *type, this->expressionArray());
@@ -645,7 +656,7 @@ std::shared_ptr<SymbolTable> Rehydrator::symbolTable() {
     SkASSERT(command == kSymbolTable_Command);
     bool builtin = this->readU8();
     uint16_t ownedCount = this->readU16();
-    fSymbolTable = std::make_shared<SymbolTable>(std::move(fSymbolTable), builtin);
+    fSymbolTable = std::make_shared<SymbolTable>(std::move(fSymbolTable), this->context(), builtin);
     std::vector<const Symbol*> ownedSymbols;
     ownedSymbols.reserve(ownedCount);
     for (int i = 0; i < ownedCount; ++i) {
@@ -41,7 +41,7 @@ struct Program;
  */
 class Rehydrator {
 public:
-    static constexpr uint16_t kVersion = 12;
+    static constexpr uint16_t kVersion = 13;
 
     // see binary_format.md for a description of the command data
     enum Command {
@@ -79,7 +79,7 @@ public:
         kGlobalVar_Command,
         kIf_Command,
         kIndex_Command,
-        kUnused_Command,  // was kInlineMarker_Command
+        kChildCall_Command,  // reuses the slot of the retired kInlineMarker_Command
         kInterfaceBlock_Command,
         kIntLiteral_Command,
         kLayout_Command,
@@ -120,7 +120,7 @@ public:
     // Reads a collection of program elements and returns it
     std::vector<std::unique_ptr<ProgramElement>> elements();
 
-    // Reads an entire program.
+    // Reads an entire program. Returns null if the data doesn't hold a program of a known kind.
     //
     // NOTE: The program is initialized using a new ProgramConfig that may differ from the one that
     // was assigned to the context of the Compiler this Rehydrator was constructed with.
@@ -15,17 +15,18 @@
 #include <memory>
 
 namespace SkSL {
-struct SharedCompiler::Impl {
-    Impl() {
+
+static const ShaderCaps* shared_compiler_caps() {
+    static const ShaderCaps* sCaps = [] {
         // These caps are configured to apply *no* workarounds. This avoids changes that are
         // unnecessary (GLSL intrinsic rewrites), or possibly even incorrect.
         // We may apply other "neutral" transformations to the user's SkSL, including inlining.
         // Anything determined by the device caps is deferred to the GPU backend. The processor
         // set produces the final program (including our re-emitted SkSL), and the backend's
         // compiler resolves any necessary workarounds.
-        fCaps = ShaderCapsFactory::Standalone();
-        fCaps->fBuiltinFMASupport = true;
-        fCaps->fBuiltinDeterminantSupport = true;
+        std::unique_ptr<ShaderCaps> caps = ShaderCapsFactory::Standalone();
+        caps->fBuiltinFMASupport = true;
+        caps->fBuiltinDeterminantSupport = true;
 
         // SkSL created by the GPU backend is typically parsed, converted to a backend format,
         // and the IR is immediately discarded. In that situation, it makes sense to use node
@@ -33,26 +34,48 @@ struct SharedCompiler::Impl {
         // long-lived (especially those created internally for runtime FPs). In this situation,
         // we're willing to pay for a slightly longer compile so that we don't waste huge
         // amounts of memory.
-        fCaps->fUseNodePools = false;
+        caps->fUseNodePools = false;
+        return caps.release();
+    }();
+    return sCaps;
+}
 
-        fCompiler = new SkSL::Compiler(fCaps.get());
-    }
+// Programs keep pointers into the compiler that created them, so the pooled compilers are never
+// freed. The pool only grows to the number of threads that have compiled at the same time.
+struct SharedCompiler::Impl {
+    Impl() : fCompiler(shared_compiler_caps()) {}
 
-    std::unique_ptr<SkSL::ShaderCaps> fCaps;
-    SkSL::Compiler*                   fCompiler;
+    SkSL::Compiler fCompiler;
+    Impl*          fNext = nullptr;
 };
 
-SharedCompiler::Impl* SharedCompiler::gImpl = nullptr;
+SharedCompiler::Impl* SharedCompiler::gFreeList = nullptr;
 
-SharedCompiler::SharedCompiler() : fLock(compiler_mutex()) {
-    if (!gImpl) {
-        gImpl = new Impl();
+SharedCompiler::SharedCompiler() {
+    {
+        SkAutoMutexExclusive lock(pool_mutex());
+        fImpl = gFreeList;
+        if (fImpl) {
+            gFreeList = fImpl->fNext;
+            fImpl->fNext = nullptr;
+        }
     }
+    if (!fImpl) {
+        fImpl = new Impl();
+    }
+}
+
+SharedCompiler::~SharedCompiler() {
+    SkAutoMutexExclusive lock(pool_mutex());
+    fImpl->fNext = gFreeList;
+    gFreeList = fImpl;
 }
 
-SkSL::Compiler* SharedCompiler::operator->() const { return gImpl->fCompiler; }
+SkSL::Compiler* SharedCompiler::operator->() const { return &fImpl->fCompiler; }
+
+SkSL::Compiler& SharedCompiler::operator*() const { return fImpl->fCompiler; }
 
-SkMutex& SharedCompiler::compiler_mutex() {
+SkMutex& SharedCompiler::pool_mutex() {
     static SkMutex& mutex = *(new SkMutex);
     return mutex;
 }
@@ -18,20 +18,28 @@ namespace SkSL {
 
 class Compiler;
 
-/** A shared compiler instance for runtime client SkSL that is internally guarded by a mutex. */
+/**
+ * A compiler instance for runtime client SkSL. Each SharedCompiler borrows a compiler from a pool
+ * for as long as it's in scope, so runtime effects can be compiled on several threads at once. The
+ * compilers all share the same built-in modules.
+ */
 class SharedCompiler {
 public:
     SharedCompiler();
+    ~SharedCompiler();
+
+    SharedCompiler(const SharedCompiler&) = delete;
+    SharedCompiler& operator=(const SharedCompiler&) = delete;
 
     SkSL::Compiler* operator->() const;
+    SkSL::Compiler& operator*() const;
 
 private:
-    SkAutoMutexExclusive fLock;
-
-    static SkMutex& compiler_mutex();
-
     struct Impl;
-    static Impl* gImpl;
+    Impl* fImpl;
+
+    static SkMutex& pool_mutex();
+    static Impl* gFreeList;
 };
 
 }  // namespace SkSL
@@ -18,7 +18,9 @@
 #include "src/sksl/ir/SkSLExternalFunction.h"
 #include "src/sksl/ir/SkSLSymbolTable.h"
 
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace SkSL {
 
@@ -47,9 +49,6 @@ ThreadContext::ThreadContext(SkSL::Compiler* compiler, SkSL::ProgramKind kind,
     fCompiler->fContext->fConfig = fConfig.get();
     fCompiler->fContext->fErrors = &fDefaultErrorReporter;
     fCompiler->fContext->fBuiltins = module.fElements.get();
-    if (fCompiler->fContext->fBuiltins) {
-        fCompiler->fContext->fBuiltins->resetAlreadyIncluded();
-    }
 
     fCompiler->fSymbolTable = module.fSymbols;
     this->setupSymbolTable();
@@ -73,7 +72,8 @@ ThreadContext::~ThreadContext() {
 
 void ThreadContext::setupSymbolTable() {
     SkSL::Context& context = *fCompiler->fContext;
-    SymbolTable::Push(&fCompiler->fSymbolTable, context.fConfig->fIsBuiltinCode);
+    fCompiler->fSymbolTable = std::make_shared<SkSL::SymbolTable>(
+            std::move(fCompiler->fSymbolTable), context, context.fConfig->fIsBuiltinCode);
 
     if (fSettings.fExternalFunctions) {
         // Add any external values to the new symbol table, so they're only visible to this Program.
@@ -11,6 +11,7 @@
 #include "include/core/SkTypes.h"
 #include "include/private/SkSLProgramKind.h"
 #include "include/sksl/SkSLErrorReporter.h"
+#include "src/sksl/SkSLBuiltinMap.h"
 #include "src/sksl/SkSLContext.h"
 #include "src/sksl/SkSLMangler.h"
 #include "src/sksl/SkSLProgramSettings.h"
@@ -85,6 +86,14 @@ public:
         return Instance().fSharedElements;
     }
 
+    /**
+     * Returns the builtin elements which have already been included in the current program. This
+     * is tracked here, rather than in the BuiltinMap, so that the modules stay immutable.
+     */
+    static BuiltinMap::IncludedSet& IncludedBuiltins() {
+        return Instance().fIncludedBuiltins;
+    }
+
     /**
      * Returns the current SymbolTable.
      */
@@ -170,6 +179,7 @@ private:
     SkSL::ModifiersPool* fOldModifiersPool;
     std::vector<std::unique_ptr<SkSL::ProgramElement>> fProgramElements;
     std::vector<const SkSL::ProgramElement*> fSharedElements;
+    BuiltinMap::IncludedSet fIncludedBuiltins;
     DefaultErrorReporter fDefaultErrorReporter;
     ErrorReporter& fOldErrorReporter;
     ProgramSettings fSettings;
@@ -107,6 +107,14 @@ void DSLFunction::define(DSLBlock block, Position pos) {
         block.release();
         return;
     }
+    if (fDecl->isBuiltin() && !ThreadContext::IsModule()) {
+        // Built-in modules are shared by every program, so a program can't attach its own
+        // definition to one of their declarations.
+        ThreadContext::ReportError(SkSL::String::printf("built-in function '%s' cannot be "
+                "redefined", fDecl->description().c_str()), pos);
+        block.release();
+        return;
+    }
     std::unique_ptr<FunctionDefinition> function = FunctionDefinition::Convert(
             ThreadContext::Context(),
             pos,
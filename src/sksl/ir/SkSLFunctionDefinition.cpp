@@ -108,8 +108,8 @@ std::unique_ptr<FunctionDefinition> FunctionDefinition::Convert(const Context& c
         }
 
         void copyBuiltinFunctionIfNeeded(const FunctionDeclaration& function) {
-            if (const ProgramElement* found =
-                        fContext.fBuiltins->findAndInclude(function.description())) {
+            if (const ProgramElement* found = fContext.fBuiltins->findAndInclude(
+                        function.description(), &ThreadContext::IncludedBuiltins())) {
                 const FunctionDefinition& original = found->as<FunctionDefinition>();
 
                 // Sort the referenced builtin functions into a consistent order; otherwise our
@@ -16,7 +16,7 @@
 #include "src/sksl/SkSLUtil.h"
 #include "src/sksl/ir/SkSLLiteral.h"
 
-#include <initializer_list>
+#include <iterator>
 
 namespace SkSL {
 
@@ -25,24 +25,38 @@ namespace {
 using CapsPtr = bool ShaderCaps::*;
 using CapsLookupTable = SkTHashMap<std::string_view, CapsPtr>;
 
+struct CapsSetting {
+    std::string_view fName;
+    CapsPtr          fPtr;
+};
+
+// The ShaderCaps members which can be referenced as `sk_Caps.<name>`.
+static constexpr CapsSetting kCapsSettings[] = {
+    {"mustDoOpBetweenFloorAndAbs",
+     &ShaderCaps::fMustDoOpBetweenFloorAndAbs},
+    {"mustGuardDivisionEvenAfterExplicitZeroCheck",
+     &ShaderCaps::fMustGuardDivisionEvenAfterExplicitZeroCheck},
+    {"atan2ImplementedAsAtanYOverX",
+     &ShaderCaps::fAtan2ImplementedAsAtanYOverX},
+    {"floatIs32Bits",
+     &ShaderCaps::fFloatIs32Bits},
+    {"integerSupport",
+     &ShaderCaps::fIntegerSupport},
+    {"builtinDeterminantSupport",
+     &ShaderCaps::fBuiltinDeterminantSupport},
+    {"rewriteMatrixVectorMultiply",
+     &ShaderCaps::fRewriteMatrixVectorMultiply},
+};
+
 static const CapsLookupTable& caps_lookup_table() {
     // Create a lookup table that converts strings into the equivalent ShaderCaps member-pointers.
-    static CapsLookupTable* sCapsLookupTable = new CapsLookupTable({
-        CapsLookupTable::Pair("mustDoOpBetweenFloorAndAbs",
-                              &ShaderCaps::fMustDoOpBetweenFloorAndAbs),
-        CapsLookupTable::Pair("mustGuardDivisionEvenAfterExplicitZeroCheck",
-                              &ShaderCaps::fMustGuardDivisionEvenAfterExplicitZeroCheck),
-        CapsLookupTable::Pair("atan2ImplementedAsAtanYOverX",
-                              &ShaderCaps::fAtan2ImplementedAsAtanYOverX),
-        CapsLookupTable::Pair("floatIs32Bits",
-                              &ShaderCaps::fFloatIs32Bits),
-        CapsLookupTable::Pair("integerSupport",
-                              &ShaderCaps::fIntegerSupport),
-        CapsLookupTable::Pair("builtinDeterminantSupport",
-                              &ShaderCaps::fBuiltinDeterminantSupport),
-        CapsLookupTable::Pair("rewriteMatrixVectorMultiply",
-                              &ShaderCaps::fRewriteMatrixVectorMultiply),
-    });
+    static CapsLookupTable* sCapsLookupTable = [] {
+        auto table = new CapsLookupTable;
+        for (const CapsSetting& setting : kCapsSettings) {
+            table->set(setting.fName, setting.fPtr);
+        }
+        return table;
+    }();
     return *sCapsLookupTable;
 }
 
@@ -67,4 +81,13 @@ std::unique_ptr<Expression> Setting::Convert(const Context& context, Position po
     return std::make_unique<Setting>(pos, name, context.fTypes.fBool.get());
 }
 
+uint32_t Setting::CapsMask(const ShaderCaps& caps) {
+    static_assert(std::size(kCapsSettings) <= 32);
+    uint32_t mask = 0;
+    for (size_t i = 0; i < std::size(kCapsSettings); ++i) {
+        mask |= uint32_t(caps.*kCapsSettings[i].fPtr) << i;
+    }
+    return mask;
+}
+
 }  // namespace SkSL
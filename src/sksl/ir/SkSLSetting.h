@@ -11,6 +11,7 @@
 #include "include/sksl/SkSLPosition.h"
 #include "src/sksl/ir/SkSLExpression.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -20,6 +21,7 @@ namespace SkSL {
 
 class Context;
 class Type;
+struct ShaderCaps;
 
 /**
  * Represents a compile-time constant setting, such as sk_Caps.integerSupport. These IRNodes should
@@ -41,6 +43,10 @@ public:
     static std::unique_ptr<Expression> Convert(const Context& context, Position pos,
                                                const std::string_view& name);
 
+    // Returns one bit for each capability flag that Convert can fold into the IR. Modules loaded
+    // with caps that have the same mask are identical, so they can be shared between compilers.
+    static uint32_t CapsMask(const ShaderCaps& caps);
+
     std::unique_ptr<Expression> clone(Position pos) const override {
         return std::make_unique<Setting>(pos, this->name(), &this->type());
     }
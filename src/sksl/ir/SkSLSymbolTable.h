@@ -46,6 +46,13 @@ public:
     , fBuiltin(builtin)
     , fContext(parent->fContext) {}
 
+    // Built-in modules are shared between compilers, so a program's symbol table is given the
+    // Context of the compiler that owns it, rather than the one that loaded its parent module.
+    SymbolTable(std::shared_ptr<SymbolTable> parent, const Context& context, bool builtin)
+    : fParent(parent)
+    , fBuiltin(builtin)
+    , fContext(context) {}
+
     /** Replaces the passed-in SymbolTable with a newly-created child symbol table. */
     static void Push(std::shared_ptr<SymbolTable>* table) {
         Push(table, (*table)->isBuiltin());
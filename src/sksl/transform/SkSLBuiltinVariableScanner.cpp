@@ -44,8 +44,9 @@ public:
     void addDeclaringElement(const std::string& name) {
         // If this is the *first* time we've seen this builtin, findAndInclude will return the
         // corresponding ProgramElement.
-        BuiltinMap& builtins = *fContext.fBuiltins;
-        if (const ProgramElement* decl = builtins.findAndInclude(name)) {
+        const BuiltinMap& builtins = *fContext.fBuiltins;
+        if (const ProgramElement* decl =
+                    builtins.findAndInclude(name, &ThreadContext::IncludedBuiltins())) {
             SkASSERT(decl->is<GlobalVarDeclaration>() || decl->is<InterfaceBlock>());
             fNewElements.push_back(decl);
         }
@@ -9,6 +9,7 @@
 
 #include "include/core/SkScalar.h"
 #include "include/private/SkMutex.h"
+#include "include/private/SkTemplates.h"
 #include "include/private/SkTo.h"
 #include "include/private/chromium/SkChromeRemoteGlyphCache.h"
 #include "src/core/SkDescriptor.h"
@@ -489,6 +490,15 @@ SkPMColor4f calculate_colors(skgpu::SurfaceContext* sc,
     return grPaint->getColor4f();
 }
 
+// Adds a mask op, first trying to fold it into the previous text op. Frames that draw many
+// small blobs with plain colors produce long runs of text ops that would merge anyway.
+void add_atlas_text_op(const GrClip* clip, GrOp::Owner op, skgpu::v1::SurfaceDrawContext* sdc) {
+    if (clip == nullptr && op->cast<AtlasTextOp>()->appendToLastOp(sdc)) {
+        return;
+    }
+    sdc->addDrawOp(clip, std::move(op));
+}
+
 SkMatrix position_matrix(const SkMatrix& drawMatrix, SkPoint drawOrigin) {
     SkMatrix position_matrix = drawMatrix;
     return position_matrix.preTranslate(drawOrigin.x(), drawOrigin.y());
@@ -1388,7 +1398,7 @@ void DirectMaskSubRun::draw(SkCanvas*,
     auto[drawingClip, op] = this->makeAtlasTextOp(
             clip, viewMatrix, drawOrigin, paint, std::move(subRunStorage), sdc);
     if (op != nullptr) {
-        sdc->addDrawOp(drawingClip, std::move(op));
+        add_atlas_text_op(drawingClip, std::move(op), sdc);
     }
 }
 
@@ -1882,7 +1892,7 @@ void TransformedMaskSubRun::draw(SkCanvas*,
     auto[drawingClip, op] = this->makeAtlasTextOp(
             clip, viewMatrix, drawOrigin, paint, std::move(subRunStorage), sdc);
     if (op != nullptr) {
-        sdc->addDrawOp(drawingClip, std::move(op));
+        add_atlas_text_op(drawingClip, std::move(op), sdc);
     }
 }
 
@@ -2346,6 +2356,18 @@ const AtlasSubRun* SDFTSubRun::testingOnly_atlasSubRun() const {
     return this;
 }
 
+// Rasterize the images of the accepted glyphs into the strike, so that regenerating the atlas
+// at flush time finds them already made.
+void prepare_glyph_images(SkStrike* strike, const SkZip<SkGlyphVariant, SkPoint>& accepted) {
+    if (strike == nullptr) { return; }
+    SkAutoSTArray<64, SkPackedGlyphID> glyphIDs(accepted.size());
+    SkAutoSTArray<64, const SkGlyph*> results(accepted.size());
+    for (auto [i, glyph] : SkMakeEnumerate(accepted.get<0>())) {
+        glyphIDs[i] = glyph.glyph()->getPackedID();
+    }
+    strike->prepareImages(SkSpan(glyphIDs.get(), glyphIDs.size()), results.get());
+}
+
 template<typename AddSingleMaskFormat>
 void add_multi_mask_format(
         AddSingleMaskFormat addSingleMaskFormat,
@@ -2564,6 +2586,10 @@ std::tuple<bool, SubRunContainerOwner> SubRunContainer::MakeInAlloc(
                     rejected->flipRejectsToSource();
 
                     if (creationBehavior == kAddSubRuns && !accepted->empty()) {
+                        if (strikeDeviceInfo.fPrepareGlyphImages) {
+                            prepare_glyph_images(strike->getUnderlyingStrike().get(),
+                                                 accepted->accepted());
+                        }
                         container->fSubRuns.append(SDFTSubRun::Make(
                                 accepted->accepted(),
                                 runFont,
@@ -2597,6 +2623,10 @@ std::tuple<bool, SubRunContainerOwner> SubRunContainer::MakeInAlloc(
                 rejected->flipRejectsToSource();
 
                 if (creationBehavior == kAddSubRuns && !accepted->empty()) {
+                    if (strikeDeviceInfo.fPrepareGlyphImages) {
+                        prepare_glyph_images(strike->getUnderlyingStrike().get(),
+                                             accepted->accepted());
+                    }
                     auto addGlyphsWithSameFormat =
                             [&](const SkZip<SkGlyphVariant, SkPoint>& acceptedGlyphsAndLocations,
                                 MaskFormat format,
@@ -2778,6 +2808,10 @@ std::tuple<bool, SubRunContainerOwner> SubRunContainer::MakeInAlloc(
                 SkASSERT(rejected->source().empty());
 
                 if (creationBehavior == kAddSubRuns && !accepted->empty()) {
+                    if (strikeDeviceInfo.fPrepareGlyphImages) {
+                        prepare_glyph_images(strike->getUnderlyingStrike().get(),
+                                             accepted->accepted());
+                    }
                     auto addGlyphsWithSameFormat =
                             [&](const SkZip<SkGlyphVariant, SkPoint>& acceptedGlyphsAndLocations,
                                 MaskFormat format,
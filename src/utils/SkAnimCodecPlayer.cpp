@@ -21,7 +21,9 @@
 #include "include/core/SkSamplingOptions.h"
 #include "include/core/SkSize.h"
 #include "include/core/SkTypes.h"
+#include "include/private/SkTo.h"
 #include "src/codec/SkCodecImageGenerator.h"
+#include "src/core/SkTaskGroup.h"
 
 #include <algorithm>
 #include <cstddef>
@@ -51,7 +53,12 @@ SkAnimCodecPlayer::SkAnimCodecPlayer(std::unique_ptr<SkCodec> codec) : fCodec(st
     }
 }
 
-SkAnimCodecPlayer::~SkAnimCodecPlayer() {}
+SkAnimCodecPlayer::~SkAnimCodecPlayer() {
+    // Pending decode-ahead tasks use this player.
+    if (fDecodeAheadTasks) {
+        fDecodeAheadTasks->wait();
+    }
+}
 
 SkISize SkAnimCodecPlayer::dimensions() const {
     if (!fCodec) {
@@ -64,13 +71,9 @@ SkISize SkAnimCodecPlayer::dimensions() const {
     return { fImageInfo.width(), fImageInfo.height() };
 }
 
-sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
+sk_sp<SkImage> SkAnimCodecPlayer::decodeFrame(int index, const sk_sp<SkImage>& prior) {
     SkASSERT((unsigned)index < fFrameInfos.size());
 
-    if (fImages[index]) {
-        return fImages[index];
-    }
-
     size_t rb = fImageInfo.minRowBytes();
     size_t size = fImageInfo.computeByteSize(rb);
     auto data = SkData::MakeUninitialized(size);
@@ -90,9 +93,8 @@ sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
     if (fFrameInfos[index].fAlphaType != kOpaque_SkAlphaType && imageInfo.isOpaque()) {
         imageInfo = imageInfo.makeAlphaType(kPremul_SkAlphaType);
     }
-    const int requiredFrame = fFrameInfos[index].fRequiredFrame;
-    if (requiredFrame != SkCodec::kNoFrame && fImages[requiredFrame]) {
-        auto requiredImage = fImages[requiredFrame];
+    if (prior) {
+        SkASSERT(fFrameInfos[index].fRequiredFrame != SkCodec::kNoFrame);
         auto canvas = SkCanvas::MakeRasterDirect(imageInfo, data->writable_data(), rb);
         if (origin != kDefault_SkEncodedOrigin) {
             // The required frame is stored after applying the origin. Undo that,
@@ -106,8 +108,8 @@ sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
             SkAssertResult(originMatrix.invert(&inverse));
             canvas->concat(inverse);
         }
-        canvas->drawImage(requiredImage, 0, 0, SkSamplingOptions(), &paint);
-        opts.fPriorFrame = requiredFrame;
+        canvas->drawImage(prior, 0, 0, SkSamplingOptions(), &paint);
+        opts.fPriorFrame = fFrameInfos[index].fRequiredFrame;
     }
 
     if (SkCodec::kSuccess != fCodec->getPixels(imageInfo, data->writable_data(), rb, &opts)) {
@@ -125,7 +127,168 @@ sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
         canvas->drawImage(image, 0, 0, SkSamplingOptions(), &paint);
         image = SkImage::MakeRasterData(imageInfo, std::move(data), rb);
     }
-    return fImages[index] = image;
+    return image;
+}
+
+sk_sp<SkImage> SkAnimCodecPlayer::decodeFrameChain(int index) {
+    // Frames are decoded on top of the frame they require. Walk the chain of required frames
+    // back to the closest one which is either cached or independent, and decode forward from it.
+    std::vector<int> chain;
+    sk_sp<SkImage> image;
+    {
+        SkAutoMutexExclusive cacheLock(fCacheMutex);
+        for (int i = index; i != SkCodec::kNoFrame; i = fFrameInfos[i].fRequiredFrame) {
+            if (fImages[i]) {
+                image = fImages[i];
+                break;
+            }
+            chain.push_back(i);
+        }
+    }
+
+    for (auto i = chain.rbegin(); i != chain.rend(); ++i) {
+        image = this->decodeFrame(*i, image);
+        if (!image) {
+            return nullptr;
+        }
+
+        SkAutoMutexExclusive cacheLock(fCacheMutex);
+        this->cacheFrame(*i, image);
+    }
+
+    return image;
+}
+
+sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
+    SkASSERT((unsigned)index < fFrameInfos.size());
+
+    {
+        SkAutoMutexExclusive cacheLock(fCacheMutex);
+        if (fImages[index]) {
+            return fImages[index];
+        }
+    }
+
+    SkAutoMutexExclusive codecLock(fCodecMutex);
+    return this->decodeFrameChain(index);
+}
+
+void SkAnimCodecPlayer::cacheFrame(int index, sk_sp<SkImage> image) {
+    SkASSERT(!fImages[index]);
+
+    fCachedBytes += image->imageInfo().computeMinByteSize();
+    fImages[index] = std::move(image);
+
+    this->purge();
+}
+
+void SkAnimCodecPlayer::purge() {
+    while (fCachedBytes > fMemoryBudget) {
+        // Drop the frame which is needed last when playing forward from the current frame.
+        int victim = -1;
+        for (int i = 0; i < (int)fImages.size(); ++i) {
+            if (fImages[i] && i != fCurrIndex &&
+                (victim < 0 || this->distanceFromCurrent(i) > this->distanceFromCurrent(victim))) {
+                victim = i;
+            }
+        }
+        if (victim < 0) {
+            break;
+        }
+
+        fCachedBytes -= fImages[victim]->imageInfo().computeMinByteSize();
+        fImages[victim].reset();
+    }
+}
+
+int SkAnimCodecPlayer::distanceFromCurrent(int index) const {
+    const int count = (int)fFrameInfos.size();
+    return (index - fCurrIndex + count) % count;
+}
+
+void SkAnimCodecPlayer::decodeAhead() {
+    // Allow seek() to schedule another pass, which will see its new current frame.
+    fDecodeAheadScheduled = false;
+
+    const int count = (int)fFrameInfos.size();
+    const size_t frameBytes = fImageInfo.computeMinByteSize();
+
+    // Decode one frame at a time, such that getFrame() doesn't wait on more than one decode.
+    for (;;) {
+        SkAutoMutexExclusive codecLock(fCodecMutex);
+
+        int next = -1;
+        {
+            SkAutoMutexExclusive cacheLock(fCacheMutex);
+            for (int ahead = 1; ahead <= std::min(fDecodeAheadFrames, count - 1); ++ahead) {
+                const int index = (fCurrIndex + ahead) % count;
+                if (fImages[index]) {
+                    continue;
+                }
+
+                // Over budget, this frame could only stay cached by dropping a later one.
+                if (fCachedBytes + frameBytes > fMemoryBudget) {
+                    bool canEvict = false;
+                    for (int i = 0; i < count && !canEvict; ++i) {
+                        canEvict = fImages[i] && i != fCurrIndex &&
+                                   this->distanceFromCurrent(i) > ahead;
+                    }
+                    if (!canEvict) {
+                        return;
+                    }
+                }
+
+                next = index;
+                break;
+            }
+        }
+
+        if (next < 0 || !this->decodeFrameChain(next)) {
+            return;
+        }
+
+        // Bail if the frame didn't fit after all, rather than decoding it over and over.
+        SkAutoMutexExclusive cacheLock(fCacheMutex);
+        if (!fImages[next]) {
+            return;
+        }
+    }
+}
+
+void SkAnimCodecPlayer::setMemoryBudget(size_t bytes) {
+    SkAutoMutexExclusive cacheLock(fCacheMutex);
+    fMemoryBudget = bytes;
+    this->purge();
+}
+
+void SkAnimCodecPlayer::setDecodeAhead(SkExecutor* executor, int frames) {
+    if (fDecodeAheadTasks) {
+        fDecodeAheadTasks->wait();
+        fDecodeAheadTasks.reset();
+    }
+
+    // Single frame images are decoded lazily, by SkImage.
+    if (!fTotalDuration || !executor || frames <= 0) {
+        fDecodeAheadFrames = 0;
+        return;
+    }
+
+    fDecodeAheadFrames = frames;
+    fDecodeAheadTasks = std::make_unique<SkTaskGroup>(*executor);
+}
+
+bool SkAnimCodecPlayer::isFrameReady() const {
+    if (!fTotalDuration) {
+        return true;
+    }
+
+    SkAutoMutexExclusive cacheLock(fCacheMutex);
+    return SkToBool(fImages[fCurrIndex]);
+}
+
+size_t SkAnimCodecPlayer::cachedBytes() const {
+    SkAutoMutexExclusive cacheLock(fCacheMutex);
+    return fCachedBytes;
 }
 
 sk_sp<SkImage> SkAnimCodecPlayer::getFrame() {
@@ -147,9 +310,21 @@ bool SkAnimCodecPlayer::seek(uint32_t msec) {
                                   [](const SkCodec::FrameInfo& info, uint32_t msec) {
                                       return (uint32_t)info.fDuration <= msec;
                                   });
-    int prevIndex = fCurrIndex;
-    fCurrIndex = lower - fFrameInfos.begin();
-    return fCurrIndex != prevIndex;
+    const int index = lower - fFrameInfos.begin();
+    if (index == fCurrIndex) {
+        return false;
+    }
+
+    {
+        SkAutoMutexExclusive cacheLock(fCacheMutex);
+        fCurrIndex = index;
+    }
+
+    if (fDecodeAheadTasks && !fDecodeAheadScheduled.exchange(true)) {
+        fDecodeAheadTasks->add([this] { this->decodeAhead(); });
+    }
+
+    return true;
 }
 
 
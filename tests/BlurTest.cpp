@@ -11,6 +11,7 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkColorPriv.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkMaskFilter.h"
 #include "include/core/SkMath.h"
@@ -26,11 +27,13 @@
 #include "include/core/SkSize.h"
 #include "include/core/SkSurface.h"
 #include "include/core/SkTypes.h"
+#include "include/effects/SkImageFilters.h"
 #include "include/effects/SkPerlinNoiseShader.h"
 #include "include/gpu/GrDirectContext.h"
 #include "include/private/SkFloatBits.h"
 #include "include/private/SkTPin.h"
 #include "src/core/SkBlurMask.h"
+#include "src/core/SkBlurPriv.h"
 #include "src/core/SkGpuBlurUtils.h"
 #include "src/core/SkMask.h"
 #include "src/core/SkMaskFilterBase.h"
@@ -580,3 +583,62 @@ DEF_TEST(zero_blur, reporter) {
     SkIPoint offset;
     bitmap.extractAlpha(&alpha, &paint, nullptr, &offset);
 }
+
+DEF_TEST(BlurThreadedMatchesSerial, reporter) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+
+    // A mask and an image big enough to be blurred on an executor. The executor is handed to the
+    // blurs through SkScopedBlurExecutor, which only affects this thread, so tests running in
+    // parallel never see it and it is gone before |executor| is destroyed.
+    constexpr int kW = 400, kH = 300;
+
+    SkMask src;
+    src.fBounds   = SkIRect::MakeWH(kW, kH);
+    src.fRowBytes = kW;
+    src.fFormat   = SkMask::kA8_Format;
+    src.fImage    = SkMask::AllocImage(src.computeImageSize());
+    SkAutoMaskFreeImage srcImage(src.fImage);
+    for (int y = 0; y < kH; ++y) {
+        for (int x = 0; x < kW; ++x) {
+            src.fImage[y * kW + x] = ((x / 16 + y / 16) & 1) ? (x ^ y) & 0xFF : 0;
+        }
+    }
+
+    auto blurMask = [&](SkExecutor* blurExecutor, SkMask* dst) {
+        SkScopedBlurExecutor scoped(blurExecutor);
+        SkIPoint margin;
+        SkAssertResult(SkBlurMask::BoxBlur(dst, src, 20, kNormal_SkBlurStyle, &margin));
+    };
+
+    SkMask serial, threaded;
+    blurMask(nullptr, &serial);
+    blurMask(executor.get(), &threaded);
+    SkAutoMaskFreeImage serialImage(serial.fImage), threadedImage(threaded.fImage);
+    REPORTER_ASSERT(reporter, serial.fBounds == threaded.fBounds);
+    REPORTER_ASSERT(reporter, serial.fRowBytes == threaded.fRowBytes);
+    REPORTER_ASSERT(reporter, !memcmp(serial.fImage, threaded.fImage, serial.computeImageSize()));
+
+    auto blurImage = [&](SkExecutor* blurExecutor) {
+        SkScopedBlurExecutor scoped(blurExecutor);
+        SkBitmap bm;
+        bm.allocN32Pixels(kW, kH);
+        SkCanvas canvas(bm);
+        canvas.clear(SK_ColorWHITE);
+
+        SkPaint paint;
+        paint.setImageFilter(SkImageFilters::Blur(15, 25, nullptr));
+        canvas.saveLayer(nullptr, &paint);
+        for (int i = 0; i < 10; ++i) {
+            SkPaint circle;
+            circle.setColor(SkColorSetARGB(0xFF, 25 * i, 255 - 25 * i, 0x80));
+            canvas.drawCircle(40.0f * i, 30.0f * i, 30, circle);
+        }
+        canvas.restore();
+        return bm;
+    };
+
+    SkBitmap serialBM   = blurImage(nullptr),
+             threadedBM = blurImage(executor.get());
+    REPORTER_ASSERT(reporter, !memcmp(serialBM.getPixels(), threadedBM.getPixels(),
+                                      serialBM.computeByteSize()));
+}
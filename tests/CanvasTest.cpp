@@ -765,3 +765,61 @@ DEF_TEST(canvas_savelayer_destructor, reporter) {
     do_test(2, 0);
     check_pixels(SK_ColorRED);
 }
+
+// The raster backend draws runs of image set entries sharing an image with one blitter. That
+// should look the same as drawing each entry with drawImageRect().
+DEF_TEST(Canvas_EdgeAAImageSet_Raster, reporter) {
+    SkBitmap atlas;
+    atlas.allocN32Pixels(16, 16);
+    atlas.eraseColor(SK_ColorRED);
+    atlas.erase(SK_ColorGREEN, SkIRect::MakeLTRB(8, 0, 16, 8));
+    atlas.erase(SK_ColorBLUE,  SkIRect::MakeLTRB(0, 8,  8, 16));
+    sk_sp<SkImage> image = atlas.asImage();
+
+    SkCanvas::ImageSetEntry set[4];
+    for (int i = 0; i < 4; ++i) {
+        set[i].fImage   = image;
+        set[i].fSrcRect = SkRect::MakeXYWH((i % 2) * 8, (i / 2) * 8, 8, 8);
+        set[i].fDstRect = SkRect::MakeXYWH(i * 12, i * 10, 16, 16);  // Overlapping, scaled 2x
+        set[i].fAlpha   = i == 2 ? 0.5f : 1.0f;
+    }
+    const SkMatrix preView = SkMatrix::Translate(3, 5);
+    set[3].fMatrixIndex = 0;
+
+    SkBitmap batched, expected;
+    batched .allocN32Pixels(64, 64);
+    expected.allocN32Pixels(64, 64);
+    batched .eraseColor(SK_ColorTRANSPARENT);
+    expected.eraseColor(SK_ColorTRANSPARENT);
+
+    SkPaint paint;
+    paint.setAlphaf(0.75f);
+    SkCanvas(batched).experimental_DrawEdgeAAImageSet(set, 4, nullptr, &preView,
+                                                      SkSamplingOptions(), &paint,
+                                                      SkCanvas::kStrict_SrcRectConstraint);
+    SkCanvas canvas(expected);
+    for (int i = 0; i < 4; ++i) {
+        SkPaint entryPaint(paint);
+        entryPaint.setAlphaf(paint.getAlphaf() * set[i].fAlpha);
+        SkAutoCanvasRestore acr(&canvas, true);
+        if (set[i].fMatrixIndex >= 0) {
+            canvas.concat(preView);
+        }
+        canvas.drawImageRect(image, set[i].fSrcRect, set[i].fDstRect, SkSamplingOptions(),
+                             &entryPaint, SkCanvas::kStrict_SrcRectConstraint);
+    }
+
+    // Allow for rounding differences between pipelines.
+    for (int y = 0; y < 64; ++y)
+    for (int x = 0; x < 64; ++x) {
+        SkColor a = batched.getColor(x, y),
+                b = expected.getColor(x, y);
+        for (int shift : {0, 8, 16, 24}) {
+            int diff = (int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF);
+            if (diff < -1 || diff > 1) {
+                ERRORF(reporter, "(%d, %d): 0x%08x != 0x%08x", x, y, a, b);
+                return;
+            }
+        }
+    }
+}
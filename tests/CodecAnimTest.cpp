@@ -10,6 +10,7 @@
 #include "include/codec/SkCodecAnimation.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRect.h"
@@ -609,3 +610,52 @@ DEF_TEST(AnimCodecPlayer, r) {
                         "Mismatched size for frame at 500 ms of %s", test.fFile);
     }
 }
+
+DEF_TEST(AnimCodecPlayer_budget, r) {
+    for (const char* file : { "images/required.gif",
+                              "images/required.webp",
+                              "images/alphabetAnim.gif",
+                              "images/stoplight.webp" }) {
+        auto data = GetResourceAsData(file);
+        if (!data) {
+            continue;
+        }
+
+        // Every frame stays cached by default.
+        SkAnimCodecPlayer reference(SkCodec::MakeFromData(data));
+        std::vector<sk_sp<SkImage>> expected;
+        std::vector<uint32_t> starts;
+        uint32_t msec = 0;
+        for (const auto& info : SkCodec::MakeFromData(data)->getFrameInfo()) {
+            reference.seek(msec);
+            expected.push_back(reference.getFrame());
+            REPORTER_ASSERT(r, expected.back());
+            starts.push_back(msec);
+            msec += info.fDuration;
+        }
+        const size_t frameBytes = expected[0]->imageInfo().computeMinByteSize();
+
+        auto executor = SkExecutor::MakeFIFOThreadPool(1);
+        for (bool decodeAhead : { false, true }) {
+            // Keeps at most two frames, which requires decoding some of the frames they depend on
+            // again when looping.
+            SkAnimCodecPlayer player(SkCodec::MakeFromData(data));
+            player.setMemoryBudget(2 * frameBytes);
+            if (decodeAhead) {
+                player.setDecodeAhead(executor.get(), 1);
+            }
+
+            for (int loop = 0; loop < 2; ++loop) {
+                for (size_t i = 0; i < expected.size(); ++i) {
+                    player.seek(starts[i]);
+                    auto frame = player.getFrame();
+                    REPORTER_ASSERT(r, player.isFrameReady());
+                    REPORTER_ASSERT(r, frame && ToolUtils::equal_pixels(frame.get(),
+                                                                        expected[i].get()),
+                                    "%s: mismatched frame %zu", file, i);
+                    REPORTER_ASSERT(r, player.cachedBytes() <= 2 * frameBytes);
+                }
+            }
+        }
+    }
+}
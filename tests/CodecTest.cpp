@@ -19,6 +19,7 @@
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkData.h"
 #include "include/core/SkEncodedImageFormat.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageEncoder.h"
 #include "include/core/SkImageGenerator.h"
@@ -1921,3 +1922,55 @@ DEF_TEST(Codec_noConversion, r) {
         REPORTER_ASSERT(r, bm.getColor(0, 0) == rec.color);
     }
 }
+
+DEF_TEST(Codec_jpeg_parallel, r) {
+    // This image has a restart marker every 10 MCUs, so it can be split into bands.
+    const char* path = "images/icc-v2-gbr.jpg";
+    sk_sp<SkData> data(GetResourceAsData(path));
+    if (!data) {
+        return;
+    }
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+
+    // Incremental decodes are only implemented to decode bands in parallel.
+    {
+        std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+        SkBitmap bm;
+        bm.allocPixels(codec->getInfo());
+        SkCodec::Options opts;
+        REPORTER_ASSERT(r, SkCodec::kUnimplemented ==
+                           codec->startIncrementalDecode(bm.info(), bm.getPixels(),
+                                                         bm.rowBytes(), &opts));
+        opts.fExecutor = executor.get();
+        REPORTER_ASSERT(r, SkCodec::kSuccess ==
+                           codec->startIncrementalDecode(bm.info(), bm.getPixels(),
+                                                         bm.rowBytes(), &opts));
+        REPORTER_ASSERT(r, SkCodec::kSuccess == codec->incrementalDecode());
+    }
+
+    auto decode = [&](const SkIRect* subset, SkExecutor* exec, int sampleSize = 1) {
+        std::unique_ptr<SkAndroidCodec> codec = SkAndroidCodec::MakeFromData(data);
+        SkAndroidCodec::AndroidOptions opts;
+        opts.fSubset = subset;
+        opts.fExecutor = exec;
+        opts.fSampleSize = sampleSize;
+        SkBitmap bm;
+        bm.allocPixels(codec->getInfo().makeDimensions(
+                subset ? codec->getSampledSubsetDimensions(sampleSize, *subset)
+                       : codec->getSampledDimensions(sampleSize)));
+        REPORTER_ASSERT(r, SkCodec::kSuccess ==
+                           codec->getAndroidPixels(bm.info(), bm.getPixels(), bm.rowBytes(),
+                                                   &opts));
+        return md5(bm);
+    };
+
+    // Bands are decoded with enough overlap that the results match a serial decode exactly.
+    const SkIRect subset = SkIRect::MakeXYWH(13, 10, 200, 190);
+    REPORTER_ASSERT(r, decode(nullptr, nullptr) == decode(nullptr, executor.get()));
+    REPORTER_ASSERT(r, decode(&subset, nullptr) == decode(&subset, executor.get()));
+
+    // Sample sizes that libjpeg can't scale by natively go through the sampler, which
+    // must not be bypassed by the bands.
+    REPORTER_ASSERT(r, decode(nullptr, nullptr, 3) == decode(nullptr, executor.get(), 3));
+    REPORTER_ASSERT(r, decode(&subset, nullptr, 3) == decode(&subset, executor.get(), 3));
+}
@@ -11,9 +11,11 @@
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkDeferredDisplayList.h"
 #include "include/core/SkDeferredDisplayListRecorder.h"
+#include "include/core/SkFont.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkPictureRecorder.h"
 #include "include/core/SkPromiseImageTexture.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
@@ -28,7 +30,11 @@
 #include "include/gpu/GrTypes.h"
 #include "include/gpu/gl/GrGLTypes.h"
 #include "include/private/gpu/ganesh/GrTypesPriv.h"
+#include "src/core/SkCanvasPriv.h"
 #include "src/core/SkDeferredDisplayListPriv.h"
+#include "src/core/SkDevice.h"
+#include "src/core/SkStrikeCache.h"
+#include "src/core/SkStrikeSpec.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
 #include "src/gpu/ganesh/GrGpu.h"
@@ -40,6 +46,9 @@
 #include "src/image/SkSurface_Gpu.h"
 #include "tests/Test.h"
 #include "tests/TestUtils.h"
+#include "tools/DDLPromiseImageHelper.h"
+#include "tools/DDLTileHelper.h"
+#include "tools/ToolUtils.h"
 #include "tools/gpu/BackendSurfaceFactory.h"
 #include "tools/gpu/GrContextFactory.h"
 #include "tools/gpu/ManagedBackendTexture.h"
@@ -1239,3 +1248,63 @@ DEF_GPUTEST_FOR_GL_RENDERING_CONTEXTS(DDLCompatibilityTest, reporter, ctxInfo) {
     }
 
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// Check that the glyph masks of text recorded into DDLs are rasterized on the recording threads,
+// before any of the DDLs are flushed.
+DEF_GPUTEST_FOR_MOCK_CONTEXT(DDLTextPreparesGlyphImages, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+    static constexpr int kSize = 128;
+
+    // An unusual size, so that no other test has rasterized these glyphs already.
+    SkFont font(ToolUtils::create_portable_typeface("serif", SkFontStyle()), 15.75f);
+    font.setSubpixel(false);
+    static constexpr char kText[] = "Rasterized_while_recording";
+
+    SkPictureRecorder pictureRecorder;
+    SkCanvas* pictureCanvas = pictureRecorder.beginRecording(SkRect::MakeWH(kSize, kSize));
+    for (int y = 20; y < kSize; y += 20) {
+        pictureCanvas->drawString(kText, 0, y, font, SkPaint());
+    }
+    sk_sp<SkPicture> picture = pictureRecorder.finishRecordingAsPicture();
+
+    SkImageInfo ii = SkImageInfo::Make(kSize, kSize, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+    sk_sp<SkSurface> dst = SkSurface::MakeRenderTarget(dContext, SkBudgeted::kNo, ii);
+    REPORTER_ASSERT(reporter, dst);
+    if (!dst) {
+        return;
+    }
+    SkSurfaceCharacterization characterization;
+    SkAssertResult(dst->characterize(&characterization));
+
+    DDLTileHelper tiles(dContext, characterization, SkIRect::MakeWH(kSize, kSize), 2, 2, false);
+    tiles.createBackendTextures(nullptr, dContext);
+    // Only records the DDLs, on the SkTaskGroup's threads.
+    tiles.createDDLsInParallel(picture.get());
+
+    // Look the glyphs up with the same surface props and scaler context flags as the tiles'
+    // recorders, which share the characterization's props and color space.
+    SkDeferredDisplayListRecorder recorder(characterization);
+    SkStrikeDeviceInfo deviceInfo = SkCanvasPriv::TopDeviceStrikeDeviceInfo(recorder.getCanvas());
+    REPORTER_ASSERT(reporter, deviceInfo.fPrepareGlyphImages);
+    SkStrikeSpec strikeSpec = SkStrikeSpec::MakeMask(
+            font, SkPaint(), deviceInfo.fSurfaceProps, deviceInfo.fScalerContextFlags,
+            SkMatrix::I());
+    sk_sp<SkStrike> strike =
+            SkStrikeCache::GlobalStrikeCache()->findStrike(strikeSpec.descriptor());
+    REPORTER_ASSERT(reporter, strike);
+    if (strike) {
+        SkGlyphID glyphIDs[std::size(kText) - 1];
+        int count = font.textToGlyphs(kText, std::size(kText) - 1, SkTextEncoding::kUTF8,
+                                      glyphIDs, std::size(glyphIDs));
+        const SkGlyph* glyphs[std::size(glyphIDs)];
+        strike->metrics(SkSpan(glyphIDs, count), glyphs);
+        for (int i = 0; i < count; ++i) {
+            REPORTER_ASSERT(reporter, glyphs[i]->setImageHasBeenCalled());
+        }
+    }
+
+    dst->draw(tiles.composeDDL());
+    dContext->flushAndSubmit(true);
+    tiles.deleteBackendTextures(nullptr, dContext);
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkData.h"
+#include "include/gpu/GrPersistentFileCache.h"
+#include "src/gpu/ganesh/GrPersistentCacheUtils.h"
+#include "src/utils/SkOSPath.h"
+#include "tests/Test.h"
+
+#include <cstdio>
+
+static sk_sp<SkData> make_key(int i) { return SkData::MakeWithCopy(&i, sizeof(i)); }
+
+// Packs a fake program the way the GL and Vulkan backends do, padded out to roughly `size` bytes.
+static sk_sp<SkData> make_program(int i, size_t size) {
+    std::string shaders[kGrShaderTypeCount];
+    shaders[kVertex_GrShaderType]   = std::string(size, 'a' + i % 26);
+    shaders[kFragment_GrShaderType] = std::to_string(i);
+    SkSL::Program::Inputs inputs;
+    return GrPersistentCacheUtils::PackCachedShaders(SkSetFourByteTag('S', 'K', 'S', 'L'),
+                                                     shaders, &inputs, 1);
+}
+
+// Looks like a VkPipelineCache blob: a VkPipelineCacheHeaderVersionOne and then opaque data.
+static sk_sp<SkData> make_pipeline_cache() {
+    uint32_t blob[16] = {};
+    blob[0] = 32;  // headerSize
+    blob[1] = 1;   // VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+    blob[2] = 0x10de;
+    for (size_t i = 4; i < SK_ARRAY_COUNT(blob); ++i) {
+        blob[i] = i * 0x01010101;
+    }
+    return SkData::MakeWithCopy(blob, sizeof(blob));
+}
+
+DEF_TEST(GrPersistentFileCache, reporter) {
+    SkString tmpDir = skiatest::GetTmpDir();
+    if (tmpDir.isEmpty()) {
+        return;
+    }
+    SkString path = SkOSPath::Join(tmpDir.c_str(), "GrPersistentFileCache.pack");
+    remove(path.c_str());
+
+    static constexpr size_t kProgramSize = 1000;
+    static constexpr size_t kBudget      = 4 * kProgramSize + kProgramSize / 2;
+    {
+        auto cache = GrPersistentFileCache::Make(path.c_str(), kBudget);
+        REPORTER_ASSERT(reporter, !cache->load(*make_key(0)));
+
+        // Store six programs, touching the first along the way. Only four fit in the budget, so
+        // the two least recently used (1 and 2) are evicted.
+        for (int i = 0; i < 6; ++i) {
+            cache->store(*make_key(i), *make_program(i, kProgramSize), SkString());
+            if (i == 3) {
+                REPORTER_ASSERT(reporter, cache->load(*make_key(0)));
+            }
+        }
+        sk_sp<SkData> program = cache->load(*make_key(5));
+        REPORTER_ASSERT(reporter, program && program->equals(make_program(5, kProgramSize).get()));
+        REPORTER_ASSERT(reporter, !cache->load(*make_key(1)));
+        REPORTER_ASSERT(reporter, !cache->load(*make_key(2)));
+
+        // A program packed by an older version of the cache utils.
+        sk_sp<SkData> stale = make_program(6, kProgramSize / 10);
+        const int staleVersion = GrPersistentCacheUtils::GetCurrentVersion() - 1;
+        memcpy(stale->writable_data(), &staleVersion, sizeof(staleVersion));
+        cache->store(*make_key(6), *stale, SkString("stale"));
+
+        // Data stored without a GrPersistentCacheUtils header, like Vulkan's pipeline cache.
+        cache->store(*make_key(8), *make_pipeline_cache(), SkString());
+
+        auto stats = cache->stats();
+        REPORTER_ASSERT(reporter, stats.fHits == 2);
+        REPORTER_ASSERT(reporter, stats.fMisses == 3);
+        REPORTER_ASSERT(reporter, stats.fStores == 8);
+        REPORTER_ASSERT(reporter, stats.fEvictions == 2);
+        REPORTER_ASSERT(reporter, stats.fEntries == 6);
+        REPORTER_ASSERT(reporter, stats.fBytesUsed <= kBudget);
+        REPORTER_ASSERT(reporter, cache->sync());
+    }
+    {
+        // Everything but the stale program comes back from the pack, in the same LRU order.
+        auto cache = GrPersistentFileCache::Make(path.c_str(), kBudget);
+        auto stats = cache->stats();
+        REPORTER_ASSERT(reporter, stats.fEntries == 5);
+        REPORTER_ASSERT(reporter, stats.fDroppedEntries == 1);
+        REPORTER_ASSERT(reporter, !cache->load(*make_key(6)));
+
+        // Program 3 was the least recently used when the pack was written, so it goes first.
+        cache->store(*make_key(7), *make_program(7, kProgramSize), SkString());
+        REPORTER_ASSERT(reporter, !cache->load(*make_key(3)));
+        for (int i : {0, 4, 5, 7}) {
+            sk_sp<SkData> program = cache->load(*make_key(i));
+            sk_sp<SkData> expected = make_program(i, kProgramSize);
+            REPORTER_ASSERT(reporter, program && program->equals(expected.get()), "%d", i);
+        }
+        sk_sp<SkData> pipelineCache = cache->load(*make_key(8));
+        REPORTER_ASSERT(reporter, pipelineCache &&
+                                  pipelineCache->equals(make_pipeline_cache().get()));
+        pipelineCache.reset();
+
+        // Rewriting the pack first moves the entries read from it off of its mapping.
+        REPORTER_ASSERT(reporter, cache->sync());
+        REPORTER_ASSERT(reporter, cache->stats().fEntries == 5);
+    }
+    {
+        auto cache = GrPersistentFileCache::Make(path.c_str(), kBudget);
+        REPORTER_ASSERT(reporter, cache->stats().fEntries == 5);
+        for (int i : {0, 4, 5, 7}) {
+            sk_sp<SkData> program = cache->load(*make_key(i));
+            sk_sp<SkData> expected = make_program(i, kProgramSize);
+            REPORTER_ASSERT(reporter, program && program->equals(expected.get()), "%d", i);
+        }
+    }
+    remove(path.c_str());
+}
@@ -150,6 +150,54 @@ DEF_GPUTEST_FOR_RENDERING_CONTEXTS(GrTextBlobMoveAround, reporter, ctxInfo) {
     }
 }
 
+#if SK_GPU_V1
+#include "src/core/SkCanvasPriv.h"
+#include "src/gpu/ganesh/ops/OpsTask.h"
+#include "src/gpu/ganesh/v1/SurfaceDrawContext_v1.h"
+
+// Many small blobs drawn with plain colors are folded into one AtlasTextOp as they're recorded.
+// A draw with a non-trivial paint can't be, and must not be merged across by later draws.
+DEF_GPUTEST_FOR_MOCK_CONTEXT(GrTextBlobAppendToLastOp, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+    SkFont font{ToolUtils::create_portable_typeface("Mono", SkFontStyle()), 12};
+
+    const SkImageInfo info = SkImageInfo::Make(256, 256, kN32_SkColorType, kPremul_SkAlphaType);
+    auto surface = SkSurface::MakeRenderTarget(dContext, SkBudgeted::kNo, info);
+    SkCanvas* canvas = surface->getCanvas();
+    auto sdc = SkCanvasPriv::TopDeviceSurfaceDrawContext(canvas);
+    auto numOpChains = [&] { return sdc->testingOnly_PeekLastOpsTask()->numOpChains(); };
+
+    SkPaint paint;
+    auto drawBlob = [&](int i) {
+        SkString text;
+        text.printf("%d", i);
+        canvas->drawTextBlob(SkTextBlob::MakeFromString(text.c_str(), font),
+                             (i % 10) * 24, 16 + (i / 10) * 16, paint);
+    };
+
+    drawBlob(0);
+    const int chains = numOpChains();
+    for (int i = 1; i < 100; i++) {
+        paint.setColor(i & 1 ? SK_ColorRED : SK_ColorBLUE);
+        drawBlob(i);
+    }
+    REPORTER_ASSERT(reporter, numOpChains() == chains);
+
+    paint.setBlendMode(SkBlendMode::kMultiply);
+    drawBlob(0);
+    REPORTER_ASSERT(reporter, numOpChains() == chains + 1);
+
+    // This overlaps the multiply draw, so it has to come after it.
+    paint.setBlendMode(SkBlendMode::kSrcOver);
+    drawBlob(0);
+    REPORTER_ASSERT(reporter, numOpChains() == chains + 2);
+    drawBlob(1);
+    REPORTER_ASSERT(reporter, numOpChains() == chains + 2);
+
+    dContext->flushAndSubmit();
+}
+#endif  // SK_GPU_V1
+
 DEF_TEST(BagOfBytesBasic, r) {
     const int k4K = 1 << 12;
     {
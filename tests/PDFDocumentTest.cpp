@@ -256,3 +256,33 @@ DEF_TEST(SkPDF_abort_jobs, rep) {
     doc->abort();
 }
 
+
+// Queue more jobs than the document lets run at once, including a font subset, and make sure
+// they all make it into the output.
+DEF_TEST(SkPDF_threaded_many_pages, r) {
+    REQUIRE_PDF_DOCUMENT(SkPDF_threaded_many_pages, r);
+    sk_sp<SkTypeface> typeface = MakeResourceAsTypeface("fonts/Roboto-Regular.ttf");
+    if (!typeface) {
+        return;
+    }
+    SkFont font(typeface, 12);
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkPDF::Metadata metadata;
+    metadata.fExecutor = executor.get();
+    SkDynamicMemoryWStream wStream;
+    {
+        auto doc = SkPDF::MakeDocument(&wStream, metadata);
+        constexpr int kPages = 200;
+        for (int i = 0; i < kPages; ++i) {
+            SkBitmap bitmap;
+            bitmap.allocN32Pixels(16, 16);
+            bitmap.eraseColor(SkColorSetARGB(0xFF, 0x00, (uint8_t)i, 0xFF));
+            SkCanvas* canvas = doc->beginPage(612, 792);
+            canvas->drawImage(bitmap.asImage(), 0, 0);
+            canvas->drawString(SkStringPrintf("Page %d", i), 36, 36, font, SkPaint());
+        }
+    }
+    sk_sp<SkData> data(wStream.detachAsData());
+    REPORTER_ASSERT(r, contains(data->bytes(), data->size(), "/Count 200"));
+    REPORTER_ASSERT(r, contains(data->bytes(), data->size(), "/FontFile2"));
+}
@@ -823,6 +823,92 @@ DEF_TEST(Picture_empty_serial, reporter) {
     REPORTER_ASSERT(reporter, pic2);
 }
 
+DEF_TEST(Picture_MakeLazyFromData, r) {
+    SkPictureRecorder rec;
+    SkCanvas* canvas = rec.beginRecording(64, 64);
+    SkRandom rand;
+    for (int i = 0; i < 50; i++) {
+        SkPaint paint;
+        paint.setColor(rand.nextU() | 0xFF000000);
+        canvas->save();
+        canvas->rotate(rand.nextRangeF(-30, 30), 32, 32);
+        canvas->drawRect(SkRect::MakeXYWH(rand.nextRangeF(0, 48), rand.nextRangeF(0, 48), 16, 16),
+                         paint);
+        canvas->drawPath(SkPath::Circle(rand.nextRangeF(0, 64), rand.nextRangeF(0, 64), 4), paint);
+        canvas->restore();
+    }
+    sk_sp<SkData> data = rec.finishRecordingAsPicture()->serialize();
+
+    auto draw = [](const SkPicture* pic) {
+        SkBitmap bm;
+        bm.allocN32Pixels(64, 64);
+        bm.eraseColor(SK_ColorWHITE);
+        SkCanvas(bm).drawPicture(pic);
+        return bm;
+    };
+    auto same = [](const SkBitmap& a, const SkBitmap& b) {
+        return 0 == memcmp(a.getPixels(), b.getPixels(), a.computeByteSize());
+    };
+
+    sk_sp<SkPicture> eager = SkPicture::MakeFromData(data.get());
+    sk_sp<SkPicture> lazy = SkPicture::MakeLazyFromData(data.get());
+    REPORTER_ASSERT(r, eager && lazy);
+    REPORTER_ASSERT(r, lazy->cullRect() == eager->cullRect());
+    REPORTER_ASSERT(r, lazy->approximateOpCount() == eager->approximateOpCount());
+
+    // The first draw decodes as it goes, and later ones replay the decoded commands.
+    SkBitmap expected = draw(eager.get());
+    REPORTER_ASSERT(r, same(draw(lazy.get()), expected));
+    const size_t bytesUsed = lazy->approximateBytesUsed();
+    for (int i = 0; i < 2; i++) {
+        REPORTER_ASSERT(r, same(draw(lazy.get()), expected));
+    }
+    REPORTER_ASSERT(r, lazy->approximateBytesUsed() > bytesUsed);
+
+    sk_sp<SkPicture> reserialized = SkPicture::MakeFromData(lazy->serialize().get());
+    REPORTER_ASSERT(r, reserialized && same(draw(reserialized.get()), expected));
+
+    REPORTER_ASSERT(r, !SkPicture::MakeLazyFromData(nullptr));
+    REPORTER_ASSERT(r, !SkPicture::MakeLazyFromData(SkData::MakeSubset(data.get(), 0, 20).get()));
+
+    // Commands that can't be decoded are caught up front. The op data follows its tag and size.
+    sk_sp<SkData> corrupt = SkData::MakeWithCopy(data->data(), data->size());
+    const uint32_t tag = SkSetFourByteTag('r', 'e', 'a', 'd');
+    auto* bytes = static_cast<uint8_t*>(corrupt->writable_data());
+    for (size_t i = 0; i + 12 <= corrupt->size(); i++) {
+        if (0 == memcmp(bytes + i, &tag, sizeof(tag))) {
+            bytes[i + 11] = 0xff;  // The first command's op.
+            break;
+        }
+    }
+    REPORTER_ASSERT(r, SkPicture::MakeFromData(corrupt.get()));
+    REPORTER_ASSERT(r, !SkPicture::MakeLazyFromData(corrupt.get()));
+}
+
+DEF_TEST(Picture_MakeLazyFromData_Nested, r) {
+    SkPictureRecorder rec;
+    SkCanvas* canvas = rec.beginRecording(64, 64);
+    for (int i = 0; i < 10; i++) {
+        canvas->drawRect(SkRect::MakeXYWH(i, i, 8, 8), SkPaint());
+    }
+    sk_sp<SkPicture> inner = rec.finishRecordingAsPicture();
+
+    canvas = rec.beginRecording(64, 64);
+    canvas->drawPicture(inner);
+    canvas->drawPicture(inner);
+    canvas->drawPaint(SkPaint());
+    sk_sp<SkData> data = rec.finishRecordingAsPicture()->serialize();
+
+    sk_sp<SkPicture> eager = SkPicture::MakeFromData(data.get());
+    sk_sp<SkPicture> lazy = SkPicture::MakeLazyFromData(data.get());
+    REPORTER_ASSERT(r, eager && lazy);
+    REPORTER_ASSERT(r, lazy->approximateOpCount(false) == 3);
+    REPORTER_ASSERT(r, lazy->approximateOpCount(true) == 21);
+    REPORTER_ASSERT(r, lazy->approximateOpCount(true) == eager->approximateOpCount(true));
+
+    // The nested picture is counted with the rest of the objects the commands use.
+    REPORTER_ASSERT(r, lazy->approximateBytesUsed() > inner->approximateBytesUsed());
+}
 
 DEF_TEST(Picture_drawsNothing, r) {
     // Tests that pic->cullRect().isEmpty() is a good way to test a picture
@@ -8,6 +8,8 @@
 #include "tests/RecordTestUtils.h"
 #include "tests/Test.h"
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkRegion.h"
 #include "include/core/SkSurface.h"
 #include "include/effects/SkImageFilters.h"
 #include "src/core/SkImagePriv.h"
@@ -288,3 +290,57 @@ DEF_TEST(RecordDraw_drawImage, r){
 
     SkCanvasMock canvas(10, 10);
 }
+
+DEF_TEST(RecordDraw_Damage, r) {
+    // Two records that differ only in the color of their last two rects.
+    auto record = [](SkRecord* record, SkColor color) {
+        SkRecorder recorder(record, W, H);
+        SkPaint paint;
+        recorder.drawRect(SkRect::MakeWH(100, 100), paint);
+        paint.setColor(color);
+        recorder.save();
+        recorder.translate(50, 50);
+        recorder.drawRect(SkRect::MakeLTRB(10, 20, 30, 40), paint);
+        recorder.restore();
+        recorder.drawRect(SkRect::MakeLTRB(200, 200, 300, 300), paint);
+    };
+    SkRecord before, after;
+    record(&before, SK_ColorRED);
+    record(&after,  SK_ColorBLUE);
+
+    auto bounds = [](const SkRecord& record) {
+        std::vector<SkRect> bounds(record.count());
+        std::vector<SkBBoxHierarchy::Metadata> meta(record.count());
+        SkRecordFillBounds(SkRect::MakeWH(W, H), record, bounds.data(), meta.data());
+        return bounds;
+    };
+    SkRegion damage;
+    SkRecordComputeDamage(before, bounds(before).data(), after, bounds(after).data(), &damage);
+    SkRegion expected;
+    expected.op(SkIRect::MakeLTRB( 60,  70,  80,  90), SkRegion::kUnion_Op);
+    expected.op(SkIRect::MakeLTRB(200, 200, 300, 300), SkRegion::kUnion_Op);
+    REPORTER_ASSERT(r, damage == expected);
+
+    // A record compared with itself has no damage.
+    SkRegion none;
+    SkRecordComputeDamage(before, bounds(before).data(), before, bounds(before).data(), &none);
+    REPORTER_ASSERT(r, none.isEmpty());
+
+    // Replaying the damage over before should look just like drawing after.
+    SkBitmap full, updated;
+    full.allocN32Pixels(W, H);
+    updated.allocN32Pixels(W, H);
+    full.eraseColor(SK_ColorTRANSPARENT);
+    updated.eraseColor(SK_ColorTRANSPARENT);
+    {
+        SkCanvas canvas(full);
+        SkRecordDraw(after, &canvas, nullptr, nullptr, 0, nullptr, nullptr);
+    }
+    {
+        SkCanvas canvas(updated);
+        SkRecordDraw(before, &canvas, nullptr, nullptr, 0, nullptr, nullptr);
+        SkRecordDrawDamage(after, &canvas, damage, nullptr, nullptr, 0, nullptr);
+    }
+    REPORTER_ASSERT(r, 0 == memcmp(full.getPixels(), updated.getPixels(),
+                                   full.computeByteSize()));
+}
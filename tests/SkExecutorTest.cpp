@@ -0,0 +1,63 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkExecutor.h"
+#include "src/core/SkTaskGroup.h"
+#include "tests/Test.h"
+
+#include <atomic>
+#include <vector>
+
+DEF_TEST(SkExecutor_WorkStealing, r) {
+    static constexpr int kOuter = 8;
+    static constexpr int kInner = 100;
+
+    for (bool allowBorrowing : {false, true}) {
+        auto executor = SkExecutor::MakeWorkStealingThreadPool(4, allowBorrowing);
+
+        // Every task runs exactly once, whether it's added by this thread or by a pool thread.
+        std::vector<std::atomic<int>> runs(kOuter * kInner);
+        SkTaskGroup group(*executor);
+        group.batch(kOuter, [&](int outer) {
+            for (int inner = 0; inner < kInner; inner++) {
+                group.add([&runs, i = outer * kInner + inner] {
+                    runs[i].fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        });
+        group.wait();
+        for (const std::atomic<int>& count : runs) {
+            REPORTER_ASSERT(r, count.load() == 1);
+        }
+
+        if (!allowBorrowing) {
+            continue;
+        }
+        // A task group nested inside a pool thread's task finishes, even with every thread
+        // waiting on one, because waiting threads borrow work.
+        std::atomic<int> nestedRuns{0};
+        group.batch(4, [&](int) {
+            SkTaskGroup nested(*executor);
+            nested.batch(kInner, [&](int) { nestedRuns.fetch_add(1, std::memory_order_relaxed); });
+            nested.wait();
+        });
+        group.wait();
+        REPORTER_ASSERT(r, nestedRuns.load() == 4 * kInner);
+    }
+}
+
+DEF_TEST(SkExecutor_WorkStealingShutdown, r) {
+    // Destroying the pool runs all the work added to it first.
+    std::atomic<int> runs{0};
+    {
+        auto executor = SkExecutor::MakeWorkStealingThreadPool(3);
+        for (int i = 0; i < 1000; i++) {
+            executor->add([&] { runs.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    REPORTER_ASSERT(r, runs.load() == 1000);
+}
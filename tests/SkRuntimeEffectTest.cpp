@@ -18,6 +18,7 @@
 #include "include/gpu/GrDirectContext.h"
 #include "include/sksl/SkSLDebugTrace.h"
 #include "src/core/SkColorSpacePriv.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkRuntimeEffectPriv.h"
 #include "src/core/SkTLazy.h"
 #include "src/gpu/KeyBuilder.h"
@@ -28,6 +29,7 @@
 #include "src/gpu/ganesh/GrImageInfo.h"
 #include "src/gpu/ganesh/SurfaceFillContext.h"
 #include "src/gpu/ganesh/effects/GrSkSLFP.h"
+#include "src/sksl/SkSLRehydrator.h"
 #include "tests/Test.h"
 
 #include <algorithm>
@@ -56,6 +58,28 @@ DEF_TEST(SkRuntimeEffectInvalid_UndefinedFunction, r) {
                            "function 'half4 missing()' is not defined");
 }
 
+DEF_TEST(SkRuntimeEffectInvalid_RedefinedIntrinsic, r) {
+    // Built-in modules are shared by every effect, so one effect can't give an intrinsic its own
+    // definition...
+    test_invalid_effect(r, "float3 cross(float3 x, float3 y) { return x; }" EMPTY_MAIN,
+                           "built-in function 'float3 cross(float3 x, float3 y)' cannot be "
+                           "redefined");
+
+    // ... and effects compiled later still get the real one.
+    auto [effect, err] = SkRuntimeEffect::MakeForShader(SkString(
+            "half4 main(float2 p) { return cross(half3(1, 0, 0), half3(0, 1, 0)).xyz1; }"));
+    REPORTER_ASSERT(r, effect, "%s", err.c_str());
+    if (!effect) {
+        return;
+    }
+    SkPaint paint;
+    paint.setShader(effect->makeShader(/*uniforms=*/nullptr, /*children=*/{}));
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(1, 1);
+    SkCanvas(bitmap).drawPaint(paint);
+    REPORTER_ASSERT(r, bitmap.getColor(0, 0) == SK_ColorBLUE);
+}
+
 DEF_TEST(SkRuntimeEffectInvalid_UndefinedMain, r) {
     // Shouldn't be possible to create an SkRuntimeEffect without "main"
     test_invalid_effect(r, "", "main");
@@ -1317,6 +1341,99 @@ DEF_TEST(SkRuntimeShaderIsOpaque, r) {
     test("return cOnes.eval(xy);", false);
 }
 
+DEF_TEST(SkRuntimeEffectCompiledProgram, r) {
+    static constexpr char kSource[] =
+            "uniform shader child;"
+            "uniform half4 tint;"
+            "half4 scale(half4 c) { return c * tint; }"
+            "half4 main(float2 xy) { return scale(child.eval(xy * 0.5)) + half4(sin(xy.x)); }";
+
+    auto [effect, err] = SkRuntimeEffect::MakeForShader(SkString(kSource));
+    REPORTER_ASSERT(r, effect, "%s", err.c_str());
+    sk_sp<SkData> compiled = effect->compiledProgram();
+    REPORTER_ASSERT(r, compiled);
+
+    // An effect made from the compiled program must be indistinguishable from the original.
+    auto [warm, warmErr] = SkRuntimeEffect::MakeForShaderFromCompiledProgram(SkString(kSource),
+                                                                              *compiled);
+    REPORTER_ASSERT(r, warm, "%s", warmErr.c_str());
+    if (!warm) {
+        return;
+    }
+    REPORTER_ASSERT(r, warm->source() == effect->source());
+    REPORTER_ASSERT(r, warm->allowShader());
+    REPORTER_ASSERT(r, warm->uniformSize() == effect->uniformSize());
+    REPORTER_ASSERT(r, warm->uniforms().size() == 1 && warm->uniforms()[0].name == "tint");
+    REPORTER_ASSERT(r, warm->children().size() == 1 && warm->children()[0].name == "child");
+
+    // ... and must draw the same pixels.
+    auto draw = [&](const SkRuntimeEffect& e) {
+        const float tint[] = {0.25f, 0.5f, 0.75f, 1.0f};
+        SkRuntimeEffect::ChildPtr children[] = {SkShaders::Color(SK_ColorCYAN)};
+        SkPaint paint;
+        paint.setShader(e.makeShader(SkData::MakeWithCopy(&tint, sizeof(tint)), children));
+
+        SkBitmap bitmap;
+        bitmap.allocN32Pixels(4, 4);
+        SkCanvas canvas(bitmap);
+        canvas.drawPaint(paint);
+        return bitmap;
+    };
+    SkBitmap expected = draw(*effect), actual = draw(*warm);
+    REPORTER_ASSERT(r, !memcmp(expected.getPixels(), actual.getPixels(),
+                               expected.computeByteSize()));
+
+    // Blobs that don't match the source, options or kind of effect, or are damaged, are rejected.
+    REPORTER_ASSERT(r, !SkRuntimeEffect::MakeForShaderFromCompiledProgram(SkString(EMPTY_MAIN),
+                                                                          *compiled).effect);
+    SkRuntimeEffect::Options unoptimized;
+    unoptimized.forceUnoptimized = true;
+    REPORTER_ASSERT(r, !SkRuntimeEffect::MakeForShaderFromCompiledProgram(SkString(kSource),
+                                                                          *compiled,
+                                                                          unoptimized).effect);
+    auto [wrongKind, wrongKindErr] =
+            SkRuntimeEffect::MakeForBlenderFromCompiledProgram(SkString(kSource), *compiled);
+    REPORTER_ASSERT(r, !wrongKind);
+    REPORTER_ASSERT(r, wrongKindErr.contains("kind"), "%s", wrongKindErr.c_str());
+    sk_sp<SkData> damaged = SkData::MakeWithCopy(compiled->data(), compiled->size());
+    static_cast<uint8_t*>(damaged->writable_data())[damaged->size() - 1] ^= 0xFF;
+    REPORTER_ASSERT(r, !SkRuntimeEffect::MakeForShaderFromCompiledProgram(SkString(kSource),
+                                                                          *damaged).effect);
+    sk_sp<SkData> truncated = SkData::MakeSubset(compiled.get(), 0, 8);
+    REPORTER_ASSERT(r, !SkRuntimeEffect::MakeForShaderFromCompiledProgram(SkString(kSource),
+                                                                          *truncated).effect);
+
+    // A blob with a valid header and checksum that doesn't hold a program fails cleanly. The
+    // header is six uint32s, ending with the checksum; the body is a binary format version, an
+    // empty string table, and then something other than a program.
+    static constexpr size_t kHeaderSize = 6 * sizeof(uint32_t);
+    const uint8_t notAProgram[] = {SkSL::Rehydrator::kVersion & 0xFF,
+                                   SkSL::Rehydrator::kVersion >> 8,
+                                   0, 0,
+                                   0xFF};
+    sk_sp<SkData> bogus = SkData::MakeUninitialized(kHeaderSize + sizeof(notAProgram));
+    auto* bogusBytes = static_cast<uint8_t*>(bogus->writable_data());
+    memcpy(bogusBytes, compiled->data(), kHeaderSize - sizeof(uint32_t));
+    const uint32_t checksum = SkOpts::hash_fn(notAProgram, sizeof(notAProgram), 0);
+    memcpy(bogusBytes + kHeaderSize - sizeof(uint32_t), &checksum, sizeof(checksum));
+    memcpy(bogusBytes + kHeaderSize, notAProgram, sizeof(notAProgram));
+    auto [bogusEffect, bogusErr] =
+            SkRuntimeEffect::MakeForShaderFromCompiledProgram(SkString(kSource), *bogus);
+    REPORTER_ASSERT(r, !bogusEffect);
+    REPORTER_ASSERT(r, bogusErr.contains("rehydrated"), "%s", bogusErr.c_str());
+
+    // Color filters work too, but only as color filters.
+    auto [filter, filterErr] =
+            SkRuntimeEffect::MakeForColorFilter(SkString("half4 main(half4 c) { return c*c; }"));
+    REPORTER_ASSERT(r, filter, "%s", filterErr.c_str());
+    sk_sp<SkData> compiledFilter = filter->compiledProgram();
+    auto [warmFilter, warmFilterErr] = SkRuntimeEffect::MakeForColorFilterFromCompiledProgram(
+            SkString("half4 main(half4 c) { return c*c; }"), *compiledFilter);
+    REPORTER_ASSERT(r, warmFilter && warmFilter->allowColorFilter(), "%s", warmFilterErr.c_str());
+    REPORTER_ASSERT(r, !SkRuntimeEffect::MakeForShaderFromCompiledProgram(
+            SkString("half4 main(half4 c) { return c*c; }"), *compiledFilter).effect);
+}
+
 DEF_GPUTEST_FOR_ALL_CONTEXTS(GrSkSLFP_Specialized, r, ctxInfo) {
     struct FpAndKey {
         std::unique_ptr<GrFragmentProcessor> fp;
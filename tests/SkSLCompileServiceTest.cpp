@@ -0,0 +1,64 @@
+/*
+ * Copyright 2022 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkExecutor.h"
+#include "include/core/SkTypes.h"
+#include "include/private/SkSLProgramKind.h"
+#include "src/sksl/SkSLCompileService.h"
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/SkSLUtil.h"
+#include "src/sksl/ir/SkSLProgram.h"
+#include "tests/Test.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+static const char* kSources[] = {
+    "half4 main(float2 p) { return half4(p.xy01); }",
+    "uniform half4 color; half4 main(float2 p) { return color * cross(p.xy1, p.yx1).xyz1; }",
+    "half4 main(float2 p) { return half4(length(p), dot(normalize(p), p.yx), 0, 1); }",
+    "half4 main(float2 p) { return undeclared; }",
+    "float3 cross(float3 x, float3 y) { return x; } half4 main(float2 p) { return half4(1); }",
+};
+
+DEF_TEST(SkSLCompileService, r) {
+    std::unique_ptr<SkSL::ShaderCaps> caps = SkSL::ShaderCapsFactory::Default();
+
+    // Compile every source serially with a single compiler, to get the expected results.
+    std::vector<std::string> expected;
+    SkSL::Compiler compiler(caps.get());
+    SkSL::Program::Settings settings;
+    for (const char* src : kSources) {
+        std::unique_ptr<SkSL::Program> program = compiler.convertProgram(
+                SkSL::ProgramKind::kRuntimeShader, src, settings);
+        expected.push_back(program ? program->description() : compiler.errorText());
+    }
+
+    // Then compile many copies of each source at once, which should produce identical results.
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkSL::CompileService service(caps.get(), executor.get());
+
+    constexpr int kCopies = 8;
+    std::vector<SkSL::CompileService::Request> requests;
+    for (int i = 0; i < kCopies; ++i) {
+        for (const char* src : kSources) {
+            requests.push_back({SkSL::ProgramKind::kRuntimeShader, src, settings});
+        }
+    }
+    std::vector<SkSL::CompileService::Result> results = service.convertPrograms(requests);
+    REPORTER_ASSERT(r, results.size() == requests.size());
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const SkSL::CompileService::Result& result = results[i];
+        std::string actual = result.fProgram ? result.fProgram->description() : result.fErrors;
+        REPORTER_ASSERT(r, actual == expected[i % SK_ARRAY_COUNT(kSources)],
+                        "request %zu:\n%s", i, actual.c_str());
+    }
+    REPORTER_ASSERT(r, !results[3].fProgram);
+    REPORTER_ASSERT(r, !results[4].fProgram);
+}
@@ -7,6 +7,7 @@
 
 #include "src/core/SkStrikeCache.h"
 #include "src/core/SkStrikeSpec.h"
+#include "src/core/SkTaskGroup.h"
 #include "tests/Test.h"
 #include "tools/ToolUtils.h"
 
@@ -48,6 +49,38 @@ DEF_TEST(SkStrikeCache_CachePurge, Reporter) {
         REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() == 0);
     }
     REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() == 0);
+}
+
+DEF_TEST(SkStrikeCache_ThreadedLookup, Reporter) {
+    SkStrikeCache cache;
+    constexpr int kCountLimit = 8;
+    cache.setCacheCountLimit(kCountLimit);
 
+    sk_sp<SkTypeface> typeface =
+            ToolUtils::create_portable_typeface("serif", SkFontStyle::Italic());
+    auto makeSpec = [&](SkScalar size) {
+        SkFont font(typeface, size);
+        SkPaint defaultPaint;
+        return SkStrikeSpec::MakeMask(
+                font, defaultPaint, SkSurfaceProps(0, kUnknown_SkPixelGeometry),
+                SkScalerContextFlags::kNone, SkMatrix::I());
+    };
+
+    // A strike this thread just found must not be found again once it has been purged.
+    SkStrikeSpec strikeSpec = makeSpec(12);
+    sk_sp<SkStrike> first = strikeSpec.findOrCreateStrike(&cache);
+    REPORTER_ASSERT(Reporter, cache.findStrike(strikeSpec.descriptor()) == first);
+    cache.purgeAll();
+    REPORTER_ASSERT(Reporter, cache.findStrike(strikeSpec.descriptor()) == nullptr);
+    REPORTER_ASSERT(Reporter, strikeSpec.findOrCreateStrike(&cache) != first);
 
+    // Lookups from many threads still keep the cache within its budget.
+    SkTaskGroup().batch(16, [&](int i) {
+        for (int size = 8; size < 24; size++) {
+            SkStrikeSpec spec = makeSpec(size + (i % 2));
+            sk_sp<SkStrike> strike = spec.findOrCreateStrike(&cache);
+            REPORTER_ASSERT(Reporter, strike->getDescriptor() == spec.descriptor());
+        }
+    });
+    REPORTER_ASSERT(Reporter, cache.getCacheCountUsed() <= kCountLimit);
 }
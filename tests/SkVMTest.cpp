@@ -10,7 +10,9 @@
 #include "include/private/SkColorData.h"
 #include "src/core/SkCpu.h"
 #include "src/core/SkMSAN.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkVM.h"
+#include "src/core/SkVMProgramCache.h"
 #include "src/gpu/ganesh/GrShaderCaps.h"
 #include "src/sksl/SkSLCompiler.h"
 #include "src/sksl/codegen/SkSLVMCodeGenerator.h"
@@ -113,6 +115,202 @@ DEF_TEST(SkVM_allow_jit, r) {
     }
 }
 
+DEF_TEST(SkVM_serialize, r) {
+    skvm::Builder b;
+    {
+        auto src = b.varying<int>(),
+             dst = b.varying<int>();
+        b.store32(dst, b.add(b.load32(src), b.splat(3)));
+    }
+
+    test_jit_and_interpreter(b, [&](const skvm::Program& original) {
+        SkDynamicMemoryWStream stream;
+        REPORTER_ASSERT(r, original.serialize(&stream));
+        sk_sp<SkData> data = stream.detachAsData();
+
+        SkMemoryStream in(data);
+        std::optional<skvm::Program> p = skvm::Program::Deserialize(&in, b);
+        REPORTER_ASSERT(r, p.has_value());
+        REPORTER_ASSERT(r, p->hasJIT() == original.hasJIT());
+
+        int src[] = {1,2,3,4,5,6,7,8,9},
+            dst[] = {0,0,0,0,0,0,0,0,0};
+        p->eval(std::size(src), src, dst);
+        for (size_t i = 0; i < std::size(src); i++) {
+            REPORTER_ASSERT(r, dst[i] == src[i] + 3);
+        }
+
+        // Any corruption or truncation should be rejected.
+        sk_sp<SkData> corrupt = SkData::MakeWithCopy(data->data(), data->size());
+        static_cast<uint8_t*>(corrupt->writable_data())[data->size() / 2] ^= 0x40;
+        SkMemoryStream corruptIn(corrupt);
+        REPORTER_ASSERT(r, !skvm::Program::Deserialize(&corruptIn, b).has_value());
+
+        SkMemoryStream truncatedIn(data->data(), data->size() - 1);
+        REPORTER_ASSERT(r, !skvm::Program::Deserialize(&truncatedIn, b).has_value());
+    });
+}
+
+DEF_TEST(SkVM_serialize_validates, r) {
+    // dst = src + uniforms[1]
+    skvm::Builder b;
+    {
+        skvm::UPtr uniforms = b.uniform();
+        skvm::Ptr src = b.varying<int>(),
+                  dst = b.varying<int>();
+        b.store32(dst, b.add(b.load32(src), b.uniform32(uniforms, 4)));
+    }
+
+    test_jit_and_interpreter(b, [&](const skvm::Program& original) {
+        SkDynamicMemoryWStream stream;
+        REPORTER_ASSERT(r, original.serialize(&stream));
+        sk_sp<SkData> data = stream.detachAsData();
+
+        // A Program only deserializes against the Builder it came from.
+        skvm::Builder other;
+        {
+            skvm::UPtr uniforms = other.uniform();
+            skvm::Ptr src = other.varying<int>(),
+                      dst = other.varying<int>();
+            other.store32(dst, other.add(other.load32(src), other.uniform32(uniforms, 8)));
+        }
+        SkMemoryStream otherIn(data);
+        REPORTER_ASSERT(r, !skvm::Program::Deserialize(&otherIn, other).has_value());
+
+        // Point the uniform load somewhere else, fixing up the checksum so only validation can
+        // catch it.  The body starts after a 16 byte header (magic, version, size, checksum) with
+        // regs, loop, the strides, then the instructions, each 9 ints: op,d,x,y,z,w,immA,immB,immC.
+        sk_sp<SkData> tampered = SkData::MakeWithCopy(data->data(), data->size());
+        auto words = static_cast<int32_t*>(tampered->writable_data());
+        const int nstrides = words[6],
+                  ninstructions = words[7 + nstrides];
+        int32_t* inst = words + 8 + nstrides;
+        bool found = false;
+        for (int i = 0; i < ninstructions; i++, inst += 9) {
+            if (inst[0] == (int)skvm::Op::uniform32) {
+                REPORTER_ASSERT(r, inst[7] == 4);
+                inst[7] = 1 << 20;
+                found = true;
+            }
+        }
+        REPORTER_ASSERT(r, found);
+        words[3] = (int32_t)SkOpts::hash(words + 4, tampered->size() - 16);
+
+        SkMemoryStream tamperedIn(tampered);
+        REPORTER_ASSERT(r, !skvm::Program::Deserialize(&tamperedIn, b).has_value());
+
+        // Untampered, it's fine.
+        SkMemoryStream in(data);
+        REPORTER_ASSERT(r, skvm::Program::Deserialize(&in, b).has_value());
+    });
+}
+
+DEF_TEST(SkVM_ProgramCache, r) {
+    skvm::Builder b;
+    {
+        auto src = b.varying<int>(),
+             dst = b.varying<int>();
+        b.store32(dst, b.mul(b.load32(src), b.splat(2)));
+    }
+
+    SkVMProgramCache cache;
+    cache.findOrBuild(b);
+    REPORTER_ASSERT(r, cache.count() == 1);
+
+    // Different strides make a different program, even with identical instructions.
+    skvm::Builder wide;
+    {
+        auto src = wide.varying(8),
+             dst = wide.varying<int>();
+        wide.store32(dst, wide.mul(wide.load32(src), wide.splat(2)));
+    }
+    REPORTER_ASSERT(r, wide.hash() == b.hash());
+    REPORTER_ASSERT(r, wide.programHash() != b.programHash());
+
+    SkDynamicMemoryWStream stream;
+    REPORTER_ASSERT(r, cache.writeTo(&stream));
+    std::unique_ptr<SkStreamAsset> in = stream.detachAsStream();
+
+    SkVMProgramCache reloaded;
+    REPORTER_ASSERT(r, reloaded.readFrom(in.get()));
+    REPORTER_ASSERT(r, reloaded.count() == 1);
+
+    std::optional<skvm::Program> p = reloaded.find(b);
+    REPORTER_ASSERT(r, p.has_value());
+    int src[] = {1,2,3,4,5},
+        dst[] = {0,0,0,0,0};
+    p->eval(std::size(src), src, dst);
+    for (size_t i = 0; i < std::size(src); i++) {
+        REPORTER_ASSERT(r, dst[i] == 2 * src[i]);
+    }
+    REPORTER_ASSERT(r, !reloaded.find(wide).has_value());
+
+    // Past its budget, the cache drops the least recently used program.
+    skvm::Builder triple;
+    {
+        auto src = triple.varying<int>(),
+             dst = triple.varying<int>();
+        triple.store32(dst, triple.mul(triple.load32(src), triple.splat(3)));
+    }
+    SkVMProgramCache small(2);
+    small.findOrBuild(b);
+    small.findOrBuild(wide);
+    REPORTER_ASSERT(r, small.find(b).has_value());
+    small.findOrBuild(triple);
+    REPORTER_ASSERT(r, small.count() == 2);
+    REPORTER_ASSERT(r, !small.find(wide).has_value());
+    REPORTER_ASSERT(r, small.find(b).has_value());
+    REPORTER_ASSERT(r, small.find(triple).has_value());
+}
+
+DEF_TEST(SkVM_precompute, r) {
+    // dst = src * (uniforms[1] + uniforms[2]) + uniforms[0], where only uniforms[0] changes
+    // between calls, so the sum can be precomputed into uniforms[3].
+    skvm::Builder b;
+    skvm::UPtr uniforms = b.uniform();
+    {
+        skvm::Ptr src = b.varying<float>(),
+                  dst = b.varying<float>();
+        skvm::F32 scale = b.uniformF(uniforms, 4) + b.uniformF(uniforms, 8);
+        b.storeF(dst, b.loadF(src) * scale + b.uniformF(uniforms, 0));
+    }
+    const int hoisted = b.done().loop();
+    b.precompute(uniforms, 4, 12);
+
+    test_jit_and_interpreter(b, [&](const skvm::Program& original) {
+        // Two uniform loads and their sum become a single load of the sum.
+        REPORTER_ASSERT(r, original.loop() == hoisted - 2);
+
+        SkDynamicMemoryWStream stream;
+        REPORTER_ASSERT(r, original.serialize(&stream));
+        SkMemoryStream in(stream.detachAsData());
+        std::optional<skvm::Program> deserialized = skvm::Program::Deserialize(&in, b);
+        if (!deserialized) {
+            ERRORF(r, "Couldn't deserialize a program with a precompute() prologue.");
+            return;
+        }
+
+        const skvm::Program& copy = *deserialized;
+        for (const skvm::Program* program : {&original, &copy}) {
+            REPORTER_ASSERT(r, program->precomputedBytes() == 4);
+
+            float uniforms[] = {0.0f, 1.0f, 2.0f, 0.0f};
+            program->precompute(uniforms);
+            REPORTER_ASSERT(r, uniforms[3] == 3.0f);
+
+            float src[] = {1,2,3,4,5,6,7,8,9},
+                  dst[] = {0,0,0,0,0,0,0,0,0};
+            for (float offset : {0.0f, 10.0f}) {
+                uniforms[0] = offset;
+                program->eval(std::size(src), uniforms, src, dst);
+                for (size_t i = 0; i < std::size(src); i++) {
+                    REPORTER_ASSERT(r, dst[i] == src[i] * 3 + offset);
+                }
+            }
+        }
+    });
+}
+
 DEF_TEST(SkVM_LoopCounts, r) {
     // Make sure we cover all the exact N we want.
 
@@ -8,6 +8,7 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkOverdrawCanvas.h"
 #include "include/core/SkPath.h"
 #include "include/core/SkRRect.h"
@@ -690,6 +691,63 @@ DEF_TEST(surface_raster_zeroinitialized, reporter) {
     }
 }
 
+DEF_TEST(SurfaceRasterTiled, reporter) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(2);
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(100, 70);
+
+    sk_sp<SkSurface> direct = SkSurface::MakeRaster(info);
+    sk_sp<SkSurface> tiled = SkSurface::MakeRasterTiled(info, executor.get(), {32, 16});
+    REPORTER_ASSERT(reporter, tiled);
+    REPORTER_ASSERT(reporter, tiled->imageInfo() == info);
+    REPORTER_ASSERT(reporter, !SkSurface::MakeRasterTiled(info, executor.get(), {0, 16}));
+
+    auto draw = [](SkCanvas* canvas, int frame) {
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        paint.setColor(frame ? SK_ColorBLUE : SK_ColorRED);
+        canvas->drawCircle(40 + 10 * frame, 30, 25, paint);
+
+        // Leave a save block open across the flush after the first frame.
+        if (frame == 0) {
+            canvas->save();
+            canvas->translate(5, 5);
+            canvas->clipRect(SkRect::MakeWH(60, 40));
+        }
+        paint.setColor(SK_ColorGREEN);
+        canvas->drawRect(SkRect::MakeXYWH(20, 20, 70, 30), paint);
+        if (frame == 1) {
+            canvas->restore();
+        }
+    };
+
+    // Snapshots must not see later draws, and later snapshots must see them.
+    sk_sp<SkImage> firstExpected, firstActual;
+    for (int frame = 0; frame < 2; ++frame) {
+        const uint32_t genID = tiled->generationID();
+        draw(direct->getCanvas(), frame);
+        draw(tiled->getCanvas(), frame);
+        REPORTER_ASSERT(reporter, tiled->generationID() != genID);
+
+        sk_sp<SkImage> expected = direct->makeImageSnapshot(),
+                       actual   = tiled->makeImageSnapshot();
+        REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(expected.get(), actual.get()));
+        if (frame == 0) {
+            firstExpected = std::move(expected);
+            firstActual   = std::move(actual);
+        }
+    }
+    REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(firstExpected.get(), firstActual.get()));
+
+    SkBitmap expected, actual;
+    expected.allocPixels(info);
+    actual.allocPixels(info);
+    direct->getCanvas()->drawColor(SK_ColorYELLOW, SkBlendMode::kDstOver);
+    tiled->getCanvas()->drawColor(SK_ColorYELLOW, SkBlendMode::kDstOver);
+    REPORTER_ASSERT(reporter, direct->readPixels(expected, 0, 0));
+    REPORTER_ASSERT(reporter, tiled->readPixels(actual, 0, 0));
+    REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(expected, actual));
+}
+
 static sk_sp<SkSurface> create_gpu_surface_backend_texture(GrDirectContext* dContext,
                                                            int sampleCnt,
                                                            const SkColor4f& color) {
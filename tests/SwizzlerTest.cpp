@@ -144,6 +144,25 @@ DEF_TEST(SwizzleOpts, r) {
     REPORTER_ASSERT(r, dst == 0xFA04ADCA);
 }
 
+DEF_TEST(SwizzleOpts_RGBA16, r) {
+    // Odd counts exercise both the vector loops and their scalar tails.
+    uint8_t src[8 * 37];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 37 + 11);
+    }
+    for (int count : {1, 3, 8, 17, 37}) {
+        uint32_t dst[37];
+        SkOpts::RGBA16_to_RGBA(dst, src, count);
+        for (int i = 0; i < count; i++) {
+            // PNG stores 16-bit components big-endian, so we keep the first byte of each.
+            const uint8_t* px = src + 8*i;
+            const uint32_t expected = (uint32_t)px[6] << 24 | (uint32_t)px[4] << 16
+                                    | (uint32_t)px[2] <<  8 | (uint32_t)px[0] <<  0;
+            REPORTER_ASSERT(r, dst[i] == expected, "count %d, pixel %d", count, i);
+        }
+    }
+}
+
 DEF_TEST(PublicSwizzleOpts, r) {
     uint32_t dst, src;
 
@@ -8,6 +8,7 @@
 #include "tests/Test.h"
 
 #include "include/core/SkColorSpace.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkPath.h"
 #include "include/core/SkRect.h"
 #include "include/effects/SkGradientShader.h"
@@ -20,6 +21,7 @@
 #include "src/gpu/ganesh/geometry/GrAATriangulator.h"
 #include "src/gpu/ganesh/geometry/GrInnerFanTriangulator.h"
 #include "src/gpu/ganesh/geometry/GrStyledShape.h"
+#include "src/gpu/ganesh/geometry/GrTriangulator.h"
 #include "src/shaders/SkShaderBase.h"
 #include "tools/ToolUtils.h"
 #include <map>
@@ -1313,3 +1315,135 @@ static void test_crbug_1262444(skiatest::Reporter* r) {
 DEF_TEST(TriangulatorBugs, r) {
     test_crbug_1262444(r);
 }
+
+// Counts the triangles that contain p, away from their edges.
+static int count_triangles_containing(const SkPoint* tris, int vertexCount, SkPoint p) {
+    int count = 0;
+    for (int i = 0; i + 2 < vertexCount; i += 3) {
+        float d0 = SkPoint::CrossProduct(tris[i + 1] - tris[i],     p - tris[i]),
+              d1 = SkPoint::CrossProduct(tris[i + 2] - tris[i + 1], p - tris[i + 1]),
+              d2 = SkPoint::CrossProduct(tris[i]     - tris[i + 2], p - tris[i + 2]);
+        if ((d0 > 0 && d1 > 0 && d2 > 0) || (d0 < 0 && d1 < 0 && d2 < 0)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+DEF_TEST(GrTriangulator_Parallel, r) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    GrTriangulatorArenas arenas;
+    const SkRect clipBounds = SkRect::MakeWH(1000, 1000);
+
+    SkRandom rand;
+    for (SkPathFillType fillType : {SkPathFillType::kWinding, SkPathFillType::kEvenOdd}) {
+        // Lots of small contours, some overlapping, some self-intersecting.
+        SkPath path;
+        path.setFillType(fillType);
+        for (int i = 0; i < 200; ++i) {
+            float x = rand.nextRangeF(0, 1000),
+                  y = rand.nextRangeF(0, 1000),
+                  s = rand.nextRangeF(2, 20);
+            switch (i % 3) {
+                case 0: path.addCircle(x, y, s); break;
+                case 1: path.addRect(SkRect::MakeXYWH(x, y, s, 2*s)); break;
+                case 2: path.moveTo(x, y).lineTo(x + s, y + 2*s).lineTo(x - s, y + s)
+                            .lineTo(x + s, y + s).close(); break;
+            }
+        }
+
+        SimplerVertexAllocator serialAlloc, parallelAlloc;
+        bool serialIsLinear, parallelIsLinear;
+        int serialCount = GrTriangulator::PathToTriangles(path, 0.25f, clipBounds, &serialAlloc,
+                                                          &serialIsLinear);
+        int parallelCount = GrTriangulator::PathToTrianglesParallel(
+                path, 0.25f, clipBounds, &parallelAlloc, &parallelIsLinear, executor.get(),
+                &arenas);
+        const SkPoint* serial   = reinterpret_cast<const SkPoint*>(serialAlloc.fVertexData.get());
+        const SkPoint* parallel = reinterpret_cast<const SkPoint*>(parallelAlloc.fVertexData.get());
+
+        REPORTER_ASSERT(r, serialCount > 0 && parallelCount > 0);
+        REPORTER_ASSERT(r, serialIsLinear == parallelIsLinear);
+
+        // Both triangulations should cover the same area.
+        for (int y = 0; y < 200; ++y)
+        for (int x = 0; x < 200; ++x) {
+            SkPoint p = {x * 5 + 0.3137f, y * 5 + 0.4711f};
+            if (count_triangles_containing(serial, serialCount, p) !=
+                count_triangles_containing(parallel, parallelCount, p)) {
+                ERRORF(r, "Triangulations differ at (%g, %g)", p.fX, p.fY);
+                return;
+            }
+        }
+    }
+}
+
+// Sums the coverage that the antialiased triangles interpolate at p.
+static float aa_coverage_at(const void* vertexData, int vertexCount, SkPoint p) {
+    struct Vertex {
+        SkPoint fPos;
+        float   fCoverage;
+    };
+    const Vertex* v = static_cast<const Vertex*>(vertexData);
+    float coverage = 0;
+    for (int i = 0; i + 2 < vertexCount; i += 3) {
+        float area = SkPoint::CrossProduct(v[i + 1].fPos - v[i].fPos, v[i + 2].fPos - v[i].fPos);
+        if (area == 0) {
+            continue;
+        }
+        float w0 = SkPoint::CrossProduct(v[i + 2].fPos - v[i + 1].fPos, p - v[i + 1].fPos) / area,
+              w1 = SkPoint::CrossProduct(v[i].fPos     - v[i + 2].fPos, p - v[i + 2].fPos) / area,
+              w2 = SkPoint::CrossProduct(v[i + 1].fPos - v[i].fPos,     p - v[i].fPos)     / area;
+        if (w0 > 0 && w1 > 0 && w2 > 0) {
+            coverage += w0 * v[i].fCoverage + w1 * v[i + 1].fCoverage + w2 * v[i + 2].fCoverage;
+        }
+    }
+    return coverage;
+}
+
+DEF_TEST(GrAATriangulator_Parallel, r) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    GrTriangulatorArenas arenas;
+    const SkRect clipBounds = SkRect::MakeWH(1000, 1000);
+
+    SkRandom rand;
+    for (SkPathFillType fillType : {SkPathFillType::kWinding, SkPathFillType::kEvenOdd}) {
+        // Clusters of small contours, far enough apart for their alpha ramps to be triangulated
+        // separately.
+        SkPath path;
+        path.setFillType(fillType);
+        for (int i = 0; i < 100; ++i) {
+            float x = (i % 10) * 100 + rand.nextRangeF(20, 60),
+                  y = (i / 20) * 100 + rand.nextRangeF(20, 60),
+                  s = rand.nextRangeF(2, 15);
+            switch (i % 3) {
+                case 0: path.addCircle(x, y, s); break;
+                case 1: path.addRect(SkRect::MakeXYWH(x, y, s, 2*s)); break;
+                case 2: path.moveTo(x, y).lineTo(x + s, y + 2*s).lineTo(x - s, y + s)
+                            .lineTo(x + s, y + s).close(); break;
+            }
+        }
+
+        SimplerVertexAllocator serialAlloc, parallelAlloc;
+        int serialCount = GrAATriangulator::PathToAATriangles(path, 0.25f, clipBounds,
+                                                              &serialAlloc);
+        int parallelCount = GrAATriangulator::PathToAATrianglesParallel(
+                path, 0.25f, clipBounds, &parallelAlloc, executor.get(), &arenas);
+        REPORTER_ASSERT(r, serialCount > 0 && parallelCount > 0);
+
+        // The groups may sweep in different directions than the whole path did, which can split
+        // the ramps into different triangles and interpolate them a little differently. But the
+        // coverage should agree to within that, and no two groups should overlap.
+        for (int y = 0; y < 100; ++y)
+        for (int x = 0; x < 200; ++x) {
+            SkPoint p = {x * 5 + 0.3137f, y * 5 + 0.4711f};
+            float serial   = aa_coverage_at(serialAlloc.fVertexData.get(), serialCount, p),
+                  parallel = aa_coverage_at(parallelAlloc.fVertexData.get(), parallelCount, p);
+            if (parallel > 1.001f || fabsf(serial - parallel) > 0.5f) {
+                ERRORF(r, "Coverage differs at (%g, %g): %g serial, %g parallel",
+                       p.fX, p.fY, serial, parallel);
+                return;
+            }
+        }
+    }
+}
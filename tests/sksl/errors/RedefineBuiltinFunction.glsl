@@ -0,0 +1,6 @@
+### Compilation failed:
+
+error: 1: built-in function 'float3 cross(float3 x, float3 y)' cannot be redefined
+float3 cross(float3 x, float3 y) { return x; }
+                                 ^^^^^^^^^^^^^
+1 error
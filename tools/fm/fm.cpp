@@ -11,6 +11,7 @@
 #include "include/docs/SkPDFDocument.h"
 #include "include/gpu/GrContextOptions.h"
 #include "include/gpu/GrDirectContext.h"
+#include "include/gpu/GrPersistentFileCache.h"
 #include "include/private/SkTHash.h"
 #include "src/core/SkColorSpacePriv.h"
 #include "src/core/SkMD5.h"
@@ -95,6 +96,11 @@ static DEFINE_int    (race, 0, "If >0, use threads to induce race conditions?");
 
 static DEFINE_string(writeShaders, "", "Write GLSL shaders to this directory if set.");
 
+static DEFINE_string(programCache, "",
+                     "Keep compiled GPU programs in this file between runs. "
+                     "Can't be combined with --writeShaders.");
+static DEFINE_int   (programCacheMB, 64, "Size budget for --programCache.");
+
 static DEFINE_string(key,        "", "Metadata passed through to .png encoder and .json output.");
 static DEFINE_string(properties, "", "Metadata passed through to .png encoder and .json output.");
 
@@ -404,6 +410,19 @@ int main(int argc, char** argv) {
     CommonFlags::SetCtxOptions(&baseOptions);
     baseOptions.fReducedShaderVariations = FLAGS_reducedshaders;
 
+    // --writeShaders needs the in-memory cache to see every shader compiled this run.
+    if (!FLAGS_programCache.isEmpty() && !FLAGS_writeShaders.isEmpty()) {
+        fprintf(stderr, "--programCache and --writeShaders can't be used together.\n");
+        return 1;
+    }
+
+    std::unique_ptr<GrPersistentFileCache> fileCache;
+    if (!FLAGS_programCache.isEmpty()) {
+        fileCache = GrPersistentFileCache::Make(FLAGS_programCache[0],
+                                                (size_t)FLAGS_programCacheMB << 20);
+        baseOptions.fPersistentCache = fileCache.get();
+    }
+
     sk_gpu_test::MemoryCache memoryCache;
     if (!FLAGS_writeShaders.isEmpty()) {
         baseOptions.fPersistentCache = &memoryCache;
@@ -696,5 +715,13 @@ int main(int argc, char** argv) {
 
     }
 
+    if (fileCache) {
+        auto stats = fileCache->stats();
+        fprintf(stderr, "--programCache: %d hits (%zu bytes), %d misses, %d stores (%zu bytes), "
+                        "%d evictions, %d entries (%zu bytes)\n",
+                stats.fHits, stats.fBytesLoaded, stats.fMisses, stats.fStores, stats.fBytesStored,
+                stats.fEvictions, stats.fEntries, stats.fBytesUsed);
+    }
+
     return 0;
 }
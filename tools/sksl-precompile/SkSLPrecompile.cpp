@@ -110,6 +110,10 @@ ResultCode processCommand(const std::vector<std::string>& paths) {
 
     SkSL::StringStream buffer;
     dehydrator.finish(buffer);
+    if (!dehydrator.isValid()) {
+        printf("'%s' is too large to dehydrate\n", inputPath.c_str());
+        return ResultCode::kInputError;
+    }
     const std::string& data = buffer.str();
 
     // Emit the dehydrated data into our output file.